@@ -16,6 +16,7 @@
 #ifndef OHOS_DISTRIBUTED_AUDIO_HIDUMPER_H
 #define OHOS_DISTRIBUTED_AUDIO_HIDUMPER_H
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include "sys/stat.h"
@@ -38,6 +39,7 @@ enum class HidumpFlag {
     GET_ABILITY,
     DUMP_AUDIO_DATA_START,
     DUMP_AUDIO_DATA_STOP,
+    GET_AEC_INFO,
 };
 class DaudioHidumper {
     FWK_DECLARE_SINGLE_INSTANCE_BASE(DaudioHidumper);
@@ -45,6 +47,7 @@ class DaudioHidumper {
 public:
     bool Dump(const std::vector<std::string> &args, std::string &result);
     bool QueryDumpDataFlag();
+    void SetAecDelay(const bool isValid, const int64_t delayUs);
     DaudioHidumper();
     ~DaudioHidumper();
 
@@ -58,11 +61,14 @@ private:
     int32_t GetAbilityInfo(std::string &result);
     int32_t StartDumpData(std::string &result);
     int32_t StopDumpData(std::string &result);
+    int32_t GetAecInfo(std::string &result);
 
 private:
     sptr<IAudioManager> audioManager_ = nullptr;
     std::vector<AudioAdapterDescriptor> adapterdesc_;
     bool dumpAudioDataFlag_ = false;
+    std::atomic<bool> isAecDelayValid_ = false;
+    std::atomic<int64_t> aecDelayUs_ = 0;
     const std::string DEFAULT_SPK_DHID = "1";
     const std::string DEFAULT_MIC_DHID = "134217729";
 };
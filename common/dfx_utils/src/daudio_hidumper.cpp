@@ -34,6 +34,7 @@ const std::string ARGS_SINK_INFO = "--sinkInfo";
 const std::string ARGS_ABILITY = "--ability";
 const std::string ARGS_DUMP_AUDIO_DATA_START = "--startDump";
 const std::string ARGS_DUMP_AUDIO_DATA_STOP = "--stopDump";
+const std::string ARGS_AEC_INFO = "--aecInfo";
 
 const std::map<std::string, HidumpFlag> ARGS_MAP = {
     { ARGS_HELP, HidumpFlag::GET_HELP },
@@ -42,6 +43,7 @@ const std::map<std::string, HidumpFlag> ARGS_MAP = {
     { ARGS_ABILITY, HidumpFlag::GET_ABILITY },
     { ARGS_DUMP_AUDIO_DATA_START, HidumpFlag::DUMP_AUDIO_DATA_START },
     { ARGS_DUMP_AUDIO_DATA_STOP, HidumpFlag::DUMP_AUDIO_DATA_STOP },
+    { ARGS_AEC_INFO, HidumpFlag::GET_AEC_INFO },
 };
 }
 
@@ -102,6 +104,9 @@ int32_t DaudioHidumper::ProcessDump(const std::string &args, std::string &result
         case HidumpFlag::DUMP_AUDIO_DATA_STOP: {
             return StopDumpData(result);
         }
+        case HidumpFlag::GET_AEC_INFO: {
+            return GetAecInfo(result);
+        }
         default: {
             return ShowIllegalInfomation(result);
         }
@@ -188,6 +193,23 @@ bool DaudioHidumper::QueryDumpDataFlag()
     return dumpAudioDataFlag_;
 }
 
+void DaudioHidumper::SetAecDelay(const bool isValid, const int64_t delayUs)
+{
+    aecDelayUs_.store(delayUs);
+    isAecDelayValid_.store(isValid);
+}
+
+int32_t DaudioHidumper::GetAecInfo(std::string &result)
+{
+    DHLOGI("Get aec info dump.");
+    if (!isAecDelayValid_.load()) {
+        result.append("aecDelayUs: unknown");
+        return DH_SUCCESS;
+    }
+    result.append("aecDelayUs: ").append(std::to_string(aecDelayUs_.load()));
+    return DH_SUCCESS;
+}
+
 void DaudioHidumper::ShowHelp(std::string &result)
 {
     DHLOGI("Show help.");
@@ -204,7 +226,9 @@ void DaudioHidumper::ShowHelp(std::string &result)
         .append("--startDump")
         .append(": start dump audio data in the system /data/data/daudio\n")
         .append("--stopDump")
-        .append(": stop dump audio data in the system\n");
+        .append(": stop dump audio data in the system\n")
+        .append("--aecInfo     ")
+        .append(": dump estimated echo path delay of the aec\n");
 }
 
 int32_t DaudioHidumper::ShowIllegalInfomation(std::string &result)
@@ -98,5 +98,27 @@ HWTEST_F(DAudioHidumperTest, StartDumpData_001, TestSize.Level1)
     EXPECT_EQ(HDF_SUCCESS, hidumper_->StartDumpData(result));
     EXPECT_EQ(true, hidumper_->QueryDumpDataFlag());
 }
+
+/**
+ * @tc.name: GetAecInfo_001
+ * @tc.desc: Verify the GetAecInfo function reports the published echo delay.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioHidumperTest, GetAecInfo_001, TestSize.Level1)
+{
+    ASSERT_TRUE(hidumper_ != nullptr);
+    std::string result;
+    std::vector<std::string> args = { "--aecInfo" };
+    EXPECT_EQ(true, hidumper_->Dump(args, result));
+    EXPECT_EQ("aecDelayUs: unknown", result);
+    hidumper_->SetAecDelay(true, 180000);
+    EXPECT_EQ(true, hidumper_->Dump(args, result));
+    EXPECT_EQ("aecDelayUs: 180000", result);
+    hidumper_->SetAecDelay(false, 0);
+    result.clear();
+    EXPECT_EQ(DH_SUCCESS, hidumper_->GetAecInfo(result));
+    EXPECT_EQ("aecDelayUs: unknown", result);
+}
 } // DistributedHardware
 } // OHOS
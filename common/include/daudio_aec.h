@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DAUDIO_AEC_H
+#define OHOS_DAUDIO_AEC_H
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "daudio_fft.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Acoustic echo canceller for 16-bit interleaved PCM, built as a partitioned-block frequency-domain
+ * NLMS filter. The reference is downmixed to mono and decimated to the mic rate, which must divide
+ * the reference rate. Each mic channel then has its own filter of AEC_FILTER_MS, split into
+ * partitions of one block of about AEC_BLOCK_MS. The echo estimate is computed by overlap-save,
+ * each bin's step is normalised by the smoothed reference power in that bin, and one partition per
+ * block is constrained back to a linear filter, so the filter converges on coloured references
+ * without a full constraint every block.
+ *
+ * Mic input is processed in whole blocks. Process() always returns as many frames as it is given,
+ * and the output trails the input by less than one block. A block without reference data is
+ * passed through with its current estimate and does not adapt. A filter that makes the output
+ * louder than the mic signal is reset. The spectral kernels are picked once per process for NEON,
+ * AVX2 or SSE2 when available. The canceller is not thread-safe.
+ */
+class DaudioAec {
+public:
+    static constexpr uint32_t AEC_BLOCK_MS = 4;
+    static constexpr uint32_t AEC_FILTER_MS = 64;
+    static constexpr uint32_t AEC_MAX_REF_MS = 200;
+    static constexpr uint32_t AEC_MAX_RATE_RATIO = 12;
+
+    DaudioAec() = default;
+    ~DaudioAec() = default;
+
+    int32_t Init(const uint32_t refSampleRate, const uint32_t refChannels, const uint32_t micSampleRate,
+        const uint32_t micChannels, const int32_t bitFormat);
+    void Reset();
+    void PushReference(const uint8_t *data, const size_t len);
+    size_t Process(const uint8_t *in, const size_t len, uint8_t *out, const size_t outLen);
+    uint32_t GetBlockFrames() const;
+    static const char *GetKernelName();
+
+private:
+    void PushMonoReference(const float sample);
+    void ProcessBlock();
+    void ProcessChannel(const uint32_t channel, bool adapt, const size_t outBase);
+    void Constrain(const uint32_t partition);
+    void LoadSpectrum(const float *re, const float *im);
+
+    bool enabled_ = false;
+    uint32_t refChannels_ = 1;
+    uint32_t micChannels_ = 1;
+    uint32_t rateRatio_ = 1;
+    uint32_t blockFrames_ = 0;
+    uint32_t bins_ = 0;
+    uint32_t stride_ = 0;
+    uint32_t partitions_ = 0;
+    DaudioFft fft_;
+    std::vector<std::complex<float>> fftBuf_;
+
+    // Reference decimation to the mic rate.
+    std::vector<float> decimTaps_;
+    std::vector<float> decimHistory_;
+    uint32_t decimPos_ = 0;
+    uint32_t decimPhase_ = 0;
+
+    // Mono reference at the mic rate waiting for its block.
+    std::vector<float> refFifo_;
+    size_t refHead_ = 0;
+    size_t refCount_ = 0;
+
+    std::vector<int16_t> micPending_;
+    std::vector<int16_t> outPending_;
+
+    // The last two reference blocks, and the spectra of the last partitions_ of them, newest at xHead_.
+    std::vector<float> refTime_;
+    std::vector<float> xRe_;
+    std::vector<float> xIm_;
+    uint32_t xHead_ = 0;
+    std::vector<float> power_;
+
+    // Filter spectra per mic channel and partition, and per-block scratch.
+    std::vector<float> wRe_;
+    std::vector<float> wIm_;
+    std::vector<float> accRe_;
+    std::vector<float> accIm_;
+    std::vector<float> mic_;
+    std::vector<float> err_;
+    uint32_t constrainNext_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DAUDIO_AEC_H
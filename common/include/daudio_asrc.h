@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DAUDIO_ASRC_H
+#define OHOS_DAUDIO_ASRC_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Estimates the clock drift between the producer of a stream and its local consumer in parts per
+ * million. Both sides report the frames they deliver or take together with the local monotonic
+ * time of the call, and each side's rate is measured against that common clock separately, so
+ * what the queue in between drops, conceals or resamples does not affect the estimate.
+ *
+ * For each side the lag of the call time behind its frame count is sampled on every call, and the
+ * smallest lag of each DRIFT_BLOCK_MS block is kept, which rejects late network arrivals and late
+ * wakeups. The side's skew is the least-squares slope of its last DRIFT_WINDOW_BLOCKS block minima;
+ * the drift is published once both sides have DRIFT_MIN_BLOCKS blocks. A side silent for more
+ * than DRIFT_GAP_MS, such as across a pause, starts its history over and keeps its last skew until
+ * the new history is long enough. The producer and the consumer side may report from different
+ * threads.
+ */
+class DaudioDriftEstimator {
+public:
+    static constexpr uint32_t DRIFT_BLOCK_MS = 1000;
+    static constexpr uint32_t DRIFT_WINDOW_BLOCKS = 64;
+    static constexpr uint32_t DRIFT_MIN_BLOCKS = 16;
+    static constexpr uint32_t DRIFT_GAP_MS = 500;
+    static constexpr double DRIFT_MAX_PPM = 1000.0;
+
+    DaudioDriftEstimator() = default;
+    ~DaudioDriftEstimator() = default;
+
+    void Reset(const uint32_t sampleRate);
+    void OnProduced(const uint64_t frames, const int64_t nowNs);
+    void OnConsumed(const uint64_t frames, const int64_t nowNs);
+    double GetDriftPpm() const;
+    double GetRatio() const;
+
+private:
+    class ClockTrack {
+    public:
+        void Reset(const uint32_t sampleRate);
+        void OnFrames(const uint64_t frames, const int64_t nowNs);
+        bool GetSkewPpm(double &skewPpm) const;
+
+    private:
+        void Estimate();
+
+        struct Block {
+            double timeNs = 0;
+            double lagNs = 0;
+        };
+        uint32_t sampleRate_ = 0;
+        uint64_t frames_ = 0;
+        int64_t originNs_ = -1;
+        int64_t lastNs_ = 0;
+        int64_t blockEndNs_ = 0;
+        double blockMinNs_ = 0;
+        bool isBlockEmpty_ = true;
+        std::array<Block, DRIFT_WINDOW_BLOCKS> blocks_ {};
+        uint32_t blockHead_ = 0;
+        uint32_t blockNum_ = 0;
+        std::atomic<double> skewPpm_ = 0;
+        std::atomic<bool> isValid_ = false;
+    };
+
+    ClockTrack producer_;
+    ClockTrack consumer_;
+};
+
+/*
+ * Asynchronous sample-rate converter for 16-bit interleaved PCM. SetRatio() sets how many input
+ * frames each output frame advances by; the estimator's GetRatio() makes the output follow the
+ * consumer clock. Until a ratio other than 1 is set the converter is bypassed and Process() copies
+ * its input. After that every output frame is interpolated by a polyphase windowed-sinc filter of
+ * ASRC_HALF_TAPS taps per side, which delays the stream by ASRC_HALF_TAPS frames once.
+ *
+ * Other sample formats are always bypassed.
+ */
+class DaudioAsrc {
+public:
+    static constexpr uint32_t ASRC_PHASES = 128;
+    static constexpr uint32_t ASRC_HALF_TAPS = 8;
+    static constexpr uint32_t ASRC_TAPS = 2 * ASRC_HALF_TAPS;
+    static constexpr double ASRC_MAX_RATIO_DEVIATION = DaudioDriftEstimator::DRIFT_MAX_PPM / 1000000.0;
+
+    DaudioAsrc() = default;
+    ~DaudioAsrc() = default;
+
+    int32_t Init(const uint32_t channels, const int32_t bitFormat);
+    void Reset();
+    void SetRatio(const double ratio);
+    double GetRatio() const;
+    bool IsEngaged() const;
+    size_t GetMaxOutputBytes(const size_t len) const;
+    size_t Process(const uint8_t *in, const size_t len, uint8_t *out, const size_t outLen);
+
+private:
+    bool enabled_ = false;
+    bool engaged_ = false;
+    uint32_t channels_ = 1;
+    size_t frameBytes_ = 1;
+    double ratio_ = 1.0;
+    // Read position and step in input frames, 32.32 fixed point, relative to the start of history_.
+    uint64_t pos_ = 0;
+    uint64_t step_ = 0;
+    std::vector<float> history_;
+    std::array<float, ASRC_TAPS> coefs_ {};
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DAUDIO_ASRC_H
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DAUDIO_CLOCK_MODEL_H
+#define OHOS_DAUDIO_CLOCK_MODEL_H
+
+#include <array>
+#include <cstdint>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Linear model of one capturer clock: the monotonic time at which a given frame position was
+ * captured. Every framework timestamp query adds a (framePosition, timeNs) sample, and the time of
+ * any position is read from the least-squares line through the last CLOCK_WINDOW_SAMPLES samples.
+ * Until CLOCK_MIN_SAMPLES samples are in, the line runs at the nominal rate through their mean,
+ * and a fitted rate is clamped to CLOCK_MAX_PPM of nominal, so one noisy query moves the line by a
+ * small fraction of its error instead of stepping it.
+ *
+ * A sample further than CLOCK_OUTLIER_MS off the line is dropped; once CLOCK_MAX_OUTLIERS samples
+ * in a row are dropped, or the position goes backwards, the clock is taken to have stepped and the
+ * history starts over. The model is not thread-safe and is meant to be driven by the capture thread.
+ */
+class DaudioClockModel {
+public:
+    static constexpr uint32_t CLOCK_WINDOW_SAMPLES = 512;
+    static constexpr uint32_t CLOCK_MIN_SAMPLES = 8;
+    static constexpr uint32_t CLOCK_OUTLIER_MS = 2;
+    static constexpr uint32_t CLOCK_MAX_OUTLIERS = 8;
+    static constexpr double CLOCK_MAX_PPM = 1000.0;
+
+    DaudioClockModel() = default;
+    ~DaudioClockModel() = default;
+
+    void Reset(const uint32_t sampleRate);
+    void AddSample(const uint64_t framePosition, const int64_t timeNs);
+    bool IsValid() const;
+    int64_t GetTimeNs(const uint64_t framePosition) const;
+    double GetRatePpm() const;
+
+private:
+    void Restart(const uint64_t framePosition, const int64_t timeNs);
+    void Fit();
+    double Evaluate(const double frames) const;
+
+    struct Sample {
+        double frames = 0;
+        double timeNs = 0;
+    };
+    uint32_t sampleRate_ = 0;
+    double nominalNsPerFrame_ = 0;
+    uint64_t originFrame_ = 0;
+    int64_t originNs_ = 0;
+    uint64_t lastFrame_ = 0;
+    std::array<Sample, CLOCK_WINDOW_SAMPLES> samples_ {};
+    uint32_t sampleHead_ = 0;
+    uint32_t sampleNum_ = 0;
+    uint32_t outlierNum_ = 0;
+    double meanFrames_ = 0;
+    double meanTimeNs_ = 0;
+    double nsPerFrame_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DAUDIO_CLOCK_MODEL_H
@@ -110,6 +110,15 @@ const std::string AUDIO_EVENT_RESTART = "restart";
 const std::string AUDIO_EVENT_PAUSE = "pause";
 
 const std::string AUDIO_ENGINE_FLAG = "persist.distributedhardware.distributedaudio.engine.enable";
+const std::string PERIOD_SCHED_FIFO_PARA = "persist.distributedhardware.distributedaudio.period.fifo_priority";
+const std::string MIC_LATENCY_BUDGET_PARA = "persist.distributedhardware.distributedaudio.mic.latency_ms";
+const std::string MIC_OVERFLOW_POLICY_PARA = "persist.distributedhardware.distributedaudio.mic.overflow_policy";
+const std::string MIC_PLC_MAX_CONCEAL_PARA = "persist.distributedhardware.distributedaudio.mic.plc_max_ms";
+const std::string MMAP_POSITION_INTERP_PARA = "persist.distributedhardware.distributedaudio.mmap.position_interp";
+const std::string SPK_PLAYOUT_TARGET_PARA = "persist.distributedhardware.distributedaudio.spk.playout_target_ms";
+const std::string PACKET_TIME_MEDIA_PARA = "persist.distributedhardware.distributedaudio.packet_time.media_ms";
+const std::string PACKET_TIME_VOICE_PARA = "persist.distributedhardware.distributedaudio.packet_time.voice_ms";
+const std::string AVSYNC_LEGACY_LOCK_PARA = "persist.distributedhardware.distributedaudio.avsync.legacy_lock";
 const std::string KEY_TYPE_META = "meta";
 const std::string KEY_TYPE_FULL = "full";
 
@@ -156,6 +165,7 @@ constexpr const char *VOLUME_EVENT_TYPE = "EVENT_TYPE";
 constexpr const char *KEY_DATATYPE = "dataType";
 constexpr const char *INTERRUPT_GROUP_ID = "INTERRUPT_GROUP_ID";
 constexpr const char *KEY_CODEC_TYPE = "codecType";
+constexpr const char *KEY_PACKET_FRAMES = "packetFrames";
 constexpr const char *CODEC = "Codec";
 constexpr const char *PROTOCOLVER = "ProtocolVer";
 constexpr const char *VERSION_TWO = "2.0";
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DAUDIO_ECHO_DELAY_H
+#define OHOS_DAUDIO_ECHO_DELAY_H
+
+#include <atomic>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "daudio_fft.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Estimates the echo path delay between the playback reference and the captured microphone signal
+ * and hands the echo canceller the reference that lines up with each capture frame.
+ *
+ * Both streams are downmixed and box-averaged to ECHO_DELAY_RATE. Every ECHO_DELAY_INTERVAL_MS of
+ * capture, the last ECHO_DELAY_MIC_WINDOW decimated capture samples are cross-correlated against
+ * the last ECHO_DELAY_FFT_SIZE reference samples with the phase transform (GCC-PHAT), and the peak
+ * within ECHO_DELAY_MAX_MS gives the delay. A window in which either side is near silence is
+ * skipped, and a peak is only taken once it stands ECHO_DELAY_MIN_CONFIDENCE times above the mean
+ * correlation and a second estimate confirms it within ECHO_DELAY_TOLERANCE_US, so double talk or
+ * a single spurious peak does not move the alignment.
+ *
+ * The delay is kept as an offset between the absolute sample counts of the two streams, so it does
+ * not depend on how the pushes of the two sides interleave. GetAlignedReference() returns the
+ * full-rate reference that ends ECHO_DELAY_MARGIN_MS after the latest capture sample's echo, which
+ * keeps the echo causal for the canceller's filter; until a delay is found it returns the newest
+ * reference. Only 16-bit interleaved PCM is supported. The estimator is not thread-safe; only
+ * GetDelayUs() and IsValid() may be read from other threads.
+ */
+class DaudioEchoDelayEstimator {
+public:
+    static constexpr uint32_t ECHO_DELAY_RATE = 8000;
+    static constexpr uint32_t ECHO_DELAY_FFT_SIZE = 16384;
+    static constexpr uint32_t ECHO_DELAY_MIC_WINDOW = 2048;
+    static constexpr uint32_t ECHO_DELAY_MAX_MS = 1000;
+    static constexpr uint32_t ECHO_DELAY_INTERVAL_MS = 500;
+    static constexpr uint32_t ECHO_DELAY_MARGIN_MS = 4;
+    static constexpr uint32_t ECHO_DELAY_TOLERANCE_US = 1000;
+    static constexpr float ECHO_DELAY_MIN_CONFIDENCE = 12.0f;
+
+    DaudioEchoDelayEstimator() = default;
+    ~DaudioEchoDelayEstimator() = default;
+
+    int32_t Init(const uint32_t refSampleRate, const uint32_t refChannels, const uint32_t micSampleRate,
+        const uint32_t micChannels, const int32_t bitFormat);
+    void Reset();
+    void PushReference(const uint8_t *data, const size_t len);
+    void PushCapture(const uint8_t *data, const size_t len);
+    size_t GetAlignedReference(uint8_t *out, const size_t len) const;
+    bool IsValid() const;
+    int64_t GetDelayUs() const;
+    float GetConfidence() const;
+
+private:
+    class Decimator {
+    public:
+        void Init(const uint32_t sampleRate, const uint32_t channels, const uint32_t historySize);
+        void Reset();
+        void Push(const int16_t *samples, const size_t frames);
+        uint64_t GetFrames() const;
+        uint64_t GetCount() const;
+        // Copies the newest num decimated samples into out, zero-filling those never produced.
+        void CopyLatest(std::complex<float> *out, const uint32_t num) const;
+        float GetPower(const uint32_t num) const;
+
+    private:
+        uint32_t sampleRate_ = 0;
+        uint32_t channels_ = 1;
+        uint64_t frames_ = 0;
+        uint64_t count_ = 0;
+        float acc_ = 0;
+        uint32_t accNum_ = 0;
+        std::vector<float> history_;
+    };
+
+    void Estimate();
+
+    bool enabled_ = false;
+    uint32_t refSampleRate_ = 0;
+    uint32_t refChannels_ = 1;
+    uint32_t micSampleRate_ = 0;
+    uint32_t micChannels_ = 1;
+    Decimator refDecimator_;
+    Decimator micDecimator_;
+    // Full-rate reference history, indexed by absolute reference frame modulo its frame count.
+    std::vector<int16_t> refHistory_;
+    uint64_t refHistoryFrames_ = 0;
+    uint64_t micSinceEstimate_ = 0;
+    DaudioFft fft_;
+    std::vector<std::complex<float>> refSpectrum_;
+    std::vector<std::complex<float>> micSpectrum_;
+    // Decimated reference count minus decimated capture count of matching samples.
+    int64_t offset_ = 0;
+    int64_t candidateOffset_ = 0;
+    bool hasCandidate_ = false;
+    std::atomic<bool> isValid_ = false;
+    std::atomic<int64_t> delayUs_ = 0;
+    std::atomic<float> confidence_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DAUDIO_ECHO_DELAY_H
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DAUDIO_FFT_H
+#define OHOS_DAUDIO_FFT_H
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * In-place iterative radix-2 FFT of complex float data for one power-of-two size. Init() builds
+ * the bit-reversal permutation and the twiddle table once; Forward() and Inverse() then allocate
+ * nothing. Inverse() is scaled by 1/size, so Inverse(Forward(x)) returns x.
+ */
+class DaudioFft {
+public:
+    static constexpr uint32_t FFT_MAX_SIZE = 1U << 20;
+
+    DaudioFft() = default;
+    ~DaudioFft() = default;
+
+    int32_t Init(const uint32_t size);
+    uint32_t GetSize() const;
+    void Forward(std::complex<float> *data) const;
+    void Inverse(std::complex<float> *data) const;
+
+private:
+    void Transform(std::complex<float> *data, const bool inverse) const;
+
+    uint32_t size_ = 0;
+    std::vector<uint32_t> bitReverse_;
+    std::vector<std::complex<float>> twiddles_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DAUDIO_FFT_H
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DAUDIO_JITTER_ESTIMATOR_H
+#define OHOS_DAUDIO_JITTER_ESTIMATOR_H
+
+#include <array>
+#include <cstdint>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Picks the depth of a frame jitter queue from the observed network jitter. Every arriving frame
+ * contributes its transit time (local arrival time minus sender pts); the spread between the
+ * lowest transit time and the JITTER_PERCENTILE-th percentile over the last JITTER_WINDOW_SIZE
+ * frames, rounded up to whole frames, is how much buffering would have hidden that jitter.
+ *
+ * The target grows as soon as the spread or an underrun asks for it, and shrinks by one frame at
+ * a time only after JITTER_WINDOW_SIZE frames without growth, so a single quiet interval does not
+ * undo the depth a burst just needed. The clock offset between sender and receiver cancels out
+ * and slow drift is absorbed by the sliding minimum.
+ */
+class DaudioJitterEstimator {
+public:
+    static constexpr uint32_t JITTER_WINDOW_SIZE = 128;
+    static constexpr uint32_t JITTER_PERCENTILE = 95;
+    static constexpr uint32_t JITTER_RECALC_INTERVAL = 8;
+
+    DaudioJitterEstimator() = default;
+    ~DaudioJitterEstimator() = default;
+
+    void Reset(const int64_t frameDurationUs, const uint32_t minDepth, const uint32_t maxDepth);
+    void SetDepthRange(const uint32_t minDepth, const uint32_t maxDepth);
+    void OnFrameArrived(const int64_t pts, const int64_t arrivalUs);
+    void OnUnderrun();
+    uint32_t GetTargetDepth() const;
+    int64_t GetJitterUs() const;
+
+private:
+    void UpdateTarget();
+    uint32_t ClampDepth(const uint32_t depth) const;
+
+private:
+    std::array<int64_t, JITTER_WINDOW_SIZE> transit_ {};
+    std::array<int64_t, JITTER_WINDOW_SIZE> scratch_ {};
+    uint32_t sampleNum_ = 0;
+    uint32_t writeIndex_ = 0;
+    uint32_t framesSinceRecalc_ = 0;
+    uint32_t framesSinceGrow_ = 0;
+    int64_t frameDurationUs_ = 0;
+    int64_t jitterUs_ = 0;
+    uint32_t minDepth_ = 1;
+    uint32_t maxDepth_ = 1;
+    uint32_t targetDepth_ = 1;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DAUDIO_JITTER_ESTIMATOR_H
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DAUDIO_MMAP_POSITION_H
+#define OHOS_DAUDIO_MMAP_POSITION_H
+
+#include <cstdint>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Hardware position of one MMAP stream, published by its enqueue tick and read by the HDF. The
+ * frame count and the tick time are stored together under a seqlock, so a reader never pairs the
+ * count of one tick with the time of another.
+ *
+ * In interpolated mode Read() extrapolates the count from the last tick to now at the nominal
+ * rate and reports now as the time. The extrapolation is capped at one period past the published
+ * count, so it never runs ahead of the next tick and the reported position never goes backwards.
+ */
+class DaudioMmapPosition {
+public:
+    DaudioMmapPosition() = default;
+    ~DaudioMmapPosition() = default;
+
+    void Reset(const uint32_t sampleRate, const uint32_t periodFrames, const bool interpolated);
+    void Publish(const uint64_t frames, const int64_t timeNs);
+    int32_t Read(uint64_t &frames, int64_t &timeNs) const;
+
+private:
+    struct Snapshot {
+        uint32_t version = 1;
+        uint32_t sampleRate = 0;
+        uint32_t periodFrames = 0;
+        bool interpolated = false;
+        uint64_t frames = 0;
+        int64_t timeNs = 0;
+    };
+
+    mutable Snapshot snapshot_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DAUDIO_MMAP_POSITION_H
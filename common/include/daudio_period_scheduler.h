@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DAUDIO_PERIOD_SCHEDULER_H
+#define OHOS_DAUDIO_PERIOD_SCHEDULER_H
+
+#include <array>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "dhfwk_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr uint32_t PERIOD_LATENESS_BUCKET_NUM = 8;
+// Upper bounds, in microseconds, of all but the last lateness bucket; the last one is open-ended.
+constexpr std::array<int64_t, PERIOD_LATENESS_BUCKET_NUM - 1> PERIOD_LATENESS_BOUNDS_US = {
+    50, 100, 200, 500, 1000, 2000, 5000
+};
+
+struct DaudioPeriodStats {
+    uint64_t ticks = 0;
+    uint64_t deadlineMisses = 0;
+    uint64_t skippedTicks = 0;
+    int64_t maxLatenessNs = 0;
+    std::array<uint64_t, PERIOD_LATENESS_BUCKET_NUM> latenessHistogram {};
+};
+
+/*
+ * Drives every periodic MMAP stream of the service from one thread. The thread sleeps on a single
+ * CLOCK_MONOTONIC timerfd armed for the earliest pending deadline and runs due ticks earliest
+ * deadline first, so N streams cost one wake-up per deadline instead of N independent sleepers.
+ *
+ * Deadlines are start + phase + n * period, so there is no drift to correct. A tick that runs a
+ * full period or more after its deadline counts as a deadline miss; a stream more than
+ * PERIOD_MAX_CATCH_UP periods behind is re-based to now instead of bursting the missed ticks.
+ *
+ * Ticks must not block. Unregister() waits for a running tick of that stream to return unless it
+ * is called from the tick itself. The thread runs SCHED_FIFO when PERIOD_SCHED_FIFO_PARA holds a
+ * priority above zero.
+ */
+class DaudioPeriodScheduler {
+    FWK_DECLARE_SINGLE_INSTANCE_BASE(DaudioPeriodScheduler);
+
+public:
+    using TickFunc = std::function<void()>;
+    static constexpr int64_t PERIOD_MAX_CATCH_UP = 4;
+
+    int32_t Register(const std::string &name, const int64_t periodNs, const int64_t phaseNs, TickFunc tick,
+        uint32_t &streamId);
+    int32_t Unregister(const uint32_t streamId);
+    int32_t GetStats(const uint32_t streamId, DaudioPeriodStats &stats);
+
+private:
+    DaudioPeriodScheduler() = default;
+    ~DaudioPeriodScheduler();
+
+    struct Stream {
+        std::string name;
+        int64_t periodNs = 0;
+        int64_t nextDeadlineNs = 0;
+        TickFunc tick;
+        DaudioPeriodStats stats;
+    };
+
+    int32_t StartLocked();
+    void Loop();
+    void ArmTimerLocked();
+    void WakeLoop();
+    void SetRealtimePolicy();
+    std::shared_ptr<Stream> PickDueLocked(const int64_t nowNs, uint32_t &streamId);
+    static void RecordLateness(Stream &stream, const int64_t latenessNs);
+
+    std::mutex mutex_;
+    std::condition_variable tickDoneCond_;
+    std::map<uint32_t, std::shared_ptr<Stream>> streams_;
+    uint32_t nextStreamId_ = 1;
+    uint32_t runningStreamId_ = 0;
+    int32_t timerFd_ = -1;
+    int32_t eventFd_ = -1;
+    bool isRunning_ = false;
+    std::thread loopThread_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DAUDIO_PERIOD_SCHEDULER_H
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DAUDIO_PLC_H
+#define OHOS_DAUDIO_PLC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Packet loss concealment for 16-bit interleaved PCM. OnGoodFrame() must see every frame that
+ * arrived, in order; Conceal() fills a frame that did not.
+ *
+ * A loss run repeats the last pitch period of the history, estimated once per run by normalised
+ * autocorrelation, with a gain that ramps linearly from 1 to 0 over maxConcealMs. Once that
+ * budget is spent the output is muted. The first good frame after a loss run is cross-faded from
+ * the continued concealment over PLC_CROSSFADE_MS, so it fades back in from a muted run as well.
+ */
+class DaudioPlc {
+public:
+    static constexpr uint32_t PLC_HISTORY_MS = 40;
+    static constexpr uint32_t PLC_CROSSFADE_MS = 5;
+    static constexpr uint32_t PLC_MIN_PITCH_HZ = 50;
+    static constexpr uint32_t PLC_MAX_PITCH_HZ = 400;
+    static constexpr uint32_t PLC_DEFAULT_MAX_CONCEAL_MS = 60;
+
+    DaudioPlc() = default;
+    ~DaudioPlc() = default;
+
+    int32_t Init(const uint32_t sampleRate, const uint32_t channels, const int32_t bitFormat,
+        const uint32_t maxConcealMs);
+    void Reset();
+    void OnGoodFrame(uint8_t *data, const size_t len);
+    bool Conceal(uint8_t *data, const size_t len);
+    uint32_t GetPitchSamples() const;
+    uint64_t GetConcealedFrames() const;
+    uint64_t GetMutedFrames() const;
+    uint64_t GetLossEvents() const;
+
+private:
+    void AppendHistory(const int16_t *samples, const size_t sampleNum);
+    uint32_t EstimatePitch() const;
+    void Synthesize(int16_t *out, const size_t sampleNum);
+
+private:
+    bool enabled_ = false;
+    uint32_t sampleRate_ = 0;
+    uint32_t channels_ = 0;
+    // History is kept interleaved; all lengths below are in samples per channel.
+    std::vector<int16_t> history_;
+    std::vector<int16_t> fadeScratch_;
+    size_t historySamples_ = 0;
+    size_t historyValid_ = 0;
+    size_t crossfadeSamples_ = 0;
+    size_t maxConcealSamples_ = 0;
+    size_t concealedRun_ = 0;
+    uint32_t pitchSamples_ = 0;
+    uint32_t phase_ = 0;
+    bool inLoss_ = false;
+    uint64_t concealedFrames_ = 0;
+    uint64_t mutedFrames_ = 0;
+    uint64_t lossEvents_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DAUDIO_PLC_H
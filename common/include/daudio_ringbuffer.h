@@ -16,6 +16,7 @@
 #ifndef OHOS_DAUDIO_RING_BUFFER_H
 #define OHOS_DAUDIO_RING_BUFFER_H
 
+#include <atomic>
 #include <memory>
 #include <string>
 
@@ -48,6 +49,77 @@ private:
     int32_t readPos_ = 0;
     int32_t tag_ = 0;
 };
+
+enum class DaudioRingOverflowPolicy : int32_t {
+    DROP_NEWEST = 0,
+    OVERWRITE_OLDEST = 1,
+};
+
+struct DaudioRingStats {
+    uint64_t overrunCount = 0;
+    uint64_t overrunBytes = 0;
+    uint64_t underrunCount = 0;
+    uint32_t highWatermark = 0;
+};
+
+/*
+ * Single-producer/single-consumer byte ring. Write()/AcquireWrite()/CommitWrite() may only be
+ * called from one thread and Read()/PeekRead()/ConsumeRead()/WaitReadable() from one other
+ * thread; neither side takes a lock. The consumer sleeps on a futex and is woken by the producer
+ * as soon as new data is committed.
+ *
+ * The storage is a memfd mapped twice back-to-back, so every readable or writable region is
+ * contiguous in virtual memory and the span APIs never have to split at the wrap-around point.
+ *
+ * When the ring is full the producer either drops the incoming block (DROP_NEWEST) or evicts the
+ * oldest unread bytes in multiples of evictAlign (OVERWRITE_OLDEST). Under OVERWRITE_OLDEST a
+ * consumer holding a PeekRead() span may find it evicted; ConsumeRead() then returns
+ * ERR_DH_AUDIO_BAD_OPERATE and the span must be discarded.
+ */
+class DaudioSpscRingBuffer {
+public:
+    DaudioSpscRingBuffer() = default;
+    ~DaudioSpscRingBuffer();
+    int32_t Init(uint32_t capacity);
+    void Release();
+    int32_t Write(const uint8_t *data, uint32_t len);
+    int32_t Read(uint8_t *data, uint32_t len);
+    int32_t AcquireWrite(uint32_t len, uint8_t *&data);
+    int32_t CommitWrite(uint32_t len);
+    int32_t PeekRead(uint32_t len, const uint8_t *&data);
+    int32_t ConsumeRead(uint32_t len);
+    int32_t WaitReadable(uint32_t len, int64_t timeoutNs);
+    void Wakeup();
+    uint32_t ReadableSize() const;
+    uint32_t WritableSize() const;
+    uint32_t Capacity() const;
+    void SetOverflowPolicy(DaudioRingOverflowPolicy policy, uint32_t evictAlign);
+    DaudioRingStats GetStats() const;
+    static uint32_t CalcCapacity(uint32_t bytesPerMs, uint32_t latencyMs, uint32_t minCapacity);
+
+private:
+    int32_t MapMirrored(uint32_t capacity);
+    void NotifyConsumer();
+    void EvictOldest(uint64_t writePos, uint32_t len);
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+    static constexpr uint32_t READ_RETRY_TIMES = 3;
+    uint8_t *array_ = nullptr;
+    uint32_t capacity_ = 0;
+    DaudioRingOverflowPolicy policy_ = DaudioRingOverflowPolicy::DROP_NEWEST;
+    uint32_t evictAlign_ = 1;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> writePos_ = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> readPos_ = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> dataSeq_ = 0;
+    std::atomic<uint32_t> waiters_ = 0;
+    uint64_t peekPos_ = 0;
+    bool hasPeek_ = false;
+    std::atomic<uint64_t> overrunCount_ = 0;
+    std::atomic<uint64_t> overrunBytes_ = 0;
+    std::atomic<uint64_t> underrunCount_ = 0;
+    std::atomic<uint32_t> highWatermark_ = 0;
+};
 } // namespace DistributedHardware
 } // namespace OHOS
 #endif // OHOS_DAUDIO_RING_BUFFER_H
\ No newline at end of file
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DAUDIO_SEQLOCK_H
+#define OHOS_DAUDIO_SEQLOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "daudio_errorcode.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Versioned sequence lock over a 32-bit word, usable on memory shared with another process.
+ * Writers take the word from odd to even with a CAS, update the protected fields in place and
+ * release it to the next odd value; readers copy the fields and retry while the word is even or
+ * has changed under them. Readers never write the shared memory.
+ *
+ * Only the low SEQLOCK_SEQUENCE_MASK bits count; the top byte is never changed, so a shared layout
+ * can be stamped with a tag telling its users that the word is a seqlock (see Stamp()). Every
+ * party touching the word must use this protocol: a peer running a plain busy flag on the same
+ * word neither sees nor respects it. Both sides give up after SEQLOCK_MAX_SPIN attempts and
+ * return ERR_DH_AUDIO_BAD_OPERATE rather than stall when a peer dies holding the word.
+ *
+ * Protected fields must be accessed through SeqlockLoad()/SeqlockStore() inside the callbacks.
+ */
+class DaudioSeqlock {
+public:
+    static constexpr uint32_t SEQLOCK_MAX_SPIN = 1024;
+    static constexpr uint32_t SEQLOCK_SEQUENCE_MASK = 0x00FFFFFF;
+    static constexpr uint32_t SEQLOCK_TAG_MASK = ~SEQLOCK_SEQUENCE_MASK;
+
+    explicit DaudioSeqlock(uint32_t *word) : version_(reinterpret_cast<std::atomic<uint32_t> *>(word)) {}
+    ~DaudioSeqlock() = default;
+
+    template <typename Func>
+    int32_t Read(Func &&func) const
+    {
+        for (uint32_t spin = 0; spin < SEQLOCK_MAX_SPIN; spin++) {
+            uint32_t start = version_->load(std::memory_order_acquire);
+            if ((start & 1U) == 0) {
+                std::this_thread::yield();
+                continue;
+            }
+            func();
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (version_->load(std::memory_order_relaxed) == start) {
+                return DH_SUCCESS;
+            }
+        }
+        return ERR_DH_AUDIO_BAD_OPERATE;
+    }
+
+    template <typename Func>
+    int32_t Write(Func &&func)
+    {
+        for (uint32_t spin = 0; spin < SEQLOCK_MAX_SPIN; spin++) {
+            uint32_t current = version_->load(std::memory_order_relaxed);
+            if ((current & 1U) != 0 && version_->compare_exchange_weak(current, Advance(current, 1),
+                std::memory_order_acquire, std::memory_order_relaxed)) {
+                std::atomic_thread_fence(std::memory_order_release);
+                func();
+                version_->store(Advance(current, 2), std::memory_order_release);
+                return DH_SUCCESS;
+            }
+            std::this_thread::yield();
+        }
+        return ERR_DH_AUDIO_BAD_OPERATE;
+    }
+
+    /*
+     * Turns a free legacy 0-while-busy flag (1) into a free seqlock carrying tag in the top byte. A word
+     * already carrying tag is left as it is; a word held by a flag user is waited for, up to
+     * SEQLOCK_MAX_SPIN attempts, and any other value is never overwritten.
+     */
+    int32_t Stamp(const uint32_t tag)
+    {
+        const uint32_t legacyFree = 1;
+        for (uint32_t spin = 0; spin < SEQLOCK_MAX_SPIN; spin++) {
+            uint32_t current = version_->load(std::memory_order_acquire);
+            if ((current & SEQLOCK_TAG_MASK) == (tag & SEQLOCK_TAG_MASK)) {
+                return DH_SUCCESS;
+            }
+            uint32_t expected = legacyFree;
+            if (version_->compare_exchange_weak(expected, (tag & SEQLOCK_TAG_MASK) | legacyFree,
+                std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                return DH_SUCCESS;
+            }
+            std::this_thread::yield();
+        }
+        return ERR_DH_AUDIO_BAD_OPERATE;
+    }
+
+    uint32_t GetTag() const
+    {
+        return version_->load(std::memory_order_relaxed) & SEQLOCK_TAG_MASK;
+    }
+
+private:
+    static uint32_t Advance(const uint32_t word, const uint32_t step)
+    {
+        // The sequence space is even-sized, so wrapping keeps the free/busy parity.
+        return (word & SEQLOCK_TAG_MASK) | ((word + step) & SEQLOCK_SEQUENCE_MASK);
+    }
+
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Seqlock word must be a plain 32-bit word.");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Seqlock word must be lock-free.");
+
+    std::atomic<uint32_t> *version_ = nullptr;
+};
+
+/*
+ * The 0-while-busy, 1-while-free flag that shared layouts used before DaudioSeqlock. It is taken
+ * with a CAS from 1 to 0 and handed back as 1, so a peer still running the flag protocol keeps
+ * working; like DaudioSeqlock it gives up after SEQLOCK_MAX_SPIN attempts.
+ */
+class DaudioFlagLock {
+public:
+    static constexpr uint32_t FLAG_BUSY = 0;
+    static constexpr uint32_t FLAG_FREE = 1;
+
+    explicit DaudioFlagLock(uint32_t *word) : flag_(reinterpret_cast<std::atomic<uint32_t> *>(word)) {}
+    ~DaudioFlagLock() = default;
+
+    template <typename Func>
+    int32_t Access(Func &&func)
+    {
+        for (uint32_t spin = 0; spin < DaudioSeqlock::SEQLOCK_MAX_SPIN; spin++) {
+            uint32_t expected = FLAG_FREE;
+            if (flag_->compare_exchange_weak(expected, FLAG_BUSY, std::memory_order_acquire,
+                std::memory_order_relaxed)) {
+                func();
+                flag_->store(FLAG_FREE, std::memory_order_release);
+                return DH_SUCCESS;
+            }
+            std::this_thread::yield();
+        }
+        return ERR_DH_AUDIO_BAD_OPERATE;
+    }
+
+private:
+    std::atomic<uint32_t> *flag_ = nullptr;
+};
+
+template <typename T>
+inline T SeqlockLoad(const T &field)
+{
+    static_assert(std::atomic<T>::is_always_lock_free, "Seqlock field must be lock-free.");
+    return reinterpret_cast<const std::atomic<T> &>(field).load(std::memory_order_relaxed);
+}
+
+template <typename T>
+inline void SeqlockStore(T &field, const T value)
+{
+    static_assert(std::atomic<T>::is_always_lock_free, "Seqlock field must be lock-free.");
+    reinterpret_cast<std::atomic<T> &>(field).store(value, std::memory_order_relaxed);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DAUDIO_SEQLOCK_H
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DAUDIO_TIME_STRETCH_H
+#define OHOS_DAUDIO_TIME_STRETCH_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * WSOLA time-scale modification for 16-bit interleaved PCM. Push() appends decoded input, Pull()
+ * returns output played at rate times the input speed without changing pitch: above 1 the
+ * buffered input drains faster, below 1 it builds up.
+ *
+ * Output is produced in hops of half a window. Each hop cross-fades the natural continuation of
+ * the previous segment into the input segment near the nominal analysis position that matches it
+ * best by normalised cross-correlation, searched within STRETCH_SEEK_MS. At rate 1 the nominal
+ * position is the natural continuation, so no search runs and input passes through unchanged.
+ *
+ * Other sample formats are passed through as they are and SetRate() has no effect on them.
+ */
+class DaudioTimeStretch {
+public:
+    static constexpr uint32_t STRETCH_WINDOW_MS = 20;
+    static constexpr uint32_t STRETCH_SEEK_MS = 4;
+    static constexpr double STRETCH_MIN_RATE = 0.9;
+    static constexpr double STRETCH_MAX_RATE = 1.1;
+
+    DaudioTimeStretch() = default;
+    ~DaudioTimeStretch() = default;
+
+    int32_t Init(const uint32_t sampleRate, const uint32_t channels, const int32_t bitFormat);
+    void Reset();
+    void SetRate(const double rate);
+    double GetRate() const;
+    int32_t Push(const uint8_t *data, const size_t len);
+    size_t Pull(uint8_t *data, const size_t len);
+    size_t GetBufferedBytes() const;
+    uint64_t GetStretchedHops() const;
+
+private:
+    bool Step();
+    int64_t Seek(const int64_t natural, const int64_t nominal) const;
+    void TrimInput();
+    size_t InputFrames() const;
+
+private:
+    bool enabled_ = false;
+    uint32_t channels_ = 1;
+    size_t frameBytes_ = 1;
+    // Lengths and positions below are in frames, positions relative to the start of in_.
+    int64_t hop_ = 0;
+    int64_t seek_ = 0;
+    std::vector<float> fadeIn_;
+    std::vector<uint8_t> in_;
+    std::vector<uint8_t> out_;
+    size_t outOffset_ = 0;
+    int64_t prevStart_ = 0;
+    double analysisPos_ = 0;
+    double rate_ = 1.0;
+    uint64_t stretchedHops_ = 0;
+};
+
+/*
+ * Chooses the time-stretch rate that steers the buffered playout delay toward a target. The
+ * measured delay is smoothed first; inside a small deadband the rate is 1, outside it the rate
+ * deviates from 1 in proportion to the error, by at most PLAYOUT_MAX_RATE_DEVIATION.
+ */
+class DaudioPlayoutController {
+public:
+    static constexpr uint32_t PLAYOUT_DEFAULT_TARGET_MS = 80;
+    static constexpr uint32_t PLAYOUT_DEADBAND_MS = 10;
+    static constexpr double PLAYOUT_GAIN_PER_MS = 0.001;
+    static constexpr double PLAYOUT_MAX_RATE_DEVIATION = 0.05;
+
+    DaudioPlayoutController() = default;
+    ~DaudioPlayoutController() = default;
+
+    void Reset(const uint32_t targetMs);
+    double Update(const uint32_t bufferedMs);
+    uint32_t GetTargetMs() const;
+    uint32_t GetBufferedMs() const;
+
+private:
+    std::atomic<uint32_t> targetMs_ = PLAYOUT_DEFAULT_TARGET_MS;
+    std::atomic<uint32_t> bufferedMs_ = 0;
+    double smoothedMs_ = 0;
+    bool isFirstUpdate_ = true;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DAUDIO_TIME_STRETCH_H
@@ -16,6 +16,7 @@
 #ifndef OHOS_DAUDIO_UTIL_H
 #define OHOS_DAUDIO_UTIL_H
 
+#include <atomic>
 #include <chrono>
 #include <fstream>
 #include <map>
@@ -43,11 +44,14 @@ bool IsString(const cJSON *jsonObj, const std::string &key);
 bool IsInt32(const cJSON *jsonObj, const std::string &key);
 bool IsAudioParam(const cJSON *jsonObj, const std::string &key);
 int32_t CalculateSampleNum(uint32_t sampleRate, uint32_t timems);
+uint32_t GetBytesPerSample(int32_t bitFormat);
 int64_t GetCurNano();
 int32_t AbsoluteSleep(int64_t nanoTime);
 int64_t CalculateOffset(const int64_t frameIndex, const int64_t framePeriodNs, const int64_t startTime);
 int64_t UpdateTimeOffset(const int64_t frameIndex, const int64_t framePeriodNs, int64_t &startTime);
 void GetCurrentTime(int64_t &tvSec, int64_t &tvNSec);
+int32_t FutexWait(std::atomic<uint32_t> &word, uint32_t expected, int64_t timeoutNs);
+void FutexWake(std::atomic<uint32_t> &word, int32_t count);
 bool CheckIsNum(const std::string &jsonString);
 bool CheckDevIdIsLegal(const std::string &devId);
 bool IsOutDurationRange(int64_t startTime, int64_t endTime, int64_t lastStartTime);
@@ -0,0 +1,516 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_aec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <securec.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "audio_param.h"
+#include "daudio_errorcode.h"
+#include "daudio_log.h"
+#include "daudio_util.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DaudioAec"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr float PCM_S16_SCALE = 1.0f / 32768.0f;
+constexpr float PCM_S16_MAX = 32767.0f;
+constexpr float PCM_S16_MIN = -32768.0f;
+constexpr uint32_t MIN_BLOCK_FRAMES = 16;
+constexpr uint32_t KERNEL_ALIGN = 8;
+constexpr uint32_t DECIM_HALF_ZEROS = 4;
+constexpr double DECIM_CUTOFF = 0.45;
+constexpr float AEC_STEP = 0.5f;
+constexpr float POWER_SMOOTHING = 0.1f;
+// Per-sample power of a -70 dBFS reference, below which the step stops growing.
+constexpr float POWER_FLOOR = 1e-7f;
+constexpr float DIVERGENCE_RATIO = 4.0f;
+constexpr float ENERGY_FLOOR = 1e-9f;
+
+using SpectrumKernel = void (*)(float *accRe, float *accIm, const float *aRe, const float *aIm, const float *bRe,
+    const float *bIm, size_t num);
+
+// acc += a * b over split complex arrays.
+void ComplexMacScalar(float *accRe, float *accIm, const float *aRe, const float *aIm, const float *bRe,
+    const float *bIm, size_t num)
+{
+    for (size_t i = 0; i < num; i++) {
+        accRe[i] += aRe[i] * bRe[i] - aIm[i] * bIm[i];
+        accIm[i] += aRe[i] * bIm[i] + aIm[i] * bRe[i];
+    }
+}
+
+// acc += a * conj(b) over split complex arrays.
+void ConjMacScalar(float *accRe, float *accIm, const float *aRe, const float *aIm, const float *bRe,
+    const float *bIm, size_t num)
+{
+    for (size_t i = 0; i < num; i++) {
+        accRe[i] += aRe[i] * bRe[i] + aIm[i] * bIm[i];
+        accIm[i] += aIm[i] * bRe[i] - aRe[i] * bIm[i];
+    }
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+constexpr size_t NEON_LANES = 4;
+
+void ComplexMacNeon(float *accRe, float *accIm, const float *aRe, const float *aIm, const float *bRe,
+    const float *bIm, size_t num)
+{
+    size_t i = 0;
+    for (; i + NEON_LANES <= num; i += NEON_LANES) {
+        float32x4_t ar = vld1q_f32(aRe + i);
+        float32x4_t ai = vld1q_f32(aIm + i);
+        float32x4_t br = vld1q_f32(bRe + i);
+        float32x4_t bi = vld1q_f32(bIm + i);
+        float32x4_t re = vmlsq_f32(vmlaq_f32(vld1q_f32(accRe + i), ar, br), ai, bi);
+        float32x4_t im = vmlaq_f32(vmlaq_f32(vld1q_f32(accIm + i), ar, bi), ai, br);
+        vst1q_f32(accRe + i, re);
+        vst1q_f32(accIm + i, im);
+    }
+    ComplexMacScalar(accRe + i, accIm + i, aRe + i, aIm + i, bRe + i, bIm + i, num - i);
+}
+
+void ConjMacNeon(float *accRe, float *accIm, const float *aRe, const float *aIm, const float *bRe,
+    const float *bIm, size_t num)
+{
+    size_t i = 0;
+    for (; i + NEON_LANES <= num; i += NEON_LANES) {
+        float32x4_t ar = vld1q_f32(aRe + i);
+        float32x4_t ai = vld1q_f32(aIm + i);
+        float32x4_t br = vld1q_f32(bRe + i);
+        float32x4_t bi = vld1q_f32(bIm + i);
+        float32x4_t re = vmlaq_f32(vmlaq_f32(vld1q_f32(accRe + i), ar, br), ai, bi);
+        float32x4_t im = vmlsq_f32(vmlaq_f32(vld1q_f32(accIm + i), ai, br), ar, bi);
+        vst1q_f32(accRe + i, re);
+        vst1q_f32(accIm + i, im);
+    }
+    ConjMacScalar(accRe + i, accIm + i, aRe + i, aIm + i, bRe + i, bIm + i, num - i);
+}
+#endif
+
+#if defined(__SSE2__)
+constexpr size_t SSE_LANES = 4;
+
+void ComplexMacSse2(float *accRe, float *accIm, const float *aRe, const float *aIm, const float *bRe,
+    const float *bIm, size_t num)
+{
+    size_t i = 0;
+    for (; i + SSE_LANES <= num; i += SSE_LANES) {
+        __m128 ar = _mm_loadu_ps(aRe + i);
+        __m128 ai = _mm_loadu_ps(aIm + i);
+        __m128 br = _mm_loadu_ps(bRe + i);
+        __m128 bi = _mm_loadu_ps(bIm + i);
+        __m128 re = _mm_add_ps(_mm_loadu_ps(accRe + i), _mm_sub_ps(_mm_mul_ps(ar, br), _mm_mul_ps(ai, bi)));
+        __m128 im = _mm_add_ps(_mm_loadu_ps(accIm + i), _mm_add_ps(_mm_mul_ps(ar, bi), _mm_mul_ps(ai, br)));
+        _mm_storeu_ps(accRe + i, re);
+        _mm_storeu_ps(accIm + i, im);
+    }
+    ComplexMacScalar(accRe + i, accIm + i, aRe + i, aIm + i, bRe + i, bIm + i, num - i);
+}
+
+void ConjMacSse2(float *accRe, float *accIm, const float *aRe, const float *aIm, const float *bRe,
+    const float *bIm, size_t num)
+{
+    size_t i = 0;
+    for (; i + SSE_LANES <= num; i += SSE_LANES) {
+        __m128 ar = _mm_loadu_ps(aRe + i);
+        __m128 ai = _mm_loadu_ps(aIm + i);
+        __m128 br = _mm_loadu_ps(bRe + i);
+        __m128 bi = _mm_loadu_ps(bIm + i);
+        __m128 re = _mm_add_ps(_mm_loadu_ps(accRe + i), _mm_add_ps(_mm_mul_ps(ar, br), _mm_mul_ps(ai, bi)));
+        __m128 im = _mm_add_ps(_mm_loadu_ps(accIm + i), _mm_sub_ps(_mm_mul_ps(ai, br), _mm_mul_ps(ar, bi)));
+        _mm_storeu_ps(accRe + i, re);
+        _mm_storeu_ps(accIm + i, im);
+    }
+    ConjMacScalar(accRe + i, accIm + i, aRe + i, aIm + i, bRe + i, bIm + i, num - i);
+}
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+constexpr size_t AVX_LANES = 8;
+
+__attribute__((target("avx2,fma"))) void ComplexMacAvx2(float *accRe, float *accIm, const float *aRe,
+    const float *aIm, const float *bRe, const float *bIm, size_t num)
+{
+    size_t i = 0;
+    for (; i + AVX_LANES <= num; i += AVX_LANES) {
+        __m256 ar = _mm256_loadu_ps(aRe + i);
+        __m256 ai = _mm256_loadu_ps(aIm + i);
+        __m256 br = _mm256_loadu_ps(bRe + i);
+        __m256 bi = _mm256_loadu_ps(bIm + i);
+        __m256 re = _mm256_fnmadd_ps(ai, bi, _mm256_fmadd_ps(ar, br, _mm256_loadu_ps(accRe + i)));
+        __m256 im = _mm256_fmadd_ps(ai, br, _mm256_fmadd_ps(ar, bi, _mm256_loadu_ps(accIm + i)));
+        _mm256_storeu_ps(accRe + i, re);
+        _mm256_storeu_ps(accIm + i, im);
+    }
+    ComplexMacScalar(accRe + i, accIm + i, aRe + i, aIm + i, bRe + i, bIm + i, num - i);
+}
+
+__attribute__((target("avx2,fma"))) void ConjMacAvx2(float *accRe, float *accIm, const float *aRe,
+    const float *aIm, const float *bRe, const float *bIm, size_t num)
+{
+    size_t i = 0;
+    for (; i + AVX_LANES <= num; i += AVX_LANES) {
+        __m256 ar = _mm256_loadu_ps(aRe + i);
+        __m256 ai = _mm256_loadu_ps(aIm + i);
+        __m256 br = _mm256_loadu_ps(bRe + i);
+        __m256 bi = _mm256_loadu_ps(bIm + i);
+        __m256 re = _mm256_fmadd_ps(ai, bi, _mm256_fmadd_ps(ar, br, _mm256_loadu_ps(accRe + i)));
+        __m256 im = _mm256_fnmadd_ps(ar, bi, _mm256_fmadd_ps(ai, br, _mm256_loadu_ps(accIm + i)));
+        _mm256_storeu_ps(accRe + i, re);
+        _mm256_storeu_ps(accIm + i, im);
+    }
+    ConjMacScalar(accRe + i, accIm + i, aRe + i, aIm + i, bRe + i, bIm + i, num - i);
+}
+#endif
+
+struct AecKernels {
+    SpectrumKernel complexMac = ComplexMacScalar;
+    SpectrumKernel conjMac = ConjMacScalar;
+    const char *name = "scalar";
+};
+
+const AecKernels &GetAecKernels()
+{
+    static const AecKernels kernels = [] {
+        AecKernels selected;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        selected = { ComplexMacNeon, ConjMacNeon, "neon" };
+#elif defined(__SSE2__)
+        selected = { ComplexMacSse2, ConjMacSse2, "sse2" };
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            selected = { ComplexMacAvx2, ConjMacAvx2, "avx2" };
+        }
+#endif
+        return selected;
+    }();
+    return kernels;
+}
+
+inline int16_t ToPcmS16(const float value)
+{
+    return static_cast<int16_t>(std::lrint(std::clamp(value / PCM_S16_SCALE, PCM_S16_MIN, PCM_S16_MAX)));
+}
+}
+
+int32_t DaudioAec::Init(const uint32_t refSampleRate, const uint32_t refChannels, const uint32_t micSampleRate,
+    const uint32_t micChannels, const int32_t bitFormat)
+{
+    enabled_ = false;
+    if (bitFormat != SAMPLE_S16LE || refChannels == 0 || micChannels == 0 || micSampleRate == 0 ||
+        refSampleRate % micSampleRate != 0 || refSampleRate / micSampleRate == 0 ||
+        refSampleRate / micSampleRate > AEC_MAX_RATE_RATIO) {
+        DHLOGE("Aec not supported, ref: %{public}u/%{public}u, mic: %{public}u/%{public}u, bitFormat: %{public}d.",
+            refSampleRate, refChannels, micSampleRate, micChannels, bitFormat);
+        return ERR_DH_AUDIO_NOT_SUPPORT;
+    }
+    refChannels_ = refChannels;
+    micChannels_ = micChannels;
+    rateRatio_ = refSampleRate / micSampleRate;
+    blockFrames_ = MIN_BLOCK_FRAMES;
+    while (blockFrames_ * 2 <= micSampleRate * AEC_BLOCK_MS / AUDIO_MS_PER_SECOND) {
+        blockFrames_ *= 2;
+    }
+    int32_t ret = fft_.Init(2 * blockFrames_);
+    if (ret != DH_SUCCESS) {
+        return ret;
+    }
+    fftBuf_.assign(2 * blockFrames_, 0.0f);
+    bins_ = blockFrames_ + 1;
+    stride_ = (bins_ + KERNEL_ALIGN - 1) / KERNEL_ALIGN * KERNEL_ALIGN;
+    uint32_t filterFrames = micSampleRate * AEC_FILTER_MS / AUDIO_MS_PER_SECOND;
+    partitions_ = std::max<uint32_t>(1, (filterFrames + blockFrames_ - 1) / blockFrames_);
+
+    decimTaps_.clear();
+    if (rateRatio_ > 1) {
+        // Hann-windowed sinc low-pass at DECIM_CUTOFF of the mic rate, normalised to unity gain at DC.
+        int32_t half = static_cast<int32_t>(rateRatio_ * DECIM_HALF_ZEROS);
+        double sum = 0;
+        std::vector<double> taps;
+        for (int32_t k = -half; k <= half; k++) {
+            double x = 2.0 * DECIM_CUTOFF * k / rateRatio_;
+            double sinc = k == 0 ? 1.0 : std::sin(M_PI * x) / (M_PI * x);
+            double window = 0.5 + 0.5 * std::cos(M_PI * k / (half + 1));
+            taps.push_back(sinc * window);
+            sum += sinc * window;
+        }
+        for (double tap : taps) {
+            decimTaps_.push_back(static_cast<float>(tap / sum));
+        }
+    }
+    decimHistory_.assign(decimTaps_.size(), 0.0f);
+    refFifo_.assign(micSampleRate * AEC_MAX_REF_MS / AUDIO_MS_PER_SECOND + blockFrames_, 0.0f);
+    refTime_.assign(2 * blockFrames_, 0.0f);
+    xRe_.assign(partitions_ * stride_, 0.0f);
+    xIm_.assign(partitions_ * stride_, 0.0f);
+    power_.assign(stride_, 0.0f);
+    wRe_.assign(micChannels_ * partitions_ * stride_, 0.0f);
+    wIm_.assign(micChannels_ * partitions_ * stride_, 0.0f);
+    accRe_.assign(stride_, 0.0f);
+    accIm_.assign(stride_, 0.0f);
+    mic_.assign(blockFrames_, 0.0f);
+    err_.assign(blockFrames_, 0.0f);
+    enabled_ = true;
+    Reset();
+    DHLOGI("Aec init, block: %{public}u, partitions: %{public}u, ratio: %{public}u, kernel: %{public}s.",
+        blockFrames_, partitions_, rateRatio_, GetKernelName());
+    return DH_SUCCESS;
+}
+
+void DaudioAec::Reset()
+{
+    std::fill(decimHistory_.begin(), decimHistory_.end(), 0.0f);
+    decimPos_ = 0;
+    decimPhase_ = 0;
+    refHead_ = 0;
+    refCount_ = 0;
+    micPending_.clear();
+    outPending_.clear();
+    std::fill(refTime_.begin(), refTime_.end(), 0.0f);
+    std::fill(xRe_.begin(), xRe_.end(), 0.0f);
+    std::fill(xIm_.begin(), xIm_.end(), 0.0f);
+    xHead_ = 0;
+    std::fill(power_.begin(), power_.end(), 0.0f);
+    std::fill(wRe_.begin(), wRe_.end(), 0.0f);
+    std::fill(wIm_.begin(), wIm_.end(), 0.0f);
+    constrainNext_ = 0;
+}
+
+uint32_t DaudioAec::GetBlockFrames() const
+{
+    return blockFrames_;
+}
+
+const char *DaudioAec::GetKernelName()
+{
+    return GetAecKernels().name;
+}
+
+void DaudioAec::PushReference(const uint8_t *data, const size_t len)
+{
+    if (!enabled_ || data == nullptr) {
+        return;
+    }
+    const int16_t *samples = reinterpret_cast<const int16_t *>(data);
+    size_t frames = len / (sizeof(int16_t) * refChannels_);
+    for (size_t i = 0; i < frames; i++) {
+        float sum = 0;
+        for (uint32_t ch = 0; ch < refChannels_; ch++) {
+            sum += samples[i * refChannels_ + ch];
+        }
+        PushMonoReference(sum * PCM_S16_SCALE / refChannels_);
+    }
+}
+
+void DaudioAec::PushMonoReference(const float sample)
+{
+    float value = sample;
+    if (rateRatio_ > 1) {
+        size_t taps = decimHistory_.size();
+        decimHistory_[decimPos_] = sample;
+        decimPos_ = (decimPos_ + 1) % taps;
+        if (++decimPhase_ < rateRatio_) {
+            return;
+        }
+        decimPhase_ = 0;
+        value = 0;
+        for (size_t k = 0; k < taps; k++) {
+            value += decimTaps_[k] * decimHistory_[(decimPos_ + k) % taps];
+        }
+    }
+    size_t capacity = refFifo_.size();
+    if (refCount_ == capacity) {
+        refHead_ = (refHead_ + 1) % capacity;
+        refCount_--;
+    }
+    refFifo_[(refHead_ + refCount_) % capacity] = value;
+    refCount_++;
+}
+
+size_t DaudioAec::Process(const uint8_t *in, const size_t len, uint8_t *out, const size_t outLen)
+{
+    if (in == nullptr || out == nullptr) {
+        return 0;
+    }
+    size_t frameBytes = sizeof(int16_t) * micChannels_;
+    size_t bytes = len / frameBytes * frameBytes;
+    if (outLen < bytes) {
+        return 0;
+    }
+    if (!enabled_) {
+        if (bytes > 0 && memcpy_s(out, outLen, in, bytes) != EOK) {
+            return 0;
+        }
+        return bytes;
+    }
+    const int16_t *samples = reinterpret_cast<const int16_t *>(in);
+    size_t sampleNum = bytes / sizeof(int16_t);
+    micPending_.insert(micPending_.end(), samples, samples + sampleNum);
+    size_t blockSamples = static_cast<size_t>(blockFrames_) * micChannels_;
+    while (micPending_.size() >= blockSamples) {
+        ProcessBlock();
+        micPending_.erase(micPending_.begin(), micPending_.begin() + blockSamples);
+    }
+    // Until a whole block has been processed the output runs dry; the shortfall is made up with silence once.
+    if (outPending_.size() < sampleNum) {
+        outPending_.insert(outPending_.begin(), sampleNum - outPending_.size(), 0);
+    }
+    if (bytes > 0 && memcpy_s(out, outLen, outPending_.data(), bytes) != EOK) {
+        return 0;
+    }
+    outPending_.erase(outPending_.begin(), outPending_.begin() + sampleNum);
+    return bytes;
+}
+
+void DaudioAec::ProcessBlock()
+{
+    uint32_t block = blockFrames_;
+    bool hasRef = refCount_ >= block;
+    std::copy(refTime_.begin() + block, refTime_.end(), refTime_.begin());
+    size_t capacity = refFifo_.size();
+    for (uint32_t i = 0; i < block; i++) {
+        refTime_[block + i] = hasRef ? refFifo_[(refHead_ + i) % capacity] : 0.0f;
+    }
+    if (hasRef) {
+        refHead_ = (refHead_ + block) % capacity;
+        refCount_ -= block;
+    }
+    for (uint32_t i = 0; i < 2 * block; i++) {
+        fftBuf_[i] = refTime_[i];
+    }
+    fft_.Forward(fftBuf_.data());
+    xHead_ = (xHead_ + partitions_ - 1) % partitions_;
+    float *xRe = xRe_.data() + xHead_ * stride_;
+    float *xIm = xIm_.data() + xHead_ * stride_;
+    for (uint32_t k = 0; k < bins_; k++) {
+        xRe[k] = fftBuf_[k].real();
+        xIm[k] = fftBuf_[k].imag();
+        power_[k] = (1.0f - POWER_SMOOTHING) * power_[k] + POWER_SMOOTHING * std::norm(fftBuf_[k]);
+    }
+
+    size_t outBase = outPending_.size();
+    outPending_.resize(outBase + static_cast<size_t>(block) * micChannels_);
+    for (uint32_t ch = 0; ch < micChannels_; ch++) {
+        ProcessChannel(ch, hasRef, outBase);
+    }
+    Constrain(constrainNext_);
+    constrainNext_ = (constrainNext_ + 1) % partitions_;
+}
+
+void DaudioAec::ProcessChannel(const uint32_t channel, bool adapt, const size_t outBase)
+{
+    const AecKernels &kernels = GetAecKernels();
+    uint32_t block = blockFrames_;
+    float *wRe = wRe_.data() + static_cast<size_t>(channel) * partitions_ * stride_;
+    float *wIm = wIm_.data() + static_cast<size_t>(channel) * partitions_ * stride_;
+    std::fill(accRe_.begin(), accRe_.end(), 0.0f);
+    std::fill(accIm_.begin(), accIm_.end(), 0.0f);
+    for (uint32_t p = 0; p < partitions_; p++) {
+        size_t slot = static_cast<size_t>((xHead_ + p) % partitions_) * stride_;
+        kernels.complexMac(accRe_.data(), accIm_.data(), wRe + p * stride_, wIm + p * stride_, xRe_.data() + slot,
+            xIm_.data() + slot, stride_);
+    }
+    LoadSpectrum(accRe_.data(), accIm_.data());
+    fft_.Inverse(fftBuf_.data());
+
+    float micEnergy = 0;
+    float errEnergy = 0;
+    for (uint32_t i = 0; i < block; i++) {
+        mic_[i] = micPending_[static_cast<size_t>(i) * micChannels_ + channel] * PCM_S16_SCALE;
+        err_[i] = mic_[i] - fftBuf_[block + i].real();
+        micEnergy += mic_[i] * mic_[i];
+        errEnergy += err_[i] * err_[i];
+    }
+    if (errEnergy > DIVERGENCE_RATIO * micEnergy + ENERGY_FLOOR) {
+        DHLOGW("Aec filter diverged on channel %{public}u, reset it.", channel);
+        std::fill(wRe, wRe + partitions_ * stride_, 0.0f);
+        std::fill(wIm, wIm + partitions_ * stride_, 0.0f);
+        std::copy(mic_.begin(), mic_.end(), err_.begin());
+        adapt = false;
+    }
+    for (uint32_t i = 0; i < block; i++) {
+        outPending_[outBase + static_cast<size_t>(i) * micChannels_ + channel] = ToPcmS16(err_[i]);
+    }
+    if (!adapt) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < block; i++) {
+        fftBuf_[i] = 0.0f;
+        fftBuf_[block + i] = err_[i];
+    }
+    fft_.Forward(fftBuf_.data());
+    float floor = POWER_FLOOR * 2 * block;
+    for (uint32_t k = 0; k < bins_; k++) {
+        float scale = AEC_STEP / (partitions_ * power_[k] + floor);
+        accRe_[k] = fftBuf_[k].real() * scale;
+        accIm_[k] = fftBuf_[k].imag() * scale;
+    }
+    std::fill(accRe_.begin() + bins_, accRe_.end(), 0.0f);
+    std::fill(accIm_.begin() + bins_, accIm_.end(), 0.0f);
+    for (uint32_t p = 0; p < partitions_; p++) {
+        size_t slot = static_cast<size_t>((xHead_ + p) % partitions_) * stride_;
+        kernels.conjMac(wRe + p * stride_, wIm + p * stride_, accRe_.data(), accIm_.data(), xRe_.data() + slot,
+            xIm_.data() + slot, stride_);
+    }
+}
+
+void DaudioAec::Constrain(const uint32_t partition)
+{
+    uint32_t block = blockFrames_;
+    for (uint32_t ch = 0; ch < micChannels_; ch++) {
+        size_t offset = (static_cast<size_t>(ch) * partitions_ + partition) * stride_;
+        float *wRe = wRe_.data() + offset;
+        float *wIm = wIm_.data() + offset;
+        LoadSpectrum(wRe, wIm);
+        fft_.Inverse(fftBuf_.data());
+        for (uint32_t i = 0; i < 2 * block; i++) {
+            fftBuf_[i] = i < block ? fftBuf_[i].real() : 0.0f;
+        }
+        fft_.Forward(fftBuf_.data());
+        for (uint32_t k = 0; k < bins_; k++) {
+            wRe[k] = fftBuf_[k].real();
+            wIm[k] = fftBuf_[k].imag();
+        }
+    }
+}
+
+void DaudioAec::LoadSpectrum(const float *re, const float *im)
+{
+    uint32_t size = 2 * blockFrames_;
+    for (uint32_t k = 0; k < bins_; k++) {
+        fftBuf_[k] = std::complex<float>(re[k], im[k]);
+    }
+    for (uint32_t k = bins_; k < size; k++) {
+        fftBuf_[k] = std::conj(fftBuf_[size - k]);
+    }
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_asrc.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <securec.h>
+
+#include "audio_param.h"
+#include "daudio_errorcode.h"
+#include "daudio_log.h"
+#include "daudio_util.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DaudioAsrc"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr double PPM_PER_UNIT = 1000000.0;
+constexpr uint32_t FRAC_BITS = 32;
+constexpr uint64_t FRAC_MASK = (1ULL << FRAC_BITS) - 1;
+constexpr double FRAC_ONE = static_cast<double>(1ULL << FRAC_BITS);
+constexpr double BLACKMAN_A0 = 0.42;
+constexpr double BLACKMAN_A1 = 0.5;
+constexpr double BLACKMAN_A2 = 0.08;
+constexpr double INTEGER_EPSILON = 1e-9;
+constexpr int64_t NS_PER_MS = AUDIO_NS_PER_SECOND / AUDIO_MS_PER_SECOND;
+constexpr int64_t DRIFT_BLOCK_NS = DaudioDriftEstimator::DRIFT_BLOCK_MS * NS_PER_MS;
+constexpr int64_t DRIFT_GAP_NS = DaudioDriftEstimator::DRIFT_GAP_MS * NS_PER_MS;
+
+/*
+ * Row p holds the taps for an output frame p / ASRC_PHASES of a frame past the centre tap, so row
+ * 0 is a unit impulse and row ASRC_PHASES is row 0 shifted by one tap. Each row is normalised to
+ * unity gain at DC.
+ */
+const std::vector<float> &GetAsrcTable()
+{
+    static const std::vector<float> table = [] {
+        constexpr int32_t taps = static_cast<int32_t>(DaudioAsrc::ASRC_TAPS);
+        constexpr double half = static_cast<double>(DaudioAsrc::ASRC_HALF_TAPS);
+        std::vector<float> rows((DaudioAsrc::ASRC_PHASES + 1) * DaudioAsrc::ASRC_TAPS);
+        for (uint32_t p = 0; p <= DaudioAsrc::ASRC_PHASES; p++) {
+            double frac = static_cast<double>(p) / DaudioAsrc::ASRC_PHASES;
+            std::array<double, DaudioAsrc::ASRC_TAPS> row {};
+            double sum = 0;
+            for (int32_t k = 0; k < taps; k++) {
+                double x = k - (half - 1) - frac;
+                double sinc = 0;
+                if (std::fabs(x - std::round(x)) < INTEGER_EPSILON) {
+                    sinc = std::round(x) == 0 ? 1.0 : 0.0;
+                } else {
+                    sinc = std::sin(M_PI * x) / (M_PI * x);
+                }
+                double window = BLACKMAN_A0 + BLACKMAN_A1 * std::cos(M_PI * x / half) +
+                    BLACKMAN_A2 * std::cos(2 * M_PI * x / half);
+                row[k] = sinc * window;
+                sum += row[k];
+            }
+            for (int32_t k = 0; k < taps; k++) {
+                rows[p * DaudioAsrc::ASRC_TAPS + k] = static_cast<float>(row[k] / sum);
+            }
+        }
+        return rows;
+    }();
+    return table;
+}
+}
+
+void DaudioDriftEstimator::Reset(const uint32_t sampleRate)
+{
+    producer_.Reset(sampleRate);
+    consumer_.Reset(sampleRate);
+}
+
+void DaudioDriftEstimator::OnProduced(const uint64_t frames, const int64_t nowNs)
+{
+    producer_.OnFrames(frames, nowNs);
+}
+
+void DaudioDriftEstimator::OnConsumed(const uint64_t frames, const int64_t nowNs)
+{
+    consumer_.OnFrames(frames, nowNs);
+}
+
+double DaudioDriftEstimator::GetDriftPpm() const
+{
+    double producerPpm = 0;
+    double consumerPpm = 0;
+    if (!producer_.GetSkewPpm(producerPpm) || !consumer_.GetSkewPpm(consumerPpm)) {
+        return 0;
+    }
+    return std::clamp(producerPpm - consumerPpm, -DRIFT_MAX_PPM, DRIFT_MAX_PPM);
+}
+
+double DaudioDriftEstimator::GetRatio() const
+{
+    return 1.0 + GetDriftPpm() / PPM_PER_UNIT;
+}
+
+void DaudioDriftEstimator::ClockTrack::Reset(const uint32_t sampleRate)
+{
+    isValid_.store(false);
+    skewPpm_.store(0);
+    sampleRate_ = sampleRate;
+    frames_ = 0;
+    originNs_ = -1;
+    isBlockEmpty_ = true;
+    blockHead_ = 0;
+    blockNum_ = 0;
+}
+
+void DaudioDriftEstimator::ClockTrack::OnFrames(const uint64_t frames, const int64_t nowNs)
+{
+    if (sampleRate_ == 0) {
+        return;
+    }
+    if (originNs_ < 0 || nowNs - lastNs_ > DRIFT_GAP_NS) {
+        frames_ = 0;
+        originNs_ = nowNs;
+        blockEndNs_ = nowNs + DRIFT_BLOCK_NS;
+        isBlockEmpty_ = true;
+        blockHead_ = 0;
+        blockNum_ = 0;
+    }
+    lastNs_ = nowNs;
+    frames_ += frames;
+    double timeNs = static_cast<double>(nowNs - originNs_);
+    double lagNs = timeNs - static_cast<double>(frames_) * AUDIO_NS_PER_SECOND / sampleRate_;
+    if (isBlockEmpty_ || lagNs < blockMinNs_) {
+        blockMinNs_ = lagNs;
+        isBlockEmpty_ = false;
+    }
+    if (nowNs < blockEndNs_) {
+        return;
+    }
+    blocks_[(blockHead_ + blockNum_) % DRIFT_WINDOW_BLOCKS] = { timeNs, blockMinNs_ };
+    if (blockNum_ < DRIFT_WINDOW_BLOCKS) {
+        blockNum_++;
+    } else {
+        blockHead_ = (blockHead_ + 1) % DRIFT_WINDOW_BLOCKS;
+    }
+    isBlockEmpty_ = true;
+    while (blockEndNs_ <= nowNs) {
+        blockEndNs_ += DRIFT_BLOCK_NS;
+    }
+    Estimate();
+}
+
+void DaudioDriftEstimator::ClockTrack::Estimate()
+{
+    if (blockNum_ < DRIFT_MIN_BLOCKS) {
+        return;
+    }
+    double meanX = 0;
+    double meanY = 0;
+    for (uint32_t i = 0; i < blockNum_; i++) {
+        const Block &block = blocks_[(blockHead_ + i) % DRIFT_WINDOW_BLOCKS];
+        meanX += block.timeNs;
+        meanY += block.lagNs;
+    }
+    meanX /= blockNum_;
+    meanY /= blockNum_;
+    double sxy = 0;
+    double sxx = 0;
+    for (uint32_t i = 0; i < blockNum_; i++) {
+        const Block &block = blocks_[(blockHead_ + i) % DRIFT_WINDOW_BLOCKS];
+        double dx = block.timeNs - meanX;
+        sxy += dx * (block.lagNs - meanY);
+        sxx += dx * dx;
+    }
+    if (sxx <= 0) {
+        return;
+    }
+    // A side running fast delivers its frames early, so its lag shrinks over time.
+    skewPpm_.store(-sxy / sxx * PPM_PER_UNIT, std::memory_order_relaxed);
+    isValid_.store(true, std::memory_order_release);
+}
+
+bool DaudioDriftEstimator::ClockTrack::GetSkewPpm(double &skewPpm) const
+{
+    if (!isValid_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    skewPpm = skewPpm_.load(std::memory_order_relaxed);
+    return true;
+}
+
+int32_t DaudioAsrc::Init(const uint32_t channels, const int32_t bitFormat)
+{
+    enabled_ = false;
+    channels_ = 1;
+    frameBytes_ = 1;
+    if (channels == 0 || bitFormat != SAMPLE_S16LE) {
+        DHLOGE("Asrc not supported, channels: %{public}u, bitFormat: %{public}d.", channels, bitFormat);
+        Reset();
+        return ERR_DH_AUDIO_NOT_SUPPORT;
+    }
+    channels_ = channels;
+    frameBytes_ = sizeof(int16_t) * channels;
+    (void)GetAsrcTable();
+    enabled_ = true;
+    Reset();
+    return DH_SUCCESS;
+}
+
+void DaudioAsrc::Reset()
+{
+    engaged_ = false;
+    ratio_ = 1.0;
+    step_ = 1ULL << FRAC_BITS;
+    // The filter starts on silent history, centred on the first frame that will be pushed.
+    history_.assign((ASRC_TAPS - 1) * channels_, 0.0f);
+    pos_ = static_cast<uint64_t>(ASRC_HALF_TAPS) << FRAC_BITS;
+}
+
+void DaudioAsrc::SetRatio(const double ratio)
+{
+    if (!enabled_) {
+        return;
+    }
+    double newRatio = std::clamp(ratio, 1.0 - ASRC_MAX_RATIO_DEVIATION, 1.0 + ASRC_MAX_RATIO_DEVIATION);
+    if (newRatio == ratio_) {
+        return;
+    }
+    if (!engaged_) {
+        DHLOGI("Asrc engaged, ratio: %{public}.6f.", newRatio);
+        engaged_ = true;
+    }
+    ratio_ = newRatio;
+    step_ = static_cast<uint64_t>(std::llround(ratio_ * FRAC_ONE));
+}
+
+double DaudioAsrc::GetRatio() const
+{
+    return ratio_;
+}
+
+bool DaudioAsrc::IsEngaged() const
+{
+    return engaged_;
+}
+
+size_t DaudioAsrc::GetMaxOutputBytes(const size_t len) const
+{
+    // The bound holds before the converter engages too, so buffers can be sized once for the stream.
+    if (!enabled_) {
+        return len;
+    }
+    // At the lowest ratio every input frame yields a little more than one output frame.
+    size_t frames = len / frameBytes_;
+    return (frames + frames / ASRC_PHASES + ASRC_TAPS) * frameBytes_;
+}
+
+size_t DaudioAsrc::Process(const uint8_t *in, const size_t len, uint8_t *out, const size_t outLen)
+{
+    if (in == nullptr || out == nullptr || len % frameBytes_ != 0) {
+        return 0;
+    }
+    if (!engaged_) {
+        if (len > outLen || memcpy_s(out, outLen, in, len) != EOK) {
+            DHLOGE("Copy asrc bypass data failed, len: %{public}zu, out len: %{public}zu.", len, outLen);
+            return 0;
+        }
+        return len;
+    }
+    const int16_t *src = reinterpret_cast<const int16_t *>(in);
+    history_.insert(history_.end(), src, src + len / sizeof(int16_t));
+    const std::vector<float> &table = GetAsrcTable();
+    uint64_t frames = history_.size() / channels_;
+    int16_t *dst = reinterpret_cast<int16_t *>(out);
+    size_t outFrames = 0;
+    size_t maxOutFrames = outLen / frameBytes_;
+    while ((pos_ >> FRAC_BITS) + ASRC_TAPS <= frames && outFrames < maxOutFrames) {
+        uint64_t base = pos_ >> FRAC_BITS;
+        uint64_t phase = (pos_ & FRAC_MASK) * ASRC_PHASES;
+        uint64_t row = phase >> FRAC_BITS;
+        float mu = static_cast<float>(static_cast<double>(phase & FRAC_MASK) / FRAC_ONE);
+        const float *c0 = &table[row * ASRC_TAPS];
+        const float *c1 = c0 + ASRC_TAPS;
+        for (uint32_t k = 0; k < ASRC_TAPS; k++) {
+            coefs_[k] = c0[k] + mu * (c1[k] - c0[k]);
+        }
+        for (uint32_t c = 0; c < channels_; c++) {
+            const float *x = &history_[base * channels_ + c];
+            float acc = 0;
+            for (uint32_t k = 0; k < ASRC_TAPS; k++) {
+                acc += coefs_[k] * x[k * channels_];
+            }
+            dst[outFrames * channels_ + c] = static_cast<int16_t>(std::clamp(std::lrint(acc),
+                static_cast<long>(std::numeric_limits<int16_t>::min()),
+                static_cast<long>(std::numeric_limits<int16_t>::max())));
+        }
+        outFrames++;
+        pos_ += step_;
+    }
+    uint64_t consumed = std::min(pos_ >> FRAC_BITS, frames);
+    history_.erase(history_.begin(), history_.begin() + static_cast<std::ptrdiff_t>(consumed * channels_));
+    pos_ -= consumed << FRAC_BITS;
+    return outFrames * frameBytes_;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
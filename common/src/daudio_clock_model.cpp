@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_clock_model.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+
+#include "daudio_log.h"
+#include "daudio_util.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DaudioClockModel"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr double PPM_PER_UNIT = 1000000.0;
+constexpr double CLOCK_OUTLIER_NS = static_cast<double>(DaudioClockModel::CLOCK_OUTLIER_MS) *
+    AUDIO_NS_PER_SECOND / AUDIO_MS_PER_SECOND;
+}
+
+void DaudioClockModel::Reset(const uint32_t sampleRate)
+{
+    sampleRate_ = sampleRate;
+    nominalNsPerFrame_ = sampleRate == 0 ? 0 : static_cast<double>(AUDIO_NS_PER_SECOND) / sampleRate;
+    nsPerFrame_ = nominalNsPerFrame_;
+    originFrame_ = 0;
+    originNs_ = 0;
+    lastFrame_ = 0;
+    sampleHead_ = 0;
+    sampleNum_ = 0;
+    outlierNum_ = 0;
+    meanFrames_ = 0;
+    meanTimeNs_ = 0;
+}
+
+void DaudioClockModel::AddSample(const uint64_t framePosition, const int64_t timeNs)
+{
+    if (sampleRate_ == 0 || timeNs <= 0) {
+        return;
+    }
+    if (sampleNum_ == 0 || framePosition < lastFrame_) {
+        Restart(framePosition, timeNs);
+        return;
+    }
+    if (framePosition == lastFrame_) {
+        return;
+    }
+    double frames = static_cast<double>(framePosition - originFrame_);
+    double relTimeNs = static_cast<double>(timeNs - originNs_);
+    if (sampleNum_ >= CLOCK_MIN_SAMPLES && std::fabs(relTimeNs - Evaluate(frames)) > CLOCK_OUTLIER_NS) {
+        if (++outlierNum_ < CLOCK_MAX_OUTLIERS) {
+            return;
+        }
+        DHLOGI("Capture clock stepped, restart model at position %{public}" PRIu64".", framePosition);
+        Restart(framePosition, timeNs);
+        return;
+    }
+    outlierNum_ = 0;
+    lastFrame_ = framePosition;
+    samples_[(sampleHead_ + sampleNum_) % CLOCK_WINDOW_SAMPLES] = { frames, relTimeNs };
+    if (sampleNum_ < CLOCK_WINDOW_SAMPLES) {
+        sampleNum_++;
+    } else {
+        sampleHead_ = (sampleHead_ + 1) % CLOCK_WINDOW_SAMPLES;
+    }
+    Fit();
+}
+
+bool DaudioClockModel::IsValid() const
+{
+    return sampleNum_ > 0;
+}
+
+int64_t DaudioClockModel::GetTimeNs(const uint64_t framePosition) const
+{
+    if (!IsValid()) {
+        return 0;
+    }
+    // The difference is taken in two's complement so positions before the origin stay signed.
+    double frames = static_cast<double>(static_cast<int64_t>(framePosition - originFrame_));
+    return originNs_ + static_cast<int64_t>(std::llround(Evaluate(frames)));
+}
+
+double DaudioClockModel::GetRatePpm() const
+{
+    if (nsPerFrame_ <= 0) {
+        return 0;
+    }
+    // A clock running fast captures each frame in less time than nominal.
+    return (nominalNsPerFrame_ / nsPerFrame_ - 1.0) * PPM_PER_UNIT;
+}
+
+void DaudioClockModel::Restart(const uint64_t framePosition, const int64_t timeNs)
+{
+    originFrame_ = framePosition;
+    originNs_ = timeNs;
+    lastFrame_ = framePosition;
+    samples_[0] = { 0, 0 };
+    sampleHead_ = 0;
+    sampleNum_ = 1;
+    outlierNum_ = 0;
+    meanFrames_ = 0;
+    meanTimeNs_ = 0;
+    nsPerFrame_ = nominalNsPerFrame_;
+}
+
+void DaudioClockModel::Fit()
+{
+    double meanX = 0;
+    double meanY = 0;
+    for (uint32_t i = 0; i < sampleNum_; i++) {
+        const Sample &sample = samples_[(sampleHead_ + i) % CLOCK_WINDOW_SAMPLES];
+        meanX += sample.frames;
+        meanY += sample.timeNs;
+    }
+    meanX /= sampleNum_;
+    meanY /= sampleNum_;
+    meanFrames_ = meanX;
+    meanTimeNs_ = meanY;
+    if (sampleNum_ < CLOCK_MIN_SAMPLES) {
+        nsPerFrame_ = nominalNsPerFrame_;
+        return;
+    }
+    double sxy = 0;
+    double sxx = 0;
+    for (uint32_t i = 0; i < sampleNum_; i++) {
+        const Sample &sample = samples_[(sampleHead_ + i) % CLOCK_WINDOW_SAMPLES];
+        double dx = sample.frames - meanX;
+        sxy += dx * (sample.timeNs - meanY);
+        sxx += dx * dx;
+    }
+    if (sxx <= 0) {
+        return;
+    }
+    double maxDeviation = nominalNsPerFrame_ * CLOCK_MAX_PPM / PPM_PER_UNIT;
+    nsPerFrame_ = std::clamp(sxy / sxx, nominalNsPerFrame_ - maxDeviation, nominalNsPerFrame_ + maxDeviation);
+}
+
+double DaudioClockModel::Evaluate(const double frames) const
+{
+    return meanTimeNs_ + (frames - meanFrames_) * nsPerFrame_;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
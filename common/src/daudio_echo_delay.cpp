@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_echo_delay.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <securec.h>
+
+#include "audio_param.h"
+#include "daudio_errorcode.h"
+#include "daudio_log.h"
+#include "daudio_util.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DaudioEchoDelay"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr uint32_t MAX_SAMPLE_RATE = 192000;
+constexpr float PCM_S16_SCALE = 1.0f / 32768.0f;
+// Mean square of a -60 dBFS signal; quieter windows carry no usable phase.
+constexpr float SILENCE_POWER = 1e-6f;
+constexpr float PHAT_EPSILON = 1e-12f;
+constexpr uint32_t MAX_LAG = DaudioEchoDelayEstimator::ECHO_DELAY_MAX_MS * DaudioEchoDelayEstimator::ECHO_DELAY_RATE /
+    AUDIO_MS_PER_SECOND;
+constexpr int64_t TOLERANCE = static_cast<int64_t>(DaudioEchoDelayEstimator::ECHO_DELAY_TOLERANCE_US) *
+    DaudioEchoDelayEstimator::ECHO_DELAY_RATE / AUDIO_US_PER_SECOND;
+}
+
+void DaudioEchoDelayEstimator::Decimator::Init(const uint32_t sampleRate, const uint32_t channels,
+    const uint32_t historySize)
+{
+    sampleRate_ = sampleRate;
+    channels_ = channels;
+    history_.assign(historySize, 0.0f);
+    Reset();
+}
+
+void DaudioEchoDelayEstimator::Decimator::Reset()
+{
+    frames_ = 0;
+    count_ = 0;
+    acc_ = 0;
+    accNum_ = 0;
+    std::fill(history_.begin(), history_.end(), 0.0f);
+}
+
+void DaudioEchoDelayEstimator::Decimator::Push(const int16_t *samples, const size_t frames)
+{
+    if (history_.empty()) {
+        return;
+    }
+    for (size_t i = 0; i < frames; i++) {
+        uint64_t index = frames_ * ECHO_DELAY_RATE / sampleRate_;
+        if (accNum_ > 0 && index != count_) {
+            history_[count_ % history_.size()] = acc_ / accNum_;
+            count_ = index;
+            acc_ = 0;
+            accNum_ = 0;
+        }
+        float sum = 0;
+        for (uint32_t ch = 0; ch < channels_; ch++) {
+            sum += samples[i * channels_ + ch];
+        }
+        acc_ += sum * PCM_S16_SCALE / channels_;
+        accNum_++;
+        frames_++;
+    }
+}
+
+uint64_t DaudioEchoDelayEstimator::Decimator::GetFrames() const
+{
+    return frames_;
+}
+
+uint64_t DaudioEchoDelayEstimator::Decimator::GetCount() const
+{
+    return count_;
+}
+
+void DaudioEchoDelayEstimator::Decimator::CopyLatest(std::complex<float> *out, const uint32_t num) const
+{
+    uint64_t missing = count_ < num ? num - count_ : 0;
+    for (uint32_t i = 0; i < num; i++) {
+        if (i < missing) {
+            out[i] = 0;
+            continue;
+        }
+        out[i] = history_[(count_ - num + i) % history_.size()];
+    }
+}
+
+float DaudioEchoDelayEstimator::Decimator::GetPower(const uint32_t num) const
+{
+    uint64_t avail = std::min<uint64_t>({ count_, num, history_.size() });
+    if (avail == 0) {
+        return 0;
+    }
+    float sum = 0;
+    for (uint64_t i = count_ - avail; i < count_; i++) {
+        float value = history_[i % history_.size()];
+        sum += value * value;
+    }
+    return sum / avail;
+}
+
+int32_t DaudioEchoDelayEstimator::Init(const uint32_t refSampleRate, const uint32_t refChannels,
+    const uint32_t micSampleRate, const uint32_t micChannels, const int32_t bitFormat)
+{
+    enabled_ = false;
+    if (refSampleRate < ECHO_DELAY_RATE || refSampleRate > MAX_SAMPLE_RATE || micSampleRate < ECHO_DELAY_RATE ||
+        micSampleRate > MAX_SAMPLE_RATE || refChannels == 0 || micChannels == 0 || bitFormat != SAMPLE_S16LE) {
+        DHLOGE("Echo delay estimation not supported, ref: %{public}u/%{public}u, mic: %{public}u/%{public}u, "
+            "bitFormat: %{public}d.", refSampleRate, refChannels, micSampleRate, micChannels, bitFormat);
+        return ERR_DH_AUDIO_NOT_SUPPORT;
+    }
+    int32_t ret = fft_.Init(ECHO_DELAY_FFT_SIZE);
+    if (ret != DH_SUCCESS) {
+        return ret;
+    }
+    refSampleRate_ = refSampleRate;
+    refChannels_ = refChannels;
+    micSampleRate_ = micSampleRate;
+    micChannels_ = micChannels;
+    refDecimator_.Init(refSampleRate, refChannels, ECHO_DELAY_FFT_SIZE);
+    micDecimator_.Init(micSampleRate, micChannels, ECHO_DELAY_MIC_WINDOW);
+    // The history spans the whole correlation window, which covers the largest delay plus the newest frames.
+    uint64_t historyFrames = static_cast<uint64_t>(ECHO_DELAY_FFT_SIZE) * refSampleRate / ECHO_DELAY_RATE;
+    refHistory_.assign(historyFrames * refChannels, 0);
+    refSpectrum_.assign(ECHO_DELAY_FFT_SIZE, 0);
+    micSpectrum_.assign(ECHO_DELAY_FFT_SIZE, 0);
+    enabled_ = true;
+    Reset();
+    return DH_SUCCESS;
+}
+
+void DaudioEchoDelayEstimator::Reset()
+{
+    refDecimator_.Reset();
+    micDecimator_.Reset();
+    refHistoryFrames_ = 0;
+    micSinceEstimate_ = 0;
+    offset_ = 0;
+    candidateOffset_ = 0;
+    hasCandidate_ = false;
+    isValid_.store(false);
+    delayUs_.store(0);
+    confidence_.store(0);
+}
+
+void DaudioEchoDelayEstimator::PushReference(const uint8_t *data, const size_t len)
+{
+    if (!enabled_ || data == nullptr) {
+        return;
+    }
+    const int16_t *samples = reinterpret_cast<const int16_t *>(data);
+    size_t frames = len / (sizeof(int16_t) * refChannels_);
+    size_t capacity = refHistory_.size() / refChannels_;
+    size_t done = 0;
+    while (done < frames) {
+        size_t pos = (refHistoryFrames_ + done) % capacity;
+        size_t chunk = std::min(frames - done, capacity - pos);
+        if (memcpy_s(refHistory_.data() + pos * refChannels_, (capacity - pos) * refChannels_ * sizeof(int16_t),
+            samples + done * refChannels_, chunk * refChannels_ * sizeof(int16_t)) != EOK) {
+            DHLOGE("Copy reference history failed.");
+            return;
+        }
+        done += chunk;
+    }
+    refHistoryFrames_ += frames;
+    refDecimator_.Push(samples, frames);
+}
+
+void DaudioEchoDelayEstimator::PushCapture(const uint8_t *data, const size_t len)
+{
+    if (!enabled_ || data == nullptr) {
+        return;
+    }
+    size_t frames = len / (sizeof(int16_t) * micChannels_);
+    micDecimator_.Push(reinterpret_cast<const int16_t *>(data), frames);
+    micSinceEstimate_ += frames;
+    if (micSinceEstimate_ * AUDIO_MS_PER_SECOND >= static_cast<uint64_t>(ECHO_DELAY_INTERVAL_MS) * micSampleRate_) {
+        micSinceEstimate_ = 0;
+        Estimate();
+    }
+}
+
+void DaudioEchoDelayEstimator::Estimate()
+{
+    uint64_t refCount = refDecimator_.GetCount();
+    uint64_t micCount = micDecimator_.GetCount();
+    if (refCount < ECHO_DELAY_MIC_WINDOW || micCount < ECHO_DELAY_MIC_WINDOW) {
+        return;
+    }
+    if (micDecimator_.GetPower(ECHO_DELAY_MIC_WINDOW) < SILENCE_POWER ||
+        refDecimator_.GetPower(ECHO_DELAY_FFT_SIZE) < SILENCE_POWER) {
+        return;
+    }
+    refDecimator_.CopyLatest(refSpectrum_.data(), ECHO_DELAY_FFT_SIZE);
+    micDecimator_.CopyLatest(micSpectrum_.data(), ECHO_DELAY_MIC_WINDOW);
+    std::fill(micSpectrum_.begin() + ECHO_DELAY_MIC_WINDOW, micSpectrum_.end(), 0.0f);
+    fft_.Forward(refSpectrum_.data());
+    fft_.Forward(micSpectrum_.data());
+    for (uint32_t k = 0; k < ECHO_DELAY_FFT_SIZE; k++) {
+        std::complex<float> cross = refSpectrum_[k] * std::conj(micSpectrum_[k]);
+        float mag = std::abs(cross);
+        refSpectrum_[k] = mag > PHAT_EPSILON ? cross / mag : 0.0f;
+    }
+    fft_.Inverse(refSpectrum_.data());
+
+    // Lag j of the correlation lines the capture window up with reference samples [j, j + window), which
+    // end d = FFT_SIZE - window - j samples before the newest reference sample.
+    uint64_t maxLag = std::min<uint64_t>({ MAX_LAG, ECHO_DELAY_FFT_SIZE - ECHO_DELAY_MIC_WINDOW,
+        refCount - ECHO_DELAY_MIC_WINDOW });
+    uint32_t last = ECHO_DELAY_FFT_SIZE - ECHO_DELAY_MIC_WINDOW;
+    float peak = 0;
+    float sum = 0;
+    uint64_t delay = 0;
+    for (uint64_t d = 0; d <= maxLag; d++) {
+        float value = std::fabs(refSpectrum_[last - d].real());
+        sum += value;
+        if (value > peak) {
+            peak = value;
+            delay = d;
+        }
+    }
+    float mean = sum / (maxLag + 1);
+    float confidence = mean > 0 ? peak / mean : 0;
+    if (confidence < ECHO_DELAY_MIN_CONFIDENCE) {
+        return;
+    }
+    int64_t offset = static_cast<int64_t>(refCount - delay) - static_cast<int64_t>(micCount);
+    if (hasCandidate_ && std::llabs(offset - candidateOffset_) <= TOLERANCE) {
+        if (!isValid_.load() || offset != offset_) {
+            DHLOGI("Echo delay: %{public}" PRIu64 " us, confidence: %{public}.1f.",
+                delay * AUDIO_US_PER_SECOND / ECHO_DELAY_RATE, confidence);
+        }
+        offset_ = offset;
+        delayUs_.store(static_cast<int64_t>(delay * AUDIO_US_PER_SECOND / ECHO_DELAY_RATE));
+        confidence_.store(confidence);
+        isValid_.store(true);
+    }
+    candidateOffset_ = offset;
+    hasCandidate_ = true;
+}
+
+size_t DaudioEchoDelayEstimator::GetAlignedReference(uint8_t *out, const size_t len) const
+{
+    if (!enabled_ || out == nullptr) {
+        return 0;
+    }
+    size_t frameBytes = sizeof(int16_t) * refChannels_;
+    size_t frames = len / frameBytes;
+    if (frames == 0) {
+        return 0;
+    }
+    int64_t end = static_cast<int64_t>(refHistoryFrames_);
+    if (isValid_.load()) {
+        // The echo of the newest capture sample left the speaker at this decimated reference position.
+        double echoDecimated = static_cast<double>(micDecimator_.GetFrames()) * ECHO_DELAY_RATE / micSampleRate_ +
+            offset_;
+        int64_t margin = static_cast<int64_t>(ECHO_DELAY_MARGIN_MS) * refSampleRate_ / AUDIO_MS_PER_SECOND;
+        end = std::min<int64_t>(end, std::llround(echoDecimated * refSampleRate_ / ECHO_DELAY_RATE) + margin);
+    }
+    int64_t capacity = static_cast<int64_t>(refHistory_.size() / refChannels_);
+    int64_t oldest = std::max<int64_t>(0, static_cast<int64_t>(refHistoryFrames_) - capacity);
+    int64_t start = end - static_cast<int64_t>(frames);
+    size_t done = 0;
+    if (start < oldest) {
+        done = static_cast<size_t>(std::min<int64_t>(oldest - start, static_cast<int64_t>(frames)));
+        (void)memset_s(out, len, 0, done * frameBytes);
+    }
+    while (done < frames) {
+        size_t pos = static_cast<size_t>((start + static_cast<int64_t>(done)) % capacity);
+        size_t chunk = std::min(frames - done, static_cast<size_t>(capacity) - pos);
+        if (memcpy_s(out + done * frameBytes, len - done * frameBytes, refHistory_.data() + pos * refChannels_,
+            chunk * frameBytes) != EOK) {
+            DHLOGE("Copy aligned reference failed.");
+            return 0;
+        }
+        done += chunk;
+    }
+    return frames * frameBytes;
+}
+
+bool DaudioEchoDelayEstimator::IsValid() const
+{
+    return isValid_.load();
+}
+
+int64_t DaudioEchoDelayEstimator::GetDelayUs() const
+{
+    return delayUs_.load();
+}
+
+float DaudioEchoDelayEstimator::GetConfidence() const
+{
+    return confidence_.load();
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_fft.h"
+
+#include <cmath>
+
+#include "daudio_errorcode.h"
+#include "daudio_log.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DaudioFft"
+
+namespace OHOS {
+namespace DistributedHardware {
+int32_t DaudioFft::Init(const uint32_t size)
+{
+    if (size < 2 || size > FFT_MAX_SIZE || (size & (size - 1)) != 0) {
+        DHLOGE("Invalid fft size: %{public}u.", size);
+        return ERR_DH_AUDIO_BAD_VALUE;
+    }
+    size_ = size;
+    uint32_t bits = 0;
+    while ((1U << bits) < size) {
+        bits++;
+    }
+    bitReverse_.resize(size);
+    for (uint32_t i = 0; i < size; i++) {
+        uint32_t reversed = 0;
+        for (uint32_t b = 0; b < bits; b++) {
+            reversed |= ((i >> b) & 1U) << (bits - 1 - b);
+        }
+        bitReverse_[i] = reversed;
+    }
+    twiddles_.resize(size / 2);
+    for (uint32_t k = 0; k < size / 2; k++) {
+        double angle = -2.0 * M_PI * k / size;
+        twiddles_[k] = std::complex<float>(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+    }
+    return DH_SUCCESS;
+}
+
+uint32_t DaudioFft::GetSize() const
+{
+    return size_;
+}
+
+void DaudioFft::Forward(std::complex<float> *data) const
+{
+    Transform(data, false);
+}
+
+void DaudioFft::Inverse(std::complex<float> *data) const
+{
+    Transform(data, true);
+    if (data == nullptr || size_ == 0) {
+        return;
+    }
+    float scale = 1.0f / size_;
+    for (uint32_t i = 0; i < size_; i++) {
+        data[i] *= scale;
+    }
+}
+
+void DaudioFft::Transform(std::complex<float> *data, const bool inverse) const
+{
+    if (data == nullptr || size_ == 0) {
+        return;
+    }
+    for (uint32_t i = 0; i < size_; i++) {
+        if (i < bitReverse_[i]) {
+            std::swap(data[i], data[bitReverse_[i]]);
+        }
+    }
+    for (uint32_t len = 2; len <= size_; len <<= 1) {
+        uint32_t half = len / 2;
+        uint32_t stride = size_ / len;
+        for (uint32_t start = 0; start < size_; start += len) {
+            for (uint32_t k = 0; k < half; k++) {
+                std::complex<float> w = twiddles_[k * stride];
+                if (inverse) {
+                    w = std::conj(w);
+                }
+                std::complex<float> odd = data[start + k + half] * w;
+                data[start + k + half] = data[start + k] - odd;
+                data[start + k] += odd;
+            }
+        }
+    }
+}
+} // namespace DistributedHardware
+} // namespace OHOS
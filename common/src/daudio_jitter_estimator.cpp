@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_jitter_estimator.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "daudio_log.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DaudioJitterEstimator"
+
+namespace OHOS {
+namespace DistributedHardware {
+void DaudioJitterEstimator::Reset(const int64_t frameDurationUs, const uint32_t minDepth, const uint32_t maxDepth)
+{
+    sampleNum_ = 0;
+    writeIndex_ = 0;
+    framesSinceRecalc_ = 0;
+    framesSinceGrow_ = 0;
+    jitterUs_ = 0;
+    frameDurationUs_ = frameDurationUs;
+    SetDepthRange(minDepth, maxDepth);
+    targetDepth_ = minDepth_;
+}
+
+void DaudioJitterEstimator::SetDepthRange(const uint32_t minDepth, const uint32_t maxDepth)
+{
+    minDepth_ = std::max(minDepth, 1U);
+    maxDepth_ = std::max(maxDepth, minDepth_);
+    targetDepth_ = ClampDepth(targetDepth_);
+}
+
+void DaudioJitterEstimator::OnFrameArrived(const int64_t pts, const int64_t arrivalUs)
+{
+    // Frames without a sender timestamp say nothing about the network and would read as jitter.
+    if (pts <= 0 || frameDurationUs_ <= 0) {
+        return;
+    }
+    transit_[writeIndex_] = arrivalUs - pts;
+    writeIndex_ = (writeIndex_ + 1) % JITTER_WINDOW_SIZE;
+    if (sampleNum_ < JITTER_WINDOW_SIZE) {
+        sampleNum_++;
+    }
+    framesSinceGrow_++;
+    if (++framesSinceRecalc_ >= JITTER_RECALC_INTERVAL) {
+        framesSinceRecalc_ = 0;
+        UpdateTarget();
+    }
+}
+
+void DaudioJitterEstimator::OnUnderrun()
+{
+    targetDepth_ = ClampDepth(targetDepth_ + 1);
+    framesSinceGrow_ = 0;
+    DHLOGD("Underrun, target depth: %{public}u.", targetDepth_);
+}
+
+void DaudioJitterEstimator::UpdateTarget()
+{
+    std::copy(transit_.begin(), transit_.begin() + sampleNum_, scratch_.begin());
+    auto begin = scratch_.begin();
+    auto end = scratch_.begin() + sampleNum_;
+    int64_t minTransit = *std::min_element(begin, end);
+    auto nth = begin + (sampleNum_ - 1) * JITTER_PERCENTILE / 100;
+    std::nth_element(begin, nth, end);
+    jitterUs_ = *nth - minTransit;
+    // One frame for the one being played out, plus enough frames to cover the jitter.
+    uint32_t depth = ClampDepth(static_cast<uint32_t>((jitterUs_ + frameDurationUs_ - 1) / frameDurationUs_) + 1);
+    if (depth > targetDepth_) {
+        targetDepth_ = depth;
+        framesSinceGrow_ = 0;
+        DHLOGD("Jitter %{public}" PRId64 " us, grow target depth to %{public}u.", jitterUs_, targetDepth_);
+    } else if (depth < targetDepth_ && framesSinceGrow_ >= JITTER_WINDOW_SIZE) {
+        targetDepth_--;
+        framesSinceGrow_ = 0;
+        DHLOGD("Jitter %{public}" PRId64 " us, shrink target depth to %{public}u.", jitterUs_, targetDepth_);
+    }
+}
+
+uint32_t DaudioJitterEstimator::ClampDepth(const uint32_t depth) const
+{
+    return std::min(std::max(depth, minDepth_), maxDepth_);
+}
+
+uint32_t DaudioJitterEstimator::GetTargetDepth() const
+{
+    return targetDepth_;
+}
+
+int64_t DaudioJitterEstimator::GetJitterUs() const
+{
+    return jitterUs_;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_mmap_position.h"
+
+#include <algorithm>
+
+#include "daudio_errorcode.h"
+#include "daudio_log.h"
+#include "daudio_seqlock.h"
+#include "daudio_util.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DaudioMmapPosition"
+
+namespace OHOS {
+namespace DistributedHardware {
+void DaudioMmapPosition::Reset(const uint32_t sampleRate, const uint32_t periodFrames, const bool interpolated)
+{
+    DaudioSeqlock lock(&snapshot_.version);
+    int32_t ret = lock.Write([this, sampleRate, periodFrames, interpolated]() {
+        SeqlockStore(snapshot_.sampleRate, sampleRate);
+        SeqlockStore(snapshot_.periodFrames, periodFrames);
+        SeqlockStore(snapshot_.interpolated, interpolated);
+        SeqlockStore(snapshot_.frames, static_cast<uint64_t>(0));
+        SeqlockStore(snapshot_.timeNs, static_cast<int64_t>(0));
+    });
+    if (ret != DH_SUCCESS) {
+        DHLOGE("Reset mmap position failed, ret: %{public}d.", ret);
+    }
+}
+
+void DaudioMmapPosition::Publish(const uint64_t frames, const int64_t timeNs)
+{
+    DaudioSeqlock lock(&snapshot_.version);
+    int32_t ret = lock.Write([this, frames, timeNs]() {
+        SeqlockStore(snapshot_.frames, frames);
+        SeqlockStore(snapshot_.timeNs, timeNs);
+    });
+    if (ret != DH_SUCCESS) {
+        DHLOGE("Publish mmap position failed, ret: %{public}d.", ret);
+    }
+}
+
+int32_t DaudioMmapPosition::Read(uint64_t &frames, int64_t &timeNs) const
+{
+    Snapshot snapshot;
+    DaudioSeqlock lock(&snapshot_.version);
+    int32_t ret = lock.Read([this, &snapshot]() {
+        snapshot.sampleRate = SeqlockLoad(snapshot_.sampleRate);
+        snapshot.periodFrames = SeqlockLoad(snapshot_.periodFrames);
+        snapshot.interpolated = SeqlockLoad(snapshot_.interpolated);
+        snapshot.frames = SeqlockLoad(snapshot_.frames);
+        snapshot.timeNs = SeqlockLoad(snapshot_.timeNs);
+    });
+    CHECK_AND_RETURN_RET_LOG(ret != DH_SUCCESS, ret, "Read mmap position failed, ret: %{public}d.", ret);
+    frames = snapshot.frames;
+    timeNs = snapshot.timeNs;
+    if (!snapshot.interpolated || snapshot.timeNs <= 0 || snapshot.sampleRate == 0) {
+        return DH_SUCCESS;
+    }
+    int64_t nowNs = GetCurNano();
+    if (nowNs <= snapshot.timeNs) {
+        return DH_SUCCESS;
+    }
+    int64_t elapsedNs = std::min<int64_t>(nowNs - snapshot.timeNs, AUDIO_NS_PER_SECOND);
+    uint64_t extraFrames = static_cast<uint64_t>(elapsedNs) * snapshot.sampleRate /
+        static_cast<uint64_t>(AUDIO_NS_PER_SECOND);
+    frames += std::min<uint64_t>(extraFrames, snapshot.periodFrames);
+    timeNs = nowNs;
+    return DH_SUCCESS;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
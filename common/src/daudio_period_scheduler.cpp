@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_period_scheduler.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include "daudio_constants.h"
+#include "daudio_errorcode.h"
+#include "daudio_log.h"
+#include "daudio_util.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DaudioPeriodScheduler"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr const char *PERIOD_THREAD = "daudioPeriodTh";
+constexpr int64_t NS_PER_US = 1000;
+constexpr uint32_t POLL_FD_NUM = 2;
+}
+
+FWK_IMPLEMENT_SINGLE_INSTANCE(DaudioPeriodScheduler);
+
+DaudioPeriodScheduler::~DaudioPeriodScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        isRunning_ = false;
+    }
+    WakeLoop();
+    if (loopThread_.joinable()) {
+        loopThread_.join();
+    }
+    if (timerFd_ >= 0) {
+        close(timerFd_);
+    }
+    if (eventFd_ >= 0) {
+        close(eventFd_);
+    }
+}
+
+int32_t DaudioPeriodScheduler::Register(const std::string &name, const int64_t periodNs, const int64_t phaseNs,
+    TickFunc tick, uint32_t &streamId)
+{
+    CHECK_AND_RETURN_RET_LOG(periodNs <= 0 || phaseNs < 0 || tick == nullptr, ERR_DH_AUDIO_SA_PARAM_INVALID,
+        "Invalid period stream, period: %{public}" PRId64 " ns, phase: %{public}" PRId64 " ns.", periodNs, phaseNs);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        int32_t ret = StartLocked();
+        CHECK_AND_RETURN_RET_LOG(ret != DH_SUCCESS, ret, "Start period scheduler failed.");
+        auto stream = std::make_shared<Stream>();
+        stream->name = name;
+        stream->periodNs = periodNs;
+        stream->nextDeadlineNs = GetCurNano() + phaseNs;
+        stream->tick = std::move(tick);
+        streamId = nextStreamId_++;
+        streams_[streamId] = stream;
+    }
+    DHLOGI("Register period stream %{public}s, id: %{public}u, period: %{public}" PRId64 " ns.", name.c_str(),
+        streamId, periodNs);
+    WakeLoop();
+    return DH_SUCCESS;
+}
+
+int32_t DaudioPeriodScheduler::Unregister(const uint32_t streamId)
+{
+    std::shared_ptr<Stream> stream = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto iter = streams_.find(streamId);
+        CHECK_AND_RETURN_RET_LOG(iter == streams_.end(), ERR_DH_AUDIO_NOT_FOUND_KEY,
+            "Period stream %{public}u not found.", streamId);
+        stream = iter->second;
+        streams_.erase(iter);
+        if (std::this_thread::get_id() != loopThread_.get_id()) {
+            tickDoneCond_.wait(lock, [this, streamId]() { return runningStreamId_ != streamId; });
+        }
+    }
+    DHLOGI("Unregister period stream %{public}s, ticks: %{public}" PRIu64 ", deadline misses: %{public}" PRIu64
+        ", skipped: %{public}" PRIu64 ", max lateness: %{public}" PRId64 " ns.", stream->name.c_str(),
+        stream->stats.ticks, stream->stats.deadlineMisses, stream->stats.skippedTicks, stream->stats.maxLatenessNs);
+    WakeLoop();
+    return DH_SUCCESS;
+}
+
+int32_t DaudioPeriodScheduler::GetStats(const uint32_t streamId, DaudioPeriodStats &stats)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = streams_.find(streamId);
+    CHECK_AND_RETURN_RET_LOG(iter == streams_.end(), ERR_DH_AUDIO_NOT_FOUND_KEY,
+        "Period stream %{public}u not found.", streamId);
+    stats = iter->second->stats;
+    return DH_SUCCESS;
+}
+
+int32_t DaudioPeriodScheduler::StartLocked()
+{
+    if (isRunning_) {
+        return DH_SUCCESS;
+    }
+    if (timerFd_ < 0) {
+        timerFd_ = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+        CHECK_AND_RETURN_RET_LOG(timerFd_ < 0, ERR_DH_AUDIO_FAILED, "Create timerfd failed, errno: %{public}d.", errno);
+    }
+    if (eventFd_ < 0) {
+        eventFd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        CHECK_AND_RETURN_RET_LOG(eventFd_ < 0, ERR_DH_AUDIO_FAILED, "Create eventfd failed, errno: %{public}d.", errno);
+    }
+    isRunning_ = true;
+    loopThread_ = std::thread([this]() { this->Loop(); });
+    if (pthread_setname_np(loopThread_.native_handle(), PERIOD_THREAD) != DH_SUCCESS) {
+        DHLOGE("Period scheduler thread setname failed.");
+    }
+    return DH_SUCCESS;
+}
+
+void DaudioPeriodScheduler::WakeLoop()
+{
+    if (eventFd_ < 0) {
+        return;
+    }
+    uint64_t one = 1;
+    if (write(eventFd_, &one, sizeof(one)) < 0) {
+        DHLOGD("Wake period scheduler failed, errno: %{public}d.", errno);
+    }
+}
+
+void DaudioPeriodScheduler::SetRealtimePolicy()
+{
+    int32_t priority = -1;
+    if (!GetSysPara(PERIOD_SCHED_FIFO_PARA.c_str(), priority) || priority <= 0) {
+        return;
+    }
+    priority = std::min(priority, sched_get_priority_max(SCHED_FIFO));
+    struct sched_param param = {};
+    param.sched_priority = priority;
+    int32_t ret = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (ret != 0) {
+        DHLOGE("Set SCHED_FIFO priority %{public}d failed, ret: %{public}d.", priority, ret);
+        return;
+    }
+    DHLOGI("Period scheduler runs SCHED_FIFO, priority: %{public}d.", priority);
+}
+
+void DaudioPeriodScheduler::ArmTimerLocked()
+{
+    struct itimerspec spec = {};
+    if (!streams_.empty()) {
+        int64_t deadline = INT64_MAX;
+        for (const auto &item : streams_) {
+            deadline = std::min(deadline, item.second->nextDeadlineNs);
+        }
+        // An all-zero it_value disarms the timer, so an already due deadline is armed 1 ns after epoch.
+        deadline = std::max<int64_t>(deadline, 1);
+        spec.it_value.tv_sec = static_cast<time_t>(deadline / AUDIO_NS_PER_SECOND);
+        spec.it_value.tv_nsec = static_cast<long>(deadline % AUDIO_NS_PER_SECOND);
+    }
+    if (timerfd_settime(timerFd_, TFD_TIMER_ABSTIME, &spec, nullptr) != 0) {
+        DHLOGE("Arm timerfd failed, errno: %{public}d.", errno);
+    }
+}
+
+std::shared_ptr<DaudioPeriodScheduler::Stream> DaudioPeriodScheduler::PickDueLocked(const int64_t nowNs,
+    uint32_t &streamId)
+{
+    std::shared_ptr<Stream> due = nullptr;
+    for (const auto &item : streams_) {
+        if (item.second->nextDeadlineNs <= nowNs &&
+            (due == nullptr || item.second->nextDeadlineNs < due->nextDeadlineNs)) {
+            due = item.second;
+            streamId = item.first;
+        }
+    }
+    return due;
+}
+
+void DaudioPeriodScheduler::RecordLateness(Stream &stream, const int64_t latenessNs)
+{
+    stream.stats.ticks++;
+    stream.stats.maxLatenessNs = std::max(stream.stats.maxLatenessNs, latenessNs);
+    if (latenessNs >= stream.periodNs) {
+        stream.stats.deadlineMisses++;
+    }
+    int64_t latenessUs = latenessNs / NS_PER_US;
+    uint32_t bucket = 0;
+    while (bucket < PERIOD_LATENESS_BOUNDS_US.size() && latenessUs >= PERIOD_LATENESS_BOUNDS_US[bucket]) {
+        bucket++;
+    }
+    stream.stats.latenessHistogram[bucket]++;
+}
+
+void DaudioPeriodScheduler::Loop()
+{
+    SetRealtimePolicy();
+    struct pollfd fds[POLL_FD_NUM] = {
+        { timerFd_, POLLIN, 0 },
+        { eventFd_, POLLIN, 0 },
+    };
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!isRunning_) {
+                break;
+            }
+            ArmTimerLocked();
+        }
+        if (poll(fds, POLL_FD_NUM, -1) < 0 && errno != EINTR) {
+            DHLOGE("Poll period timer failed, errno: %{public}d.", errno);
+        }
+        uint64_t count = 0;
+        for (uint32_t i = 0; i < POLL_FD_NUM; i++) {
+            if ((fds[i].revents & POLLIN) != 0 && read(fds[i].fd, &count, sizeof(count)) < 0) {
+                DHLOGD("Drain period fd failed, errno: %{public}d.", errno);
+            }
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (isRunning_) {
+            uint32_t streamId = 0;
+            int64_t nowNs = GetCurNano();
+            std::shared_ptr<Stream> stream = PickDueLocked(nowNs, streamId);
+            if (stream == nullptr) {
+                break;
+            }
+            int64_t latenessNs = nowNs - stream->nextDeadlineNs;
+            RecordLateness(*stream, latenessNs);
+            int64_t behind = latenessNs / stream->periodNs;
+            if (behind > PERIOD_MAX_CATCH_UP) {
+                stream->stats.skippedTicks += static_cast<uint64_t>(behind);
+                stream->nextDeadlineNs += behind * stream->periodNs;
+            }
+            stream->nextDeadlineNs += stream->periodNs;
+            runningStreamId_ = streamId;
+            lock.unlock();
+            stream->tick();
+            lock.lock();
+            runningStreamId_ = 0;
+            tickDoneCond_.notify_all();
+        }
+    }
+    DHLOGI("Period scheduler loop exit.");
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_plc.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <securec.h>
+
+#include "audio_param.h"
+#include "daudio_errorcode.h"
+#include "daudio_log.h"
+#include "daudio_util.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DaudioPlc"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+// Pitch is searched on a signal decimated to about this rate; concealment does not need more.
+constexpr uint32_t PITCH_SEARCH_RATE = 8000;
+constexpr double VOICED_CORRELATION_MIN = 0.3;
+}
+
+int32_t DaudioPlc::Init(const uint32_t sampleRate, const uint32_t channels, const int32_t bitFormat,
+    const uint32_t maxConcealMs)
+{
+    enabled_ = false;
+    if (sampleRate < PLC_MAX_PITCH_HZ * 2 || channels == 0 || bitFormat != SAMPLE_S16LE) {
+        DHLOGE("Plc not supported, sampleRate: %{public}u, channels: %{public}u, bitFormat: %{public}d.",
+            sampleRate, channels, bitFormat);
+        return ERR_DH_AUDIO_NOT_SUPPORT;
+    }
+    sampleRate_ = sampleRate;
+    channels_ = channels;
+    historySamples_ = static_cast<size_t>(sampleRate) * PLC_HISTORY_MS / AUDIO_MS_PER_SECOND;
+    crossfadeSamples_ = static_cast<size_t>(sampleRate) * PLC_CROSSFADE_MS / AUDIO_MS_PER_SECOND;
+    maxConcealSamples_ = static_cast<size_t>(sampleRate) * maxConcealMs / AUDIO_MS_PER_SECOND;
+    history_.assign(historySamples_ * channels_, 0);
+    fadeScratch_.assign(crossfadeSamples_ * channels_, 0);
+    enabled_ = true;
+    Reset();
+    return DH_SUCCESS;
+}
+
+void DaudioPlc::Reset()
+{
+    historyValid_ = 0;
+    concealedRun_ = 0;
+    pitchSamples_ = 0;
+    phase_ = 0;
+    inLoss_ = false;
+}
+
+void DaudioPlc::OnGoodFrame(uint8_t *data, const size_t len)
+{
+    if (!enabled_ || data == nullptr) {
+        return;
+    }
+    int16_t *samples = reinterpret_cast<int16_t *>(data);
+    size_t sampleNum = len / sizeof(int16_t) / channels_;
+    if (inLoss_) {
+        size_t fadeNum = std::min(crossfadeSamples_, sampleNum);
+        Synthesize(fadeScratch_.data(), fadeNum);
+        for (size_t i = 0; i < fadeNum; i++) {
+            float weight = static_cast<float>(i + 1) / static_cast<float>(fadeNum + 1);
+            for (uint32_t ch = 0; ch < channels_; ch++) {
+                size_t idx = i * channels_ + ch;
+                samples[idx] = static_cast<int16_t>(weight * samples[idx] + (1.0f - weight) * fadeScratch_[idx]);
+            }
+        }
+        inLoss_ = false;
+        concealedRun_ = 0;
+    }
+    AppendHistory(samples, sampleNum);
+}
+
+bool DaudioPlc::Conceal(uint8_t *data, const size_t len)
+{
+    if (data == nullptr) {
+        return false;
+    }
+    if (!enabled_ || historyValid_ == 0) {
+        (void)memset_s(data, len, 0, len);
+        return false;
+    }
+    if (!inLoss_) {
+        inLoss_ = true;
+        concealedRun_ = 0;
+        phase_ = 0;
+        pitchSamples_ = EstimatePitch();
+        lossEvents_++;
+        DHLOGD("Loss run %{public}" PRIu64 " starts, pitch: %{public}u samples.", lossEvents_, pitchSamples_);
+    }
+    if (concealedRun_ >= maxConcealSamples_) {
+        (void)memset_s(data, len, 0, len);
+        mutedFrames_++;
+        return false;
+    }
+    Synthesize(reinterpret_cast<int16_t *>(data), len / sizeof(int16_t) / channels_);
+    concealedFrames_++;
+    return true;
+}
+
+void DaudioPlc::AppendHistory(const int16_t *samples, const size_t sampleNum)
+{
+    size_t keep = std::min(historyValid_, historySamples_ - std::min(sampleNum, historySamples_));
+    size_t add = std::min(sampleNum, historySamples_);
+    if (keep > 0 && keep != historyValid_) {
+        std::copy(history_.begin() + (historyValid_ - keep) * channels_, history_.begin() + historyValid_ * channels_,
+            history_.begin());
+    }
+    std::copy(samples + (sampleNum - add) * channels_, samples + sampleNum * channels_,
+        history_.begin() + keep * channels_);
+    historyValid_ = keep + add;
+}
+
+uint32_t DaudioPlc::EstimatePitch() const
+{
+    size_t minLag = sampleRate_ / PLC_MAX_PITCH_HZ;
+    size_t maxLag = sampleRate_ / PLC_MIN_PITCH_HZ;
+    // Not enough history to compare a whole window with its lagged copy: repeat what there is.
+    if (historyValid_ < maxLag * 2) {
+        return static_cast<uint32_t>(std::min(historyValid_, maxLag));
+    }
+    size_t step = std::max(1U, sampleRate_ / PITCH_SEARCH_RATE);
+    size_t end = historyValid_;
+    size_t window = maxLag;
+    double bestCorr = 0.0;
+    size_t bestLag = maxLag;
+    for (size_t lag = minLag; lag <= maxLag; lag += step) {
+        double cross = 0.0;
+        double energyNow = 0.0;
+        double energyLag = 0.0;
+        for (size_t i = end - window; i < end; i += step) {
+            double now = history_[i * channels_];
+            double past = history_[(i - lag) * channels_];
+            cross += now * past;
+            energyNow += now * now;
+            energyLag += past * past;
+        }
+        if (energyNow <= 0.0 || energyLag <= 0.0) {
+            continue;
+        }
+        double corr = cross / std::sqrt(energyNow * energyLag);
+        if (corr > bestCorr) {
+            bestCorr = corr;
+            bestLag = lag;
+        }
+    }
+    // Unvoiced or noisy input has no period; a long repeat sounds less buzzy than a short one.
+    return static_cast<uint32_t>(bestCorr < VOICED_CORRELATION_MIN ? maxLag : bestLag);
+}
+
+void DaudioPlc::Synthesize(int16_t *out, const size_t sampleNum)
+{
+    if (pitchSamples_ == 0) {
+        (void)memset_s(out, sampleNum * channels_ * sizeof(int16_t), 0, sampleNum * channels_ * sizeof(int16_t));
+        return;
+    }
+    size_t base = historyValid_ - pitchSamples_;
+    for (size_t i = 0; i < sampleNum; i++) {
+        float gain = 0.0f;
+        if (concealedRun_ < maxConcealSamples_) {
+            gain = 1.0f - static_cast<float>(concealedRun_) / static_cast<float>(maxConcealSamples_);
+        }
+        const int16_t *src = &history_[(base + phase_) * channels_];
+        for (uint32_t ch = 0; ch < channels_; ch++) {
+            out[i * channels_ + ch] = static_cast<int16_t>(gain * src[ch]);
+        }
+        phase_ = (phase_ + 1) % pitchSamples_;
+        concealedRun_++;
+    }
+}
+
+uint32_t DaudioPlc::GetPitchSamples() const
+{
+    return pitchSamples_;
+}
+
+uint64_t DaudioPlc::GetConcealedFrames() const
+{
+    return concealedFrames_;
+}
+
+uint64_t DaudioPlc::GetMutedFrames() const
+{
+    return mutedFrames_;
+}
+
+uint64_t DaudioPlc::GetLossEvents() const
+{
+    return lossEvents_;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -15,8 +15,13 @@
 
 #include "daudio_ringbuffer.h"
 
+#include <cinttypes>
 #include <cstdint>
 #include <securec.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "daudio_util.h"
 
 #undef DH_LOG_TAG
 #define DH_LOG_TAG "DaudioRingBuffer"
@@ -193,5 +198,263 @@ bool DaudioRingBuffer::CanBufferReadLen(int32_t readLen)
     }
     return true;
 }
+DaudioSpscRingBuffer::~DaudioSpscRingBuffer()
+{
+    Release();
+}
+
+int32_t DaudioSpscRingBuffer::Init(uint32_t capacity)
+{
+    CHECK_AND_RETURN_RET_LOG(capacity == 0, ERR_DH_AUDIO_BAD_VALUE, "capacity is zero.");
+    Release();
+    int32_t ret = MapMirrored(capacity);
+    CHECK_AND_RETURN_RET_LOG(ret != DH_SUCCESS, ret, "Map mirrored buffer failed.");
+    writePos_.store(0, std::memory_order_relaxed);
+    readPos_.store(0, std::memory_order_relaxed);
+    hasPeek_ = false;
+    overrunCount_.store(0, std::memory_order_relaxed);
+    overrunBytes_.store(0, std::memory_order_relaxed);
+    underrunCount_.store(0, std::memory_order_relaxed);
+    highWatermark_.store(0, std::memory_order_relaxed);
+    return DH_SUCCESS;
+}
+
+int32_t DaudioSpscRingBuffer::MapMirrored(uint32_t capacity)
+{
+    long pageSize = sysconf(_SC_PAGESIZE);
+    CHECK_AND_RETURN_RET_LOG(pageSize <= 0, ERR_DH_AUDIO_FAILED, "Get page size failed.");
+    uint64_t alignedSize = (static_cast<uint64_t>(capacity) + static_cast<uint64_t>(pageSize) - 1) /
+        static_cast<uint64_t>(pageSize) * static_cast<uint64_t>(pageSize);
+    CHECK_AND_RETURN_RET_LOG(alignedSize > UINT32_MAX / 2, ERR_DH_AUDIO_BAD_VALUE, "capacity is too large.");
+    size_t size = static_cast<size_t>(alignedSize);
+
+    int fd = memfd_create("daudio_ringbuffer", MFD_CLOEXEC);
+    CHECK_AND_RETURN_RET_LOG(fd < 0, ERR_DH_AUDIO_FAILED, "memfd_create failed.");
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        DHLOGE("ftruncate failed.");
+        close(fd);
+        return ERR_DH_AUDIO_FAILED;
+    }
+    void *base = mmap(nullptr, size * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        DHLOGE("Reserve address space failed.");
+        close(fd);
+        return ERR_DH_AUDIO_FAILED;
+    }
+    uint8_t *baseAddr = static_cast<uint8_t *>(base);
+    void *first = mmap(baseAddr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void *second = mmap(baseAddr + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    close(fd);
+    if (first != baseAddr || second != baseAddr + size) {
+        DHLOGE("Map mirrored views failed.");
+        munmap(base, size * 2);
+        return ERR_DH_AUDIO_FAILED;
+    }
+    array_ = baseAddr;
+    capacity_ = static_cast<uint32_t>(size);
+    return DH_SUCCESS;
+}
+
+void DaudioSpscRingBuffer::Release()
+{
+    Wakeup();
+    if (array_ != nullptr) {
+        munmap(array_, static_cast<size_t>(capacity_) * 2);
+        array_ = nullptr;
+    }
+    capacity_ = 0;
+}
+
+uint32_t DaudioSpscRingBuffer::Capacity() const
+{
+    return capacity_;
+}
+
+void DaudioSpscRingBuffer::SetOverflowPolicy(DaudioRingOverflowPolicy policy, uint32_t evictAlign)
+{
+    policy_ = policy;
+    evictAlign_ = evictAlign == 0 ? 1 : evictAlign;
+}
+
+DaudioRingStats DaudioSpscRingBuffer::GetStats() const
+{
+    DaudioRingStats stats;
+    stats.overrunCount = overrunCount_.load(std::memory_order_relaxed);
+    stats.overrunBytes = overrunBytes_.load(std::memory_order_relaxed);
+    stats.underrunCount = underrunCount_.load(std::memory_order_relaxed);
+    stats.highWatermark = highWatermark_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+uint32_t DaudioSpscRingBuffer::CalcCapacity(uint32_t bytesPerMs, uint32_t latencyMs, uint32_t minCapacity)
+{
+    uint64_t capacity = static_cast<uint64_t>(bytesPerMs) * latencyMs;
+    if (capacity < minCapacity) {
+        capacity = minCapacity;
+    }
+    CHECK_AND_RETURN_RET_LOG(capacity > UINT32_MAX / 2, UINT32_MAX / 2, "latency budget is too large.");
+    return static_cast<uint32_t>(capacity);
+}
+
+uint32_t DaudioSpscRingBuffer::ReadableSize() const
+{
+    uint64_t writePos = writePos_.load(std::memory_order_acquire);
+    uint64_t readPos = readPos_.load(std::memory_order_acquire);
+    return static_cast<uint32_t>(writePos - readPos);
+}
+
+uint32_t DaudioSpscRingBuffer::WritableSize() const
+{
+    return capacity_ - ReadableSize();
+}
+
+int32_t DaudioSpscRingBuffer::AcquireWrite(uint32_t len, uint8_t *&data)
+{
+    CHECK_NULL_RETURN(array_, ERR_DH_AUDIO_NULLPTR);
+    uint64_t writePos = writePos_.load(std::memory_order_relaxed);
+    uint64_t readPos = readPos_.load(std::memory_order_acquire);
+    if (len > capacity_ - static_cast<uint32_t>(writePos - readPos)) {
+        if (policy_ == DaudioRingOverflowPolicy::DROP_NEWEST || len > capacity_) {
+            overrunCount_.fetch_add(1, std::memory_order_relaxed);
+            overrunBytes_.fetch_add(len, std::memory_order_relaxed);
+            DHLOGD("buffer is full, drop newest. len: %{public}u.", len);
+            return ERR_DH_AUDIO_FAILED;
+        }
+        EvictOldest(writePos, len);
+    }
+    data = array_ + writePos % capacity_;
+    return DH_SUCCESS;
+}
+
+void DaudioSpscRingBuffer::EvictOldest(uint64_t writePos, uint32_t len)
+{
+    uint64_t readPos = readPos_.load(std::memory_order_acquire);
+    uint64_t target = writePos + len - capacity_;
+    while (readPos < target) {
+        uint64_t newReadPos = (target + evictAlign_ - 1) / evictAlign_ * evictAlign_;
+        if (newReadPos > writePos) {
+            newReadPos = writePos;
+        }
+        if (readPos_.compare_exchange_weak(readPos, newReadPos, std::memory_order_acq_rel,
+            std::memory_order_acquire)) {
+            overrunCount_.fetch_add(1, std::memory_order_relaxed);
+            overrunBytes_.fetch_add(newReadPos - readPos, std::memory_order_relaxed);
+            DHLOGD("buffer is full, evict oldest %{public}" PRIu64 " bytes.", newReadPos - readPos);
+            return;
+        }
+    }
+}
+
+int32_t DaudioSpscRingBuffer::CommitWrite(uint32_t len)
+{
+    CHECK_NULL_RETURN(array_, ERR_DH_AUDIO_NULLPTR);
+    uint64_t writePos = writePos_.load(std::memory_order_relaxed);
+    uint64_t readPos = readPos_.load(std::memory_order_acquire);
+    CHECK_AND_RETURN_RET_LOG(len > capacity_ - static_cast<uint32_t>(writePos - readPos), ERR_DH_AUDIO_BAD_VALUE,
+        "commit len %{public}u exceeds free space.", len);
+    writePos_.store(writePos + len, std::memory_order_release);
+    uint32_t used = static_cast<uint32_t>(writePos + len - readPos);
+    if (used > highWatermark_.load(std::memory_order_relaxed)) {
+        highWatermark_.store(used, std::memory_order_relaxed);
+    }
+    NotifyConsumer();
+    return DH_SUCCESS;
+}
+
+int32_t DaudioSpscRingBuffer::PeekRead(uint32_t len, const uint8_t *&data)
+{
+    CHECK_NULL_RETURN(array_, ERR_DH_AUDIO_NULLPTR);
+    uint64_t readPos = readPos_.load(std::memory_order_acquire);
+    uint64_t writePos = writePos_.load(std::memory_order_acquire);
+    if (len > static_cast<uint32_t>(writePos - readPos)) {
+        underrunCount_.fetch_add(1, std::memory_order_relaxed);
+        DHLOGD("buffer is not enough. len: %{public}u.", len);
+        return ERR_DH_AUDIO_FAILED;
+    }
+    data = array_ + readPos % capacity_;
+    peekPos_ = readPos;
+    hasPeek_ = true;
+    return DH_SUCCESS;
+}
+
+int32_t DaudioSpscRingBuffer::ConsumeRead(uint32_t len)
+{
+    CHECK_NULL_RETURN(array_, ERR_DH_AUDIO_NULLPTR);
+    uint64_t readPos = hasPeek_ ? peekPos_ : readPos_.load(std::memory_order_acquire);
+    hasPeek_ = false;
+    uint64_t writePos = writePos_.load(std::memory_order_acquire);
+    CHECK_AND_RETURN_RET_LOG(len > static_cast<uint32_t>(writePos - readPos), ERR_DH_AUDIO_BAD_VALUE,
+        "consume len %{public}u exceeds readable size.", len);
+    // The producer moves readPos_ forward when it overwrites unread data, so a failed exchange
+    // means the peeked span has been evicted and its contents can no longer be trusted.
+    if (!readPos_.compare_exchange_strong(readPos, readPos + len, std::memory_order_acq_rel,
+        std::memory_order_acquire)) {
+        DHLOGD("peeked data was overwritten by producer.");
+        return ERR_DH_AUDIO_BAD_OPERATE;
+    }
+    return DH_SUCCESS;
+}
+
+int32_t DaudioSpscRingBuffer::Write(const uint8_t *data, uint32_t len)
+{
+    CHECK_NULL_RETURN(data, ERR_DH_AUDIO_NULLPTR);
+    uint8_t *dst = nullptr;
+    int32_t ret = AcquireWrite(len, dst);
+    if (ret != DH_SUCCESS) {
+        return ret;
+    }
+    CHECK_AND_RETURN_RET_LOG(memcpy_s(dst, len, data, len) != EOK, ERR_DH_AUDIO_FAILED, "memcpy_s error.");
+    return CommitWrite(len);
+}
+
+int32_t DaudioSpscRingBuffer::Read(uint8_t *data, uint32_t len)
+{
+    CHECK_NULL_RETURN(data, ERR_DH_AUDIO_NULLPTR);
+    int32_t ret = ERR_DH_AUDIO_BAD_OPERATE;
+    for (uint32_t i = 0; i < READ_RETRY_TIMES && ret == ERR_DH_AUDIO_BAD_OPERATE; i++) {
+        const uint8_t *src = nullptr;
+        ret = PeekRead(len, src);
+        if (ret != DH_SUCCESS) {
+            return ret;
+        }
+        CHECK_AND_RETURN_RET_LOG(memcpy_s(data, len, src, len) != EOK, ERR_DH_AUDIO_FAILED, "memcpy_s error.");
+        ret = ConsumeRead(len);
+    }
+    return ret;
+}
+
+int32_t DaudioSpscRingBuffer::WaitReadable(uint32_t len, int64_t timeoutNs)
+{
+    CHECK_NULL_RETURN(array_, ERR_DH_AUDIO_NULLPTR);
+    uint32_t seq = dataSeq_.load(std::memory_order_acquire);
+    if (ReadableSize() >= len) {
+        return DH_SUCCESS;
+    }
+    waiters_.fetch_add(1, std::memory_order_seq_cst);
+    int32_t ret = FutexWait(dataSeq_, seq, timeoutNs);
+    waiters_.fetch_sub(1, std::memory_order_relaxed);
+    if (ret == ERR_DH_AUDIO_SA_WAIT_TIMEOUT) {
+        underrunCount_.fetch_add(1, std::memory_order_relaxed);
+        return ret;
+    }
+    if (ret != DH_SUCCESS) {
+        return ret;
+    }
+    return ReadableSize() >= len ? DH_SUCCESS : ERR_DH_AUDIO_FAILED;
+}
+
+void DaudioSpscRingBuffer::Wakeup()
+{
+    dataSeq_.fetch_add(1, std::memory_order_seq_cst);
+    FutexWake(dataSeq_, INT32_MAX);
+}
+
+void DaudioSpscRingBuffer::NotifyConsumer()
+{
+    dataSeq_.fetch_add(1, std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_seq_cst) != 0) {
+        FutexWake(dataSeq_, 1);
+    }
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
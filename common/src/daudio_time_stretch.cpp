@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_time_stretch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <securec.h>
+
+#include "audio_param.h"
+#include "daudio_errorcode.h"
+#include "daudio_log.h"
+#include "daudio_util.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DaudioTimeStretch"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr uint32_t STRETCH_MIN_SAMPLE_RATE = 8000;
+// Every SEEK_STRIDE-th sample of the overlap is enough to rank candidate positions.
+constexpr int64_t SEEK_STRIDE = 4;
+// Input already consumed is only compacted once it exceeds this many hops, not on every hop.
+constexpr int64_t TRIM_HOPS = 4;
+constexpr double PLAYOUT_SMOOTH_FACTOR = 8.0;
+constexpr double HALF = 0.5;
+}
+
+int32_t DaudioTimeStretch::Init(const uint32_t sampleRate, const uint32_t channels, const int32_t bitFormat)
+{
+    enabled_ = false;
+    channels_ = 1;
+    frameBytes_ = 1;
+    if (sampleRate < STRETCH_MIN_SAMPLE_RATE || channels == 0 || bitFormat != SAMPLE_S16LE) {
+        DHLOGE("Time stretch not supported, sampleRate: %{public}u, channels: %{public}u, bitFormat: %{public}d.",
+            sampleRate, channels, bitFormat);
+        Reset();
+        return ERR_DH_AUDIO_NOT_SUPPORT;
+    }
+    channels_ = channels;
+    frameBytes_ = sizeof(int16_t) * channels;
+    hop_ = static_cast<int64_t>(sampleRate) * STRETCH_WINDOW_MS / AUDIO_MS_PER_SECOND / 2;
+    seek_ = static_cast<int64_t>(sampleRate) * STRETCH_SEEK_MS / AUDIO_MS_PER_SECOND;
+    fadeIn_.resize(static_cast<size_t>(hop_));
+    for (int64_t t = 0; t < hop_; t++) {
+        fadeIn_[t] = static_cast<float>(HALF - HALF * std::cos(M_PI * (t + HALF) / static_cast<double>(hop_)));
+    }
+    enabled_ = true;
+    Reset();
+    return DH_SUCCESS;
+}
+
+void DaudioTimeStretch::Reset()
+{
+    in_.clear();
+    out_.clear();
+    outOffset_ = 0;
+    prevStart_ = -hop_;
+    analysisPos_ = 0;
+    rate_ = 1.0;
+    stretchedHops_ = 0;
+}
+
+void DaudioTimeStretch::SetRate(const double rate)
+{
+    if (!enabled_) {
+        return;
+    }
+    double newRate = std::clamp(rate, STRETCH_MIN_RATE, STRETCH_MAX_RATE);
+    if (newRate == rate_) {
+        return;
+    }
+    rate_ = newRate;
+    // Re-anchor at the natural continuation so a return to rate 1 is an exact pass-through again.
+    analysisPos_ = static_cast<double>(prevStart_ + hop_);
+}
+
+double DaudioTimeStretch::GetRate() const
+{
+    return rate_;
+}
+
+int32_t DaudioTimeStretch::Push(const uint8_t *data, const size_t len)
+{
+    CHECK_NULL_RETURN(data, ERR_DH_AUDIO_NULLPTR);
+    CHECK_AND_RETURN_RET_LOG(len % frameBytes_ != 0, ERR_DH_AUDIO_BAD_VALUE,
+        "Invalid stretch input len: %{public}zu.", len);
+    std::vector<uint8_t> &dst = enabled_ ? in_ : out_;
+    dst.insert(dst.end(), data, data + len);
+    return DH_SUCCESS;
+}
+
+size_t DaudioTimeStretch::Pull(uint8_t *data, const size_t len)
+{
+    if (data == nullptr) {
+        return 0;
+    }
+    while (enabled_ && out_.size() - outOffset_ < len) {
+        if (!Step()) {
+            break;
+        }
+    }
+    size_t pullLen = std::min(len, out_.size() - outOffset_);
+    pullLen -= pullLen % frameBytes_;
+    if (pullLen == 0) {
+        return 0;
+    }
+    if (memcpy_s(data, len, out_.data() + outOffset_, pullLen) != EOK) {
+        DHLOGE("Copy stretch output failed.");
+        return 0;
+    }
+    outOffset_ += pullLen;
+    if (outOffset_ == out_.size()) {
+        out_.clear();
+        outOffset_ = 0;
+    } else if (outOffset_ > out_.size() / 2) {
+        out_.erase(out_.begin(), out_.begin() + static_cast<std::ptrdiff_t>(outOffset_));
+        outOffset_ = 0;
+    }
+    return pullLen;
+}
+
+size_t DaudioTimeStretch::GetBufferedBytes() const
+{
+    size_t buffered = out_.size() - outOffset_;
+    if (enabled_) {
+        int64_t pending = static_cast<int64_t>(InputFrames()) - (prevStart_ + hop_);
+        buffered += static_cast<size_t>(std::max<int64_t>(pending, 0)) * frameBytes_;
+    }
+    return buffered;
+}
+
+uint64_t DaudioTimeStretch::GetStretchedHops() const
+{
+    return stretchedHops_;
+}
+
+size_t DaudioTimeStretch::InputFrames() const
+{
+    return in_.size() / frameBytes_;
+}
+
+bool DaudioTimeStretch::Step()
+{
+    int64_t natural = prevStart_ + hop_;
+    int64_t nominal = static_cast<int64_t>(std::llround(analysisPos_));
+    int64_t frames = static_cast<int64_t>(InputFrames());
+    if (natural + hop_ > frames || (nominal != natural && nominal + seek_ + hop_ > frames)) {
+        return false;
+    }
+    int64_t best = nominal == natural ? natural : Seek(natural, nominal);
+    const int16_t *src = reinterpret_cast<const int16_t *>(in_.data());
+    size_t outStart = out_.size();
+    out_.resize(outStart + static_cast<size_t>(hop_) * frameBytes_);
+    int16_t *dst = reinterpret_cast<int16_t *>(out_.data() + outStart);
+    for (int64_t t = 0; t < hop_; t++) {
+        float weight = fadeIn_[t];
+        for (uint32_t c = 0; c < channels_; c++) {
+            float tail = src[(natural + t) * channels_ + c];
+            float head = src[(best + t) * channels_ + c];
+            long value = std::lrintf(tail + (head - tail) * weight);
+            dst[t * channels_ + c] = static_cast<int16_t>(std::clamp<long>(value,
+                std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max()));
+        }
+    }
+    if (best != natural) {
+        stretchedHops_++;
+    }
+    prevStart_ = best;
+    analysisPos_ += static_cast<double>(hop_) * rate_;
+    TrimInput();
+    return true;
+}
+
+int64_t DaudioTimeStretch::Seek(const int64_t natural, const int64_t nominal) const
+{
+    const int16_t *src = reinterpret_cast<const int16_t *>(in_.data());
+    auto mono = [src, this](int64_t frame) {
+        float sum = 0;
+        for (uint32_t c = 0; c < channels_; c++) {
+            sum += src[frame * channels_ + c];
+        }
+        return sum;
+    };
+    int64_t best = nominal;
+    double bestScore = -std::numeric_limits<double>::infinity();
+    for (int64_t candidate = std::max<int64_t>(nominal - seek_, 0); candidate <= nominal + seek_; candidate++) {
+        double corr = 0;
+        double energy = 0;
+        for (int64_t t = 0; t < hop_; t += SEEK_STRIDE) {
+            double head = mono(candidate + t);
+            corr += mono(natural + t) * head;
+            energy += head * head;
+        }
+        double score = energy > 0 ? corr / std::sqrt(energy) : 0;
+        if (score > bestScore) {
+            bestScore = score;
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+void DaudioTimeStretch::TrimInput()
+{
+    int64_t drop = std::min(prevStart_ + hop_, static_cast<int64_t>(std::llround(analysisPos_)) - seek_);
+    if (drop < TRIM_HOPS * hop_) {
+        return;
+    }
+    in_.erase(in_.begin(), in_.begin() + static_cast<std::ptrdiff_t>(drop * static_cast<int64_t>(frameBytes_)));
+    prevStart_ -= drop;
+    analysisPos_ -= static_cast<double>(drop);
+}
+
+void DaudioPlayoutController::Reset(const uint32_t targetMs)
+{
+    targetMs_.store(targetMs);
+    bufferedMs_.store(0);
+    smoothedMs_ = 0;
+    isFirstUpdate_ = true;
+}
+
+double DaudioPlayoutController::Update(const uint32_t bufferedMs)
+{
+    bufferedMs_.store(bufferedMs);
+    if (isFirstUpdate_) {
+        smoothedMs_ = bufferedMs;
+        isFirstUpdate_ = false;
+    } else {
+        smoothedMs_ += (static_cast<double>(bufferedMs) - smoothedMs_) / PLAYOUT_SMOOTH_FACTOR;
+    }
+    double error = smoothedMs_ - static_cast<double>(targetMs_.load());
+    if (std::fabs(error) <= PLAYOUT_DEADBAND_MS) {
+        return 1.0;
+    }
+    double excess = error > 0 ? error - PLAYOUT_DEADBAND_MS : error + PLAYOUT_DEADBAND_MS;
+    return 1.0 + std::clamp(excess * PLAYOUT_GAIN_PER_MS, -PLAYOUT_MAX_RATE_DEVIATION, PLAYOUT_MAX_RATE_DEVIATION);
+}
+
+uint32_t DaudioPlayoutController::GetTargetMs() const
+{
+    return targetMs_.load();
+}
+
+uint32_t DaudioPlayoutController::GetBufferedMs() const
+{
+    return bufferedMs_.load();
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include "daudio_util.h"
 
+#include <cerrno>
 #include <cstddef>
 #include <ctime>
 #include <iomanip>
@@ -23,11 +24,14 @@
 #include <random>
 #include <sstream>
 #include <sstream>
+#include <linux/futex.h>
+#include <sys/syscall.h>
 #include <sys/time.h>
 
 #include "softbus_bus_center.h"
 
 #include "audio_event.h"
+#include "audio_param.h"
 #include "daudio_constants.h"
 #include "daudio_errorcode.h"
 #include "daudio_log.h"
@@ -45,6 +49,7 @@ constexpr size_t INT32_SHORT_ID_LENGTH = 20;
 constexpr size_t INT32_MIN_ID_LENGTH = 3;
 constexpr size_t INT32_PLAINTEXT_LENGTH = 4;
 constexpr uint8_t MAX_KEY_DH_ID_LEN = 20;
+constexpr uint32_t BYTES_PER_SAMPLE_S24LE = 3;
 
 std::map<std::string, JsonTypeCheckFunc> typeCheckMap = {
     std::map<std::string, JsonTypeCheckFunc>::value_type(KEY_TYPE, &DistributedHardware::IsInt32),
@@ -67,6 +72,7 @@ std::map<std::string, JsonTypeCheckFunc> typeCheckMap = {
     std::map<std::string, JsonTypeCheckFunc>::value_type(KEY_STREAM_USAGE, &DistributedHardware::IsInt32),
     std::map<std::string, JsonTypeCheckFunc>::value_type(KEY_DATATYPE, &DistributedHardware::IsString),
     std::map<std::string, JsonTypeCheckFunc>::value_type(KEY_CODEC_TYPE, &DistributedHardware::IsInt32),
+    std::map<std::string, JsonTypeCheckFunc>::value_type(KEY_PACKET_FRAMES, &DistributedHardware::IsInt32),
     std::map<std::string, JsonTypeCheckFunc>::value_type(CODEC, &DistributedHardware::IsString),
     std::map<std::string, JsonTypeCheckFunc>::value_type(KEY_USERID, &DistributedHardware::IsInt32),
     std::map<std::string, JsonTypeCheckFunc>::value_type(KEY_TOKENID, &DistributedHardware::IsInt32),
@@ -221,6 +227,28 @@ void GetCurrentTime(int64_t &tvSec, int64_t &tvNSec)
     tvNSec = time.tv_nsec;
 }
 
+int32_t FutexWait(std::atomic<uint32_t> &word, uint32_t expected, int64_t timeoutNs)
+{
+    struct timespec timeout = { 0, 0 };
+    struct timespec *timeoutPtr = nullptr;
+    if (timeoutNs >= 0) {
+        timeout.tv_sec = static_cast<time_t>(timeoutNs / AUDIO_NS_PER_SECOND);
+        timeout.tv_nsec = static_cast<long>(timeoutNs % AUDIO_NS_PER_SECOND);
+        timeoutPtr = &timeout;
+    }
+    long ret = syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT_PRIVATE, expected,
+        timeoutPtr, nullptr, 0);
+    if (ret != 0 && errno == ETIMEDOUT) {
+        return ERR_DH_AUDIO_SA_WAIT_TIMEOUT;
+    }
+    return DH_SUCCESS;
+}
+
+void FutexWake(std::atomic<uint32_t> &word, int32_t count)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+
 int64_t GetNowTimeUs()
 {
     std::chrono::microseconds nowUs =
@@ -367,6 +395,25 @@ int32_t CalculateSampleNum(uint32_t sampleRate, uint32_t timems)
     return static_cast<int32_t>(result);
 }
 
+uint32_t GetBytesPerSample(int32_t bitFormat)
+{
+    switch (bitFormat) {
+        case SAMPLE_U8:
+            return sizeof(uint8_t);
+        case SAMPLE_S16LE:
+            return sizeof(int16_t);
+        case SAMPLE_S24LE:
+            return BYTES_PER_SAMPLE_S24LE;
+        case SAMPLE_S32LE:
+            return sizeof(int32_t);
+        case SAMPLE_F32LE:
+            return sizeof(float);
+        default:
+            DHLOGE("Unknown bit format: %{public}d.", bitFormat);
+            return 0;
+    }
+}
+
 int64_t GetCurNano()
 {
     int64_t result = -1;
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_aec_test.h"
+
+#include <cinttypes>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "audio_param.h"
+#include "daudio_errorcode.h"
+#include "daudio_log.h"
+#include "daudio_util.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DAudioAecTest"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr uint32_t TEST_RATE_16K = 16000;
+constexpr uint32_t TEST_RATE_48K = 48000;
+constexpr uint32_t TEST_FRAME_MS = 20;
+constexpr uint32_t TEST_CONVERGE_FRAMES = 250;
+constexpr uint32_t TEST_MEASURE_FRAMES = 50;
+constexpr uint32_t TEST_BENCH_FRAMES = 500;
+constexpr uint32_t TEST_ECHO_DELAY_MS = 8;
+constexpr uint32_t TEST_ECHO_TAIL_MS = 24;
+constexpr float TEST_ECHO_DECAY_MS = 6.0f;
+constexpr float TEST_ECHO_GAIN = 0.5f;
+constexpr float TEST_AMPLITUDE = 6000.0f;
+constexpr double TEST_MIN_ERLE_DB = 20.0;
+constexpr double TEST_PASS_TOLERANCE_DB = 0.5;
+constexpr uint32_t TEST_LOWPASS_HALF_TAPS = 48;
+constexpr double TEST_LOWPASS_CUTOFF = 0.2;
+constexpr uint32_t TEST_SEED = 23;
+
+/*
+ * Plays band-limited noise at the reference rate and captures it at the mic rate through a fixed
+ * room response: a bulk delay followed by an exponentially decaying random tail.
+ */
+class EchoRoom {
+public:
+    EchoRoom(uint32_t refRate, uint32_t refChannels, uint32_t micRate, uint32_t micChannels)
+        : refRate_(refRate), refChannels_(refChannels), micRate_(micRate), micChannels_(micChannels), rng_(TEST_SEED)
+    {
+        std::normal_distribution<double> dist(0.0, 1.0);
+        uint32_t delay = micRate * TEST_ECHO_DELAY_MS / 1000;
+        uint32_t tail = micRate * TEST_ECHO_TAIL_MS / 1000;
+        response_.assign(delay + tail, 0.0);
+        double energy = 0;
+        for (uint32_t i = 0; i < tail; i++) {
+            double value = dist(rng_) * std::exp(-1000.0 * i / micRate / TEST_ECHO_DECAY_MS);
+            response_[delay + i] = value;
+            energy += value * value;
+        }
+        for (auto &value : response_) {
+            value *= TEST_ECHO_GAIN / std::sqrt(energy);
+        }
+        // Keep the played noise inside the band both rates can carry.
+        int32_t half = static_cast<int32_t>(TEST_LOWPASS_HALF_TAPS);
+        for (int32_t k = -half; k <= half; k++) {
+            double x = 2.0 * TEST_LOWPASS_CUTOFF * k * micRate / refRate;
+            double sinc = k == 0 ? 1.0 : std::sin(M_PI * x) / (M_PI * x);
+            lowpass_.push_back(sinc * (0.5 + 0.5 * std::cos(M_PI * k / (half + 1))) * 2.0 * TEST_LOWPASS_CUTOFF *
+                micRate / refRate);
+        }
+    }
+
+    void Next(bool playing, std::vector<int16_t> &ref, std::vector<int16_t> &mic, float nearEnd = 0.0f)
+    {
+        std::normal_distribution<double> dist(0.0, TEST_AMPLITUDE);
+        uint32_t refFrames = refRate_ * TEST_FRAME_MS / 1000;
+        uint32_t ratio = refRate_ / micRate_;
+        ref.resize(refFrames * refChannels_);
+        mic.resize(refFrames / ratio * micChannels_);
+        for (uint32_t i = 0; i < refFrames; i++) {
+            noise_.push_back(playing ? dist(rng_) : 0.0);
+            double value = 0;
+            for (size_t k = 0; k < lowpass_.size() && k < noise_.size(); k++) {
+                value += lowpass_[k] * noise_[noise_.size() - 1 - k];
+            }
+            for (uint32_t ch = 0; ch < refChannels_; ch++) {
+                ref[i * refChannels_ + ch] = static_cast<int16_t>(value);
+            }
+            if ((played_.size() + 1) % ratio == 0 || ratio == 1) {
+                captured_.push_back(value);
+            }
+            played_.push_back(value);
+        }
+        for (uint32_t i = 0; i < refFrames / ratio; i++) {
+            size_t pos = captured_.size() - refFrames / ratio + i;
+            double echo = 0;
+            for (size_t k = 0; k < response_.size() && k <= pos; k++) {
+                echo += response_[k] * captured_[pos - k];
+            }
+            double near = nearEnd * dist(rng_);
+            for (uint32_t ch = 0; ch < micChannels_; ch++) {
+                mic[i * micChannels_ + ch] = static_cast<int16_t>(echo + near);
+            }
+        }
+    }
+
+private:
+    uint32_t refRate_;
+    uint32_t refChannels_;
+    uint32_t micRate_;
+    uint32_t micChannels_;
+    std::mt19937 rng_;
+    std::vector<double> response_;
+    std::vector<double> lowpass_;
+    std::vector<double> noise_;
+    std::vector<double> played_;
+    std::vector<double> captured_;
+};
+
+static double Energy(const std::vector<int16_t> &data)
+{
+    double sum = 0;
+    for (auto value : data) {
+        sum += static_cast<double>(value) * value;
+    }
+    return sum;
+}
+
+static double MeasureErleDb(uint32_t refRate, uint32_t refChannels, uint32_t micRate, uint32_t micChannels)
+{
+    DaudioAec aec;
+    if (aec.Init(refRate, refChannels, micRate, micChannels, SAMPLE_S16LE) != DH_SUCCESS) {
+        return 0;
+    }
+    EchoRoom room(refRate, refChannels, micRate, micChannels);
+    std::vector<int16_t> ref;
+    std::vector<int16_t> mic;
+    std::vector<int16_t> out;
+    double micEnergy = 0;
+    double outEnergy = 0;
+    for (uint32_t i = 0; i < TEST_CONVERGE_FRAMES + TEST_MEASURE_FRAMES; i++) {
+        room.Next(true, ref, mic);
+        out.resize(mic.size());
+        aec.PushReference(reinterpret_cast<uint8_t *>(ref.data()), ref.size() * sizeof(int16_t));
+        size_t len = mic.size() * sizeof(int16_t);
+        if (aec.Process(reinterpret_cast<uint8_t *>(mic.data()), len, reinterpret_cast<uint8_t *>(out.data()),
+            len) != len) {
+            return 0;
+        }
+        if (i >= TEST_CONVERGE_FRAMES) {
+            micEnergy += Energy(mic);
+            outEnergy += Energy(out);
+        }
+    }
+    return 10.0 * std::log10(micEnergy / std::max(outEnergy, 1.0));
+}
+
+static int64_t MeasureFrameUs(uint32_t micRate, uint32_t micChannels)
+{
+    DaudioAec aec;
+    if (aec.Init(TEST_RATE_48K, STEREO, micRate, micChannels, SAMPLE_S16LE) != DH_SUCCESS) {
+        return -1;
+    }
+    EchoRoom room(TEST_RATE_48K, STEREO, micRate, micChannels);
+    std::vector<int16_t> ref;
+    std::vector<int16_t> mic;
+    room.Next(true, ref, mic);
+    std::vector<int16_t> out(mic.size());
+    size_t len = mic.size() * sizeof(int16_t);
+    int64_t start = GetCurNano();
+    for (uint32_t i = 0; i < TEST_BENCH_FRAMES; i++) {
+        aec.PushReference(reinterpret_cast<uint8_t *>(ref.data()), ref.size() * sizeof(int16_t));
+        aec.Process(reinterpret_cast<uint8_t *>(mic.data()), len, reinterpret_cast<uint8_t *>(out.data()), len);
+    }
+    return (GetCurNano() - start) / TEST_BENCH_FRAMES / (AUDIO_NS_PER_SECOND / AUDIO_US_PER_SECOND);
+}
+
+void DAudioAecTest::SetUpTestCase(void) {}
+
+void DAudioAecTest::TearDownTestCase(void) {}
+
+void DAudioAecTest::SetUp(void) {}
+
+void DAudioAecTest::TearDown(void) {}
+
+/**
+ * @tc.name: Init_001
+ * @tc.desc: Verify unsupported formats are rejected and leave the canceller passing the mic through.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioAecTest, Init_001, TestSize.Level0)
+{
+    DaudioAec aec;
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_SUPPORT, aec.Init(TEST_RATE_48K, STEREO, TEST_RATE_16K, MONO, SAMPLE_S24LE));
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_SUPPORT, aec.Init(TEST_RATE_16K, STEREO, TEST_RATE_48K, MONO, SAMPLE_S16LE));
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_SUPPORT, aec.Init(SAMPLE_RATE_44100, STEREO, TEST_RATE_16K, MONO, SAMPLE_S16LE));
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_SUPPORT, aec.Init(TEST_RATE_48K, 0, TEST_RATE_16K, MONO, SAMPLE_S16LE));
+
+    std::vector<int16_t> mic = { 1, -2, 3, -4 };
+    std::vector<int16_t> out(mic.size());
+    size_t len = mic.size() * sizeof(int16_t);
+    EXPECT_EQ(0, aec.Process(nullptr, len, reinterpret_cast<uint8_t *>(out.data()), len));
+    EXPECT_EQ(0, aec.Process(reinterpret_cast<uint8_t *>(mic.data()), len, reinterpret_cast<uint8_t *>(out.data()),
+        len - 1));
+    EXPECT_EQ(len, aec.Process(reinterpret_cast<uint8_t *>(mic.data()), len,
+        reinterpret_cast<uint8_t *>(out.data()), len));
+    EXPECT_EQ(mic, out);
+
+    EXPECT_EQ(DH_SUCCESS, aec.Init(TEST_RATE_48K, STEREO, TEST_RATE_16K, MONO, SAMPLE_S16LE));
+    EXPECT_EQ(64U, aec.GetBlockFrames());
+    EXPECT_NE(nullptr, DaudioAec::GetKernelName());
+}
+
+/**
+ * @tc.name: Process_001
+ * @tc.desc: Verify the echo of a same-rate reference is attenuated by at least 20 dB once converged.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioAecTest, Process_001, TestSize.Level1)
+{
+    EXPECT_GE(MeasureErleDb(TEST_RATE_16K, MONO, TEST_RATE_16K, MONO), TEST_MIN_ERLE_DB);
+}
+
+/**
+ * @tc.name: Process_002
+ * @tc.desc: Verify the echo of a 48 kHz stereo reference is attenuated in 16 kHz and 48 kHz captures.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioAecTest, Process_002, TestSize.Level1)
+{
+    EXPECT_GE(MeasureErleDb(TEST_RATE_48K, STEREO, TEST_RATE_16K, MONO), TEST_MIN_ERLE_DB);
+    EXPECT_GE(MeasureErleDb(TEST_RATE_48K, STEREO, TEST_RATE_48K, STEREO), TEST_MIN_ERLE_DB);
+}
+
+/**
+ * @tc.name: Process_003
+ * @tc.desc: Verify near-end speech passes unchanged while the reference is silent.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioAecTest, Process_003, TestSize.Level1)
+{
+    DaudioAec aec;
+    ASSERT_EQ(DH_SUCCESS, aec.Init(TEST_RATE_48K, STEREO, TEST_RATE_16K, MONO, SAMPLE_S16LE));
+    EchoRoom room(TEST_RATE_48K, STEREO, TEST_RATE_16K, MONO);
+    std::vector<int16_t> ref;
+    std::vector<int16_t> mic;
+    std::vector<int16_t> out;
+    double micEnergy = 0;
+    double outEnergy = 0;
+    for (uint32_t i = 0; i < TEST_MEASURE_FRAMES; i++) {
+        room.Next(false, ref, mic, 1.0f);
+        out.resize(mic.size());
+        aec.PushReference(reinterpret_cast<uint8_t *>(ref.data()), ref.size() * sizeof(int16_t));
+        size_t len = mic.size() * sizeof(int16_t);
+        ASSERT_EQ(len, aec.Process(reinterpret_cast<uint8_t *>(mic.data()), len,
+            reinterpret_cast<uint8_t *>(out.data()), len));
+        if (i > 0) {
+            micEnergy += Energy(mic);
+            outEnergy += Energy(out);
+        }
+    }
+    EXPECT_NEAR(0.0, 10.0 * std::log10(micEnergy / outEnergy), TEST_PASS_TOLERANCE_DB);
+}
+
+/**
+ * @tc.name: Benchmark_001
+ * @tc.desc: Measure the processing time of one 20 ms frame at 16 kHz and 48 kHz against a 48 kHz reference.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioAecTest, Benchmark_001, TestSize.Level1)
+{
+    int64_t us16k = MeasureFrameUs(TEST_RATE_16K, MONO);
+    int64_t us48k = MeasureFrameUs(TEST_RATE_48K, MONO);
+    DHLOGI("Aec kernel: %{public}s, us per 20 ms frame, 16 kHz: %{public}" PRId64 ", 48 kHz: %{public}" PRId64 ".",
+        DaudioAec::GetKernelName(), us16k, us48k);
+    RecordProperty("kernel", DaudioAec::GetKernelName());
+    RecordProperty("us_per_frame_16k", std::to_string(us16k));
+    RecordProperty("us_per_frame_48k", std::to_string(us48k));
+    EXPECT_GE(us16k, 0);
+    EXPECT_GE(us48k, 0);
+    EXPECT_LT(us16k, TEST_FRAME_MS * 1000);
+    EXPECT_LT(us48k, TEST_FRAME_MS * 1000);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_asrc_test.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "audio_param.h"
+#include "daudio_errorcode.h"
+#include "daudio_util.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr uint32_t TEST_SAMPLE_RATE = 48000;
+constexpr uint32_t TEST_CHANNELS = 2;
+constexpr size_t TEST_FRAME_SAMPLES = 960;
+constexpr size_t TEST_FRAME_BYTES = TEST_FRAME_SAMPLES * TEST_CHANNELS * sizeof(int16_t);
+constexpr size_t TEST_FRAME_NUM = 50;
+constexpr double TEST_TONE_HZ = 440.0;
+constexpr double TEST_AMPLITUDE = 10000.0;
+constexpr int32_t TEST_MAX_ERROR = 20;
+constexpr int64_t TEST_PACKET_US = 20000;
+constexpr int64_t TEST_PERIOD_US = 10000;
+constexpr int64_t TEST_MAX_JITTER_US = 15000;
+constexpr int64_t TEST_MAX_WAKEUP_US = 1000;
+constexpr int64_t TEST_DURATION_US = 120000000;
+constexpr int64_t TEST_PAUSE_US = 5000000;
+constexpr double TEST_PPM_TOLERANCE = 10.0;
+constexpr int64_t NS_PER_US = AUDIO_NS_PER_SECOND / AUDIO_US_PER_SECOND;
+
+static std::vector<int16_t> MakeTone(size_t samples)
+{
+    std::vector<int16_t> tone(samples * TEST_CHANNELS);
+    for (size_t i = 0; i < samples; i++) {
+        int16_t value = static_cast<int16_t>(TEST_AMPLITUDE * std::sin(2 * M_PI * TEST_TONE_HZ * i / TEST_SAMPLE_RATE));
+        for (uint32_t c = 0; c < TEST_CHANNELS; c++) {
+            tone[i * TEST_CHANNELS + c] = value;
+        }
+    }
+    return tone;
+}
+
+static std::vector<int16_t> RunAsrc(DaudioAsrc &asrc, const std::vector<int16_t> &input)
+{
+    std::vector<int16_t> output;
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(input.data());
+    std::vector<int16_t> frame(asrc.GetMaxOutputBytes(TEST_FRAME_BYTES) / sizeof(int16_t));
+    for (size_t i = 0; i < input.size() * sizeof(int16_t) / TEST_FRAME_BYTES; i++) {
+        size_t len = asrc.Process(src + i * TEST_FRAME_BYTES, TEST_FRAME_BYTES,
+            reinterpret_cast<uint8_t *>(frame.data()), frame.size() * sizeof(int16_t));
+        output.insert(output.end(), frame.begin(), frame.begin() + len / sizeof(int16_t));
+    }
+    return output;
+}
+
+/*
+ * Producer packets leave every TEST_PACKET_US of producer time and arrive up to TEST_MAX_JITTER_US
+ * later; the consumer takes one period every TEST_PERIOD_US of local time, woken up to
+ * TEST_MAX_WAKEUP_US late. Nothing is reported for pauseUs from the middle of the run on.
+ */
+static double SimulateDrift(double driftPpm, int64_t pauseUs = 0)
+{
+    DaudioDriftEstimator estimator;
+    estimator.Reset(TEST_SAMPLE_RATE);
+    uint64_t packetFrames = TEST_SAMPLE_RATE * TEST_PACKET_US / AUDIO_US_PER_SECOND;
+    uint64_t periodFrames = TEST_SAMPLE_RATE * TEST_PERIOD_US / AUDIO_US_PER_SECOND;
+    std::srand(1);
+    double producerScale = 1.0 / (1.0 + driftPpm / 1000000.0);
+    int64_t packetIndex = 0;
+    int64_t nextArrival = 0;
+    int64_t pauseStart = TEST_DURATION_US / 2;
+    int64_t pauseEnd = pauseStart + pauseUs;
+    for (int64_t now = 0; now < TEST_DURATION_US; now += TEST_PERIOD_US) {
+        int64_t wakeup = now + std::rand() % TEST_MAX_WAKEUP_US;
+        bool isPaused = wakeup >= pauseStart && wakeup < pauseEnd;
+        while (nextArrival <= wakeup) {
+            if (!isPaused) {
+                estimator.OnProduced(packetFrames, nextArrival * NS_PER_US);
+            }
+            packetIndex++;
+            nextArrival = static_cast<int64_t>(packetIndex * TEST_PACKET_US * producerScale) +
+                std::rand() % TEST_MAX_JITTER_US;
+        }
+        if (!isPaused) {
+            estimator.OnConsumed(periodFrames, wakeup * NS_PER_US);
+        }
+    }
+    return estimator.GetDriftPpm();
+}
+
+void DAudioAsrcTest::SetUpTestCase(void) {}
+
+void DAudioAsrcTest::TearDownTestCase(void) {}
+
+void DAudioAsrcTest::SetUp(void) {}
+
+void DAudioAsrcTest::TearDown(void) {}
+
+/**
+ * @tc.name: Init_001
+ * @tc.desc: Verify unsupported formats are rejected and bypassed, and a ratio of 1 keeps the bypass.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioAsrcTest, Init_001, TestSize.Level1)
+{
+    DaudioAsrc asrc;
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_SUPPORT, asrc.Init(TEST_CHANNELS, SAMPLE_U8));
+    asrc.SetRatio(1.0 + DaudioAsrc::ASRC_MAX_RATIO_DEVIATION);
+    EXPECT_FALSE(asrc.IsEngaged());
+    uint8_t input[3] = {1, 2, 3};
+    uint8_t output[3] = {0};
+    EXPECT_EQ(0, asrc.Process(nullptr, sizeof(input), output, sizeof(output)));
+    EXPECT_EQ(sizeof(input), asrc.Process(input, sizeof(input), output, sizeof(output)));
+    EXPECT_EQ(3, output[2]);
+
+    ASSERT_EQ(DH_SUCCESS, asrc.Init(TEST_CHANNELS, SAMPLE_S16LE));
+    asrc.SetRatio(1.0);
+    EXPECT_FALSE(asrc.IsEngaged());
+    auto tone = MakeTone(TEST_FRAME_SAMPLES * TEST_FRAME_NUM);
+    EXPECT_EQ(tone, RunAsrc(asrc, tone));
+}
+
+/**
+ * @tc.name: Process_001
+ * @tc.desc: Verify an engaged converter at ratio 1 only delays the input by the filter half length.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioAsrcTest, Process_001, TestSize.Level1)
+{
+    DaudioAsrc asrc;
+    ASSERT_EQ(DH_SUCCESS, asrc.Init(TEST_CHANNELS, SAMPLE_S16LE));
+    asrc.SetRatio(1.0 + DaudioAsrc::ASRC_MAX_RATIO_DEVIATION);
+    asrc.SetRatio(1.0);
+    EXPECT_TRUE(asrc.IsEngaged());
+    auto input = MakeTone(TEST_FRAME_SAMPLES * TEST_FRAME_NUM);
+    auto output = RunAsrc(asrc, input);
+    ASSERT_EQ(input.size() - DaudioAsrc::ASRC_HALF_TAPS * TEST_CHANNELS, output.size());
+    EXPECT_TRUE(std::equal(output.begin(), output.end(), input.begin()));
+}
+
+/**
+ * @tc.name: Process_002
+ * @tc.desc: Verify a fractional ratio changes the frame count accordingly and keeps the waveform.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioAsrcTest, Process_002, TestSize.Level1)
+{
+    auto input = MakeTone(TEST_FRAME_SAMPLES * TEST_FRAME_NUM);
+    double inputFrames = static_cast<double>(input.size() / TEST_CHANNELS);
+    for (double ratio : { 1.0005, 0.9995 }) {
+        DaudioAsrc asrc;
+        ASSERT_EQ(DH_SUCCESS, asrc.Init(TEST_CHANNELS, SAMPLE_S16LE));
+        asrc.SetRatio(ratio);
+        EXPECT_EQ(ratio, asrc.GetRatio());
+        auto output = RunAsrc(asrc, input);
+        size_t outputFrames = output.size() / TEST_CHANNELS;
+        EXPECT_NEAR(inputFrames / ratio, static_cast<double>(outputFrames), DaudioAsrc::ASRC_TAPS);
+        int32_t maxError = 0;
+        for (size_t i = DaudioAsrc::ASRC_TAPS; i < outputFrames; i++) {
+            double expected = TEST_AMPLITUDE * std::sin(2 * M_PI * TEST_TONE_HZ * i * ratio / TEST_SAMPLE_RATE);
+            maxError = std::max(maxError, std::abs(output[i * TEST_CHANNELS] - static_cast<int32_t>(expected)));
+        }
+        EXPECT_LE(maxError, TEST_MAX_ERROR);
+    }
+}
+
+/**
+ * @tc.name: DriftEstimator_001
+ * @tc.desc: Verify the estimator recovers a ppm-level drift from jittery arrivals.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioAsrcTest, DriftEstimator_001, TestSize.Level1)
+{
+    DaudioDriftEstimator estimator;
+    estimator.Reset(TEST_SAMPLE_RATE);
+    estimator.OnProduced(TEST_SAMPLE_RATE, 0);
+    estimator.OnConsumed(TEST_SAMPLE_RATE, 0);
+    EXPECT_EQ(0, estimator.GetDriftPpm());
+    EXPECT_EQ(1.0, estimator.GetRatio());
+
+    for (double driftPpm : { 100.0, 0.0, -50.0 }) {
+        EXPECT_NEAR(driftPpm, SimulateDrift(driftPpm), TEST_PPM_TOLERANCE);
+    }
+}
+
+/**
+ * @tc.name: DriftEstimator_002
+ * @tc.desc: Verify a pause in the middle of the stream does not disturb the estimate.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioAsrcTest, DriftEstimator_002, TestSize.Level1)
+{
+    double driftPpm = 100.0;
+    EXPECT_NEAR(driftPpm, SimulateDrift(driftPpm, TEST_PAUSE_US), TEST_PPM_TOLERANCE);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
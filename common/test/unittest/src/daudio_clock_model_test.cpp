@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_clock_model_test.h"
+
+#include <cmath>
+#include <cstdlib>
+
+#include "daudio_util.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr uint32_t TEST_SAMPLE_RATE = 44100;
+constexpr uint64_t TEST_BUFFER_FRAMES = 441;
+constexpr uint32_t TEST_BUFFER_NUM = 2000;
+constexpr int64_t TEST_START_NS = 5000000000;
+constexpr int64_t TEST_MAX_JITTER_NS = 300000;
+constexpr int64_t TEST_LATE_NS = 20000000;
+constexpr double TEST_DRIFT_PPM = 100.0;
+constexpr double TEST_PPM_TOLERANCE = 20.0;
+constexpr int64_t TEST_MAX_ERROR_NS = 100000;
+constexpr int64_t TEST_MAX_STEP_ERROR_NS = 20000;
+
+static int64_t CaptureTimeNs(uint64_t framePosition, double driftPpm)
+{
+    double nsPerFrame = static_cast<double>(AUDIO_NS_PER_SECOND) / TEST_SAMPLE_RATE / (1.0 + driftPpm / 1000000.0);
+    return TEST_START_NS + static_cast<int64_t>(framePosition * nsPerFrame);
+}
+
+void DAudioClockModelTest::SetUpTestCase(void) {}
+
+void DAudioClockModelTest::TearDownTestCase(void) {}
+
+void DAudioClockModelTest::SetUp(void) {}
+
+void DAudioClockModelTest::TearDown(void) {}
+
+/**
+ * @tc.name: AddSample_001
+ * @tc.desc: Verify the model starts from the first sample at the nominal rate and ignores invalid input.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioClockModelTest, AddSample_001, TestSize.Level0)
+{
+    DaudioClockModel model;
+    model.Reset(TEST_SAMPLE_RATE);
+    EXPECT_FALSE(model.IsValid());
+    EXPECT_EQ(0, model.GetTimeNs(0));
+    model.AddSample(0, 0);
+    EXPECT_FALSE(model.IsValid());
+
+    model.AddSample(TEST_BUFFER_FRAMES, TEST_START_NS);
+    EXPECT_TRUE(model.IsValid());
+    EXPECT_EQ(TEST_START_NS, model.GetTimeNs(TEST_BUFFER_FRAMES));
+    EXPECT_EQ(TEST_START_NS - AUDIO_NS_PER_SECOND / 100, model.GetTimeNs(0));
+    EXPECT_EQ(TEST_START_NS + AUDIO_NS_PER_SECOND, model.GetTimeNs(TEST_BUFFER_FRAMES + TEST_SAMPLE_RATE));
+
+    DaudioClockModel idle;
+    idle.Reset(0);
+    idle.AddSample(TEST_BUFFER_FRAMES, TEST_START_NS);
+    EXPECT_FALSE(idle.IsValid());
+}
+
+/**
+ * @tc.name: AddSample_002
+ * @tc.desc: Verify the fitted line tracks a drifting clock from jittered timestamps and moves smoothly.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioClockModelTest, AddSample_002, TestSize.Level0)
+{
+    DaudioClockModel model;
+    model.Reset(TEST_SAMPLE_RATE);
+    std::srand(1);
+    int64_t lastPtsNs = 0;
+    int64_t maxStepErrorNs = 0;
+    int64_t maxErrorNs = 0;
+    double bufferNs = TEST_BUFFER_FRAMES * static_cast<double>(AUDIO_NS_PER_SECOND) / TEST_SAMPLE_RATE;
+    for (uint32_t i = 1; i <= TEST_BUFFER_NUM; i++) {
+        uint64_t position = i * TEST_BUFFER_FRAMES;
+        int64_t jitterNs = std::rand() % (2 * TEST_MAX_JITTER_NS) - TEST_MAX_JITTER_NS;
+        model.AddSample(position, CaptureTimeNs(position, TEST_DRIFT_PPM) + jitterNs);
+        int64_t ptsNs = model.GetTimeNs(position - TEST_BUFFER_FRAMES);
+        if (i > DaudioClockModel::CLOCK_WINDOW_SAMPLES) {
+            int64_t stepErrorNs = std::llabs(ptsNs - lastPtsNs - static_cast<int64_t>(bufferNs));
+            maxStepErrorNs = std::max(maxStepErrorNs, stepErrorNs);
+            int64_t errorNs = std::llabs(ptsNs - CaptureTimeNs(position - TEST_BUFFER_FRAMES, TEST_DRIFT_PPM));
+            maxErrorNs = std::max(maxErrorNs, errorNs);
+        }
+        lastPtsNs = ptsNs;
+    }
+    EXPECT_NEAR(TEST_DRIFT_PPM, model.GetRatePpm(), TEST_PPM_TOLERANCE);
+    EXPECT_LT(maxErrorNs, TEST_MAX_ERROR_NS);
+    EXPECT_LT(maxStepErrorNs, TEST_MAX_STEP_ERROR_NS);
+}
+
+/**
+ * @tc.name: AddSample_003
+ * @tc.desc: Verify a single late timestamp is dropped and a backwards position restarts the model.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioClockModelTest, AddSample_003, TestSize.Level0)
+{
+    DaudioClockModel model;
+    model.Reset(TEST_SAMPLE_RATE);
+    uint64_t position = 0;
+    for (uint32_t i = 1; i <= DaudioClockModel::CLOCK_MIN_SAMPLES; i++) {
+        position = i * TEST_BUFFER_FRAMES;
+        model.AddSample(position, CaptureTimeNs(position, 0));
+    }
+    uint64_t next = position + TEST_BUFFER_FRAMES;
+    int64_t expectNs = model.GetTimeNs(next);
+    model.AddSample(next, CaptureTimeNs(next, 0) + TEST_LATE_NS);
+    EXPECT_EQ(expectNs, model.GetTimeNs(next));
+
+    model.AddSample(TEST_BUFFER_FRAMES, TEST_START_NS + TEST_LATE_NS);
+    EXPECT_EQ(TEST_START_NS + TEST_LATE_NS, model.GetTimeNs(TEST_BUFFER_FRAMES));
+    EXPECT_EQ(0, model.GetRatePpm());
+}
+
+/**
+ * @tc.name: AddSample_004
+ * @tc.desc: Verify a clock that keeps its new offset for CLOCK_MAX_OUTLIERS samples is followed.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioClockModelTest, AddSample_004, TestSize.Level0)
+{
+    DaudioClockModel model;
+    model.Reset(TEST_SAMPLE_RATE);
+    uint64_t position = 0;
+    for (uint32_t i = 1; i <= DaudioClockModel::CLOCK_MIN_SAMPLES; i++) {
+        position = i * TEST_BUFFER_FRAMES;
+        model.AddSample(position, CaptureTimeNs(position, 0));
+    }
+    for (uint32_t i = 0; i < DaudioClockModel::CLOCK_MAX_OUTLIERS; i++) {
+        position += TEST_BUFFER_FRAMES;
+        model.AddSample(position, CaptureTimeNs(position, 0) + TEST_LATE_NS);
+    }
+    EXPECT_EQ(CaptureTimeNs(position, 0) + TEST_LATE_NS, model.GetTimeNs(position));
+}
+} // namespace DistributedHardware
+} // namespace OHOS
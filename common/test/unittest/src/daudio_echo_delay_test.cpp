@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_echo_delay_test.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "audio_param.h"
+#include "daudio_errorcode.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr uint32_t TEST_FFT_SIZE = 1024;
+constexpr float TEST_FFT_TOLERANCE = 1e-4f;
+constexpr uint32_t TEST_REF_RATE = 48000;
+constexpr uint32_t TEST_REF_CHANNELS = 2;
+constexpr uint32_t TEST_MIC_RATE = 16000;
+constexpr uint32_t TEST_MIC_CHANNELS = 1;
+constexpr uint32_t TEST_RATE_RATIO = TEST_REF_RATE / TEST_MIC_RATE;
+constexpr uint32_t TEST_FRAME_MS = 20;
+constexpr uint32_t TEST_REF_FRAMES = TEST_REF_RATE * TEST_FRAME_MS / 1000;
+constexpr uint32_t TEST_MIC_FRAMES = TEST_MIC_RATE * TEST_FRAME_MS / 1000;
+constexpr uint32_t TEST_CONVERGE_FRAMES = 200;
+constexpr int64_t TEST_DELAY_US = 180000;
+constexpr int64_t TEST_NEW_DELAY_US = 320000;
+constexpr int64_t TEST_TOLERANCE_US = 1000;
+constexpr float TEST_NOISE_AMPLITUDE = 8000.0f;
+constexpr float TEST_ECHO_GAIN = 0.5f;
+constexpr uint32_t TEST_SEED = 20;
+
+/*
+ * Plays white noise through a simulated echo path: the capture at TEST_MIC_RATE mono is the
+ * reference delayed by delayUs, box-averaged down from TEST_REF_RATE and attenuated.
+ */
+class EchoPath {
+public:
+    explicit EchoPath(uint32_t seed) : rng_(seed) {}
+
+    void Next(int64_t delayUs, std::vector<int16_t> &ref, std::vector<int16_t> &mic)
+    {
+        std::uniform_real_distribution<float> dist(-TEST_NOISE_AMPLITUDE, TEST_NOISE_AMPLITUDE);
+        ref.resize(TEST_REF_FRAMES * TEST_REF_CHANNELS);
+        for (uint32_t i = 0; i < TEST_REF_FRAMES; i++) {
+            int16_t value = static_cast<int16_t>(dist(rng_));
+            played_.push_back(value);
+            for (uint32_t ch = 0; ch < TEST_REF_CHANNELS; ch++) {
+                ref[i * TEST_REF_CHANNELS + ch] = value;
+            }
+        }
+        int64_t delayFrames = delayUs * TEST_REF_RATE / 1000000;
+        int64_t base = static_cast<int64_t>(played_.size()) - TEST_REF_FRAMES - delayFrames;
+        mic.resize(TEST_MIC_FRAMES * TEST_MIC_CHANNELS);
+        for (uint32_t i = 0; i < TEST_MIC_FRAMES; i++) {
+            float sum = 0;
+            for (uint32_t k = 0; k < TEST_RATE_RATIO; k++) {
+                int64_t pos = base + i * TEST_RATE_RATIO + k;
+                sum += pos >= 0 ? played_[pos] : 0;
+            }
+            mic[i] = static_cast<int16_t>(sum / TEST_RATE_RATIO * TEST_ECHO_GAIN);
+        }
+    }
+
+private:
+    std::mt19937 rng_;
+    std::vector<int16_t> played_;
+};
+
+static void RunEchoPath(DaudioEchoDelayEstimator &estimator, EchoPath &path, int64_t delayUs, uint32_t frames)
+{
+    std::vector<int16_t> ref;
+    std::vector<int16_t> mic;
+    for (uint32_t i = 0; i < frames; i++) {
+        path.Next(delayUs, ref, mic);
+        estimator.PushReference(reinterpret_cast<uint8_t *>(ref.data()), ref.size() * sizeof(int16_t));
+        estimator.PushCapture(reinterpret_cast<uint8_t *>(mic.data()), mic.size() * sizeof(int16_t));
+    }
+}
+
+void DAudioEchoDelayTest::SetUpTestCase(void) {}
+
+void DAudioEchoDelayTest::TearDownTestCase(void) {}
+
+void DAudioEchoDelayTest::SetUp(void) {}
+
+void DAudioEchoDelayTest::TearDown(void) {}
+
+/**
+ * @tc.name: Fft_001
+ * @tc.desc: Verify the fft rejects invalid sizes, transforms an impulse to a flat spectrum and inverts exactly.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioEchoDelayTest, Fft_001, TestSize.Level0)
+{
+    DaudioFft fft;
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_VALUE, fft.Init(0));
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_VALUE, fft.Init(TEST_FFT_SIZE + 1));
+    EXPECT_EQ(DH_SUCCESS, fft.Init(TEST_FFT_SIZE));
+    EXPECT_EQ(TEST_FFT_SIZE, fft.GetSize());
+
+    std::vector<std::complex<float>> data(TEST_FFT_SIZE, 0.0f);
+    data[1] = 1.0f;
+    fft.Forward(data.data());
+    for (uint32_t k = 0; k < TEST_FFT_SIZE; k++) {
+        EXPECT_NEAR(1.0f, std::abs(data[k]), TEST_FFT_TOLERANCE);
+    }
+    EXPECT_NEAR(0.0f, std::abs(data[TEST_FFT_SIZE / 4] - std::complex<float>(0.0f, -1.0f)), TEST_FFT_TOLERANCE);
+
+    std::mt19937 rng(TEST_SEED);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<std::complex<float>> origin(TEST_FFT_SIZE);
+    for (auto &value : origin) {
+        value = std::complex<float>(dist(rng), dist(rng));
+    }
+    data = origin;
+    fft.Forward(data.data());
+    fft.Inverse(data.data());
+    for (uint32_t i = 0; i < TEST_FFT_SIZE; i++) {
+        EXPECT_NEAR(0.0f, std::abs(data[i] - origin[i]), TEST_FFT_TOLERANCE);
+    }
+}
+
+/**
+ * @tc.name: Init_001
+ * @tc.desc: Verify the estimator rejects unsupported formats and stays inert until initialized.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioEchoDelayTest, Init_001, TestSize.Level0)
+{
+    DaudioEchoDelayEstimator estimator;
+    std::vector<uint8_t> out(TEST_REF_FRAMES * TEST_REF_CHANNELS * sizeof(int16_t));
+    EXPECT_EQ(0, estimator.GetAlignedReference(out.data(), out.size()));
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_SUPPORT, estimator.Init(TEST_REF_RATE, TEST_REF_CHANNELS, TEST_MIC_RATE,
+        TEST_MIC_CHANNELS, SAMPLE_S24LE));
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_SUPPORT, estimator.Init(TEST_REF_RATE, 0, TEST_MIC_RATE, TEST_MIC_CHANNELS,
+        SAMPLE_S16LE));
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_SUPPORT, estimator.Init(TEST_REF_RATE, TEST_REF_CHANNELS, 0, TEST_MIC_CHANNELS,
+        SAMPLE_S16LE));
+    EXPECT_EQ(DH_SUCCESS, estimator.Init(TEST_REF_RATE, TEST_REF_CHANNELS, TEST_MIC_RATE, TEST_MIC_CHANNELS,
+        SAMPLE_S16LE));
+    EXPECT_FALSE(estimator.IsValid());
+    EXPECT_EQ(0, estimator.GetDelayUs());
+    estimator.PushReference(nullptr, out.size());
+    estimator.PushCapture(nullptr, out.size());
+    EXPECT_EQ(0, estimator.GetAlignedReference(nullptr, out.size()));
+    EXPECT_EQ(out.size(), estimator.GetAlignedReference(out.data(), out.size()));
+}
+
+/**
+ * @tc.name: Estimate_001
+ * @tc.desc: Verify the delay of an echo path across sample rates is found within one millisecond.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioEchoDelayTest, Estimate_001, TestSize.Level0)
+{
+    DaudioEchoDelayEstimator estimator;
+    ASSERT_EQ(DH_SUCCESS, estimator.Init(TEST_REF_RATE, TEST_REF_CHANNELS, TEST_MIC_RATE, TEST_MIC_CHANNELS,
+        SAMPLE_S16LE));
+    EchoPath path(TEST_SEED);
+    RunEchoPath(estimator, path, TEST_DELAY_US, TEST_CONVERGE_FRAMES);
+    ASSERT_TRUE(estimator.IsValid());
+    EXPECT_LE(std::llabs(estimator.GetDelayUs() - TEST_DELAY_US), TEST_TOLERANCE_US);
+    EXPECT_GE(estimator.GetConfidence(), DaudioEchoDelayEstimator::ECHO_DELAY_MIN_CONFIDENCE);
+
+    estimator.Reset();
+    EXPECT_FALSE(estimator.IsValid());
+    EXPECT_EQ(0, estimator.GetDelayUs());
+}
+
+/**
+ * @tc.name: Estimate_002
+ * @tc.desc: Verify silence and an uncorrelated capture never produce a delay.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioEchoDelayTest, Estimate_002, TestSize.Level0)
+{
+    DaudioEchoDelayEstimator estimator;
+    ASSERT_EQ(DH_SUCCESS, estimator.Init(TEST_REF_RATE, TEST_REF_CHANNELS, TEST_MIC_RATE, TEST_MIC_CHANNELS,
+        SAMPLE_S16LE));
+    std::vector<int16_t> ref(TEST_REF_FRAMES * TEST_REF_CHANNELS, 0);
+    std::vector<int16_t> mic(TEST_MIC_FRAMES * TEST_MIC_CHANNELS, 0);
+    for (uint32_t i = 0; i < TEST_CONVERGE_FRAMES; i++) {
+        estimator.PushReference(reinterpret_cast<uint8_t *>(ref.data()), ref.size() * sizeof(int16_t));
+        estimator.PushCapture(reinterpret_cast<uint8_t *>(mic.data()), mic.size() * sizeof(int16_t));
+    }
+    EXPECT_FALSE(estimator.IsValid());
+
+    EchoPath refPath(TEST_SEED);
+    EchoPath micPath(TEST_SEED + 1);
+    std::vector<int16_t> unused;
+    for (uint32_t i = 0; i < TEST_CONVERGE_FRAMES; i++) {
+        refPath.Next(TEST_DELAY_US, ref, unused);
+        micPath.Next(TEST_DELAY_US, unused, mic);
+        estimator.PushReference(reinterpret_cast<uint8_t *>(ref.data()), ref.size() * sizeof(int16_t));
+        estimator.PushCapture(reinterpret_cast<uint8_t *>(mic.data()), mic.size() * sizeof(int16_t));
+    }
+    EXPECT_FALSE(estimator.IsValid());
+
+    std::vector<int16_t> out(ref.size());
+    ASSERT_EQ(out.size() * sizeof(int16_t),
+        estimator.GetAlignedReference(reinterpret_cast<uint8_t *>(out.data()), out.size() * sizeof(int16_t)));
+    EXPECT_EQ(ref, out);
+}
+
+/**
+ * @tc.name: Estimate_003
+ * @tc.desc: Verify a change of the echo path delay is followed once it is confirmed.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioEchoDelayTest, Estimate_003, TestSize.Level0)
+{
+    DaudioEchoDelayEstimator estimator;
+    ASSERT_EQ(DH_SUCCESS, estimator.Init(TEST_REF_RATE, TEST_REF_CHANNELS, TEST_MIC_RATE, TEST_MIC_CHANNELS,
+        SAMPLE_S16LE));
+    EchoPath path(TEST_SEED);
+    RunEchoPath(estimator, path, TEST_DELAY_US, TEST_CONVERGE_FRAMES);
+    ASSERT_TRUE(estimator.IsValid());
+    RunEchoPath(estimator, path, TEST_NEW_DELAY_US, TEST_CONVERGE_FRAMES);
+    ASSERT_TRUE(estimator.IsValid());
+    EXPECT_LE(std::llabs(estimator.GetDelayUs() - TEST_NEW_DELAY_US), TEST_TOLERANCE_US);
+}
+
+/**
+ * @tc.name: GetAlignedReference_001
+ * @tc.desc: Verify the aligned reference leads the echo in the capture by the margin.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioEchoDelayTest, GetAlignedReference_001, TestSize.Level0)
+{
+    DaudioEchoDelayEstimator estimator;
+    ASSERT_EQ(DH_SUCCESS, estimator.Init(TEST_REF_RATE, TEST_REF_CHANNELS, TEST_MIC_RATE, TEST_MIC_CHANNELS,
+        SAMPLE_S16LE));
+    EchoPath path(TEST_SEED);
+    RunEchoPath(estimator, path, TEST_DELAY_US, TEST_CONVERGE_FRAMES);
+    ASSERT_TRUE(estimator.IsValid());
+
+    std::vector<int16_t> ref;
+    std::vector<int16_t> mic;
+    path.Next(TEST_DELAY_US, ref, mic);
+    estimator.PushReference(reinterpret_cast<uint8_t *>(ref.data()), ref.size() * sizeof(int16_t));
+    estimator.PushCapture(reinterpret_cast<uint8_t *>(mic.data()), mic.size() * sizeof(int16_t));
+    std::vector<int16_t> aligned(ref.size());
+    ASSERT_EQ(aligned.size() * sizeof(int16_t), estimator.GetAlignedReference(
+        reinterpret_cast<uint8_t *>(aligned.data()), aligned.size() * sizeof(int16_t)));
+
+    // The echo of aligned reference frame j shows up margin frames later in the capture.
+    const int32_t margin = DaudioEchoDelayEstimator::ECHO_DELAY_MARGIN_MS * TEST_REF_RATE / 1000;
+    const int32_t tolerance = TEST_TOLERANCE_US * TEST_REF_RATE / 1000000;
+    int32_t bestShift = 0;
+    double bestScore = 0;
+    for (int32_t shift = -2 * margin; shift <= 0; shift++) {
+        double score = 0;
+        for (uint32_t i = 0; i < TEST_MIC_FRAMES; i++) {
+            int32_t j = static_cast<int32_t>(i * TEST_RATE_RATIO) + shift;
+            if (j >= 0 && j < static_cast<int32_t>(TEST_REF_FRAMES)) {
+                score += static_cast<double>(mic[i]) * aligned[j * TEST_REF_CHANNELS];
+            }
+        }
+        if (score > bestScore) {
+            bestScore = score;
+            bestShift = shift;
+        }
+    }
+    EXPECT_LE(std::abs(bestShift + margin), tolerance);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
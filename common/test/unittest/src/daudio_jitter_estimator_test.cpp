@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_jitter_estimator_test.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr int64_t TEST_FRAME_US = 20000;
+constexpr int64_t TEST_START_PTS = 1000000;
+constexpr int64_t TEST_CLOCK_OFFSET = 5000000;
+constexpr uint32_t TEST_MIN_DEPTH = 2;
+constexpr uint32_t TEST_MAX_DEPTH = 20;
+
+void DAudioJitterEstimatorTest::SetUpTestCase(void) {}
+
+void DAudioJitterEstimatorTest::TearDownTestCase(void) {}
+
+void DAudioJitterEstimatorTest::SetUp(void)
+{
+    estimator_ = std::make_unique<DaudioJitterEstimator>();
+    estimator_->Reset(TEST_FRAME_US, TEST_MIN_DEPTH, TEST_MAX_DEPTH);
+}
+
+void DAudioJitterEstimatorTest::TearDown(void)
+{
+    estimator_ = nullptr;
+}
+
+/**
+ * @tc.name: JitterEstimator_001
+ * @tc.desc: Verify steady arrivals keep the minimum depth and bursts grow it.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioJitterEstimatorTest, JitterEstimator_001, TestSize.Level1)
+{
+    int64_t pts = TEST_START_PTS;
+    for (uint32_t i = 0; i < DaudioJitterEstimator::JITTER_WINDOW_SIZE; i++) {
+        estimator_->OnFrameArrived(pts, pts + TEST_CLOCK_OFFSET);
+        pts += TEST_FRAME_US;
+    }
+    EXPECT_EQ(0, estimator_->GetJitterUs());
+    EXPECT_EQ(TEST_MIN_DEPTH, estimator_->GetTargetDepth());
+
+    // Every fourth frame is held back by three frame periods.
+    int64_t burstDelay = 3 * TEST_FRAME_US;
+    for (uint32_t i = 0; i < DaudioJitterEstimator::JITTER_WINDOW_SIZE; i++) {
+        int64_t delay = (i % 4 == 0) ? burstDelay : 0;
+        estimator_->OnFrameArrived(pts, pts + TEST_CLOCK_OFFSET + delay);
+        pts += TEST_FRAME_US;
+    }
+    EXPECT_EQ(burstDelay, estimator_->GetJitterUs());
+    EXPECT_EQ(4, estimator_->GetTargetDepth());
+}
+
+/**
+ * @tc.name: JitterEstimator_002
+ * @tc.desc: Verify the depth shrinks gradually once the link is quiet again.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioJitterEstimatorTest, JitterEstimator_002, TestSize.Level1)
+{
+    int64_t pts = TEST_START_PTS;
+    for (uint32_t i = 0; i < DaudioJitterEstimator::JITTER_WINDOW_SIZE; i++) {
+        int64_t delay = (i % 2 == 0) ? 5 * TEST_FRAME_US : 0;
+        estimator_->OnFrameArrived(pts, pts + delay);
+        pts += TEST_FRAME_US;
+    }
+    uint32_t burstDepth = estimator_->GetTargetDepth();
+    EXPECT_EQ(6, burstDepth);
+
+    for (uint32_t i = 0; i < DaudioJitterEstimator::JITTER_WINDOW_SIZE; i++) {
+        estimator_->OnFrameArrived(pts, pts);
+        pts += TEST_FRAME_US;
+    }
+    EXPECT_EQ(burstDepth - 1, estimator_->GetTargetDepth());
+    for (uint32_t i = 0; i < DaudioJitterEstimator::JITTER_WINDOW_SIZE * burstDepth; i++) {
+        estimator_->OnFrameArrived(pts, pts);
+        pts += TEST_FRAME_US;
+    }
+    EXPECT_EQ(TEST_MIN_DEPTH, estimator_->GetTargetDepth());
+}
+
+/**
+ * @tc.name: JitterEstimator_003
+ * @tc.desc: Verify underruns, depth limits and frames without pts.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioJitterEstimatorTest, JitterEstimator_003, TestSize.Level1)
+{
+    estimator_->OnUnderrun();
+    EXPECT_EQ(TEST_MIN_DEPTH + 1, estimator_->GetTargetDepth());
+    for (uint32_t i = 0; i < TEST_MAX_DEPTH; i++) {
+        estimator_->OnUnderrun();
+    }
+    EXPECT_EQ(TEST_MAX_DEPTH, estimator_->GetTargetDepth());
+    estimator_->SetDepthRange(TEST_MIN_DEPTH, TEST_MAX_DEPTH / 2);
+    EXPECT_EQ(TEST_MAX_DEPTH / 2, estimator_->GetTargetDepth());
+
+    estimator_->Reset(TEST_FRAME_US, TEST_MIN_DEPTH, TEST_MAX_DEPTH);
+    for (uint32_t i = 0; i < DaudioJitterEstimator::JITTER_WINDOW_SIZE; i++) {
+        estimator_->OnFrameArrived(0, static_cast<int64_t>(i) * TEST_FRAME_US * TEST_MAX_DEPTH);
+    }
+    EXPECT_EQ(TEST_MIN_DEPTH, estimator_->GetTargetDepth());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
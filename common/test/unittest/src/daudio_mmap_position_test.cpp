@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_mmap_position_test.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "daudio_errorcode.h"
+#include "daudio_util.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr uint32_t TEST_SAMPLE_RATE = 48000;
+constexpr uint32_t TEST_PERIOD_FRAMES = 240;
+constexpr int64_t TEST_PERIOD_NS = 5000000;
+constexpr uint64_t TEST_PUBLISH_TIMES = 100000;
+
+void DAudioMmapPositionTest::SetUpTestCase(void) {}
+
+void DAudioMmapPositionTest::TearDownTestCase(void) {}
+
+void DAudioMmapPositionTest::SetUp(void) {}
+
+void DAudioMmapPositionTest::TearDown(void) {}
+
+/**
+ * @tc.name: Read_001
+ * @tc.desc: Verify the published frame count and time are read back as one pair.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioMmapPositionTest, Read_001, TestSize.Level1)
+{
+    DaudioMmapPosition position;
+    uint64_t frames = 1;
+    int64_t timeNs = 1;
+    EXPECT_EQ(DH_SUCCESS, position.Read(frames, timeNs));
+    EXPECT_EQ(0, frames);
+    EXPECT_EQ(0, timeNs);
+
+    position.Reset(TEST_SAMPLE_RATE, TEST_PERIOD_FRAMES, false);
+    position.Publish(TEST_PERIOD_FRAMES, TEST_PERIOD_NS);
+    EXPECT_EQ(DH_SUCCESS, position.Read(frames, timeNs));
+    EXPECT_EQ(TEST_PERIOD_FRAMES, frames);
+    EXPECT_EQ(TEST_PERIOD_NS, timeNs);
+
+    position.Reset(TEST_SAMPLE_RATE, TEST_PERIOD_FRAMES, false);
+    EXPECT_EQ(DH_SUCCESS, position.Read(frames, timeNs));
+    EXPECT_EQ(0, frames);
+}
+
+/**
+ * @tc.name: Read_002
+ * @tc.desc: Verify interpolated mode extrapolates from the last tick and stops one period ahead.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioMmapPositionTest, Read_002, TestSize.Level1)
+{
+    DaudioMmapPosition position;
+    position.Reset(TEST_SAMPLE_RATE, TEST_PERIOD_FRAMES, true);
+    int64_t tickNs = GetCurNano();
+    position.Publish(TEST_PERIOD_FRAMES, tickNs);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    uint64_t frames = 0;
+    int64_t timeNs = 0;
+    EXPECT_EQ(DH_SUCCESS, position.Read(frames, timeNs));
+    EXPECT_GT(timeNs, tickNs);
+    EXPECT_GT(frames, TEST_PERIOD_FRAMES);
+    EXPECT_LE(frames, 2 * TEST_PERIOD_FRAMES);
+
+    position.Publish(2 * TEST_PERIOD_FRAMES, tickNs - 10 * TEST_PERIOD_NS);
+    EXPECT_EQ(DH_SUCCESS, position.Read(frames, timeNs));
+    EXPECT_EQ(3 * TEST_PERIOD_FRAMES, frames);
+}
+
+/**
+ * @tc.name: Read_003
+ * @tc.desc: Verify readers never see a frame count paired with another tick's time.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioMmapPositionTest, Read_003, TestSize.Level1)
+{
+    DaudioMmapPosition position;
+    position.Reset(TEST_SAMPLE_RATE, TEST_PERIOD_FRAMES, false);
+    std::atomic<bool> done = false;
+    std::thread writer([&position, &done]() {
+        for (uint64_t i = 1; i <= TEST_PUBLISH_TIMES; i++) {
+            position.Publish(i * TEST_PERIOD_FRAMES, static_cast<int64_t>(i) * TEST_PERIOD_NS);
+        }
+        done.store(true);
+    });
+    uint64_t torn = 0;
+    uint64_t lastFrames = 0;
+    while (!done.load()) {
+        uint64_t frames = 0;
+        int64_t timeNs = 0;
+        if (position.Read(frames, timeNs) != DH_SUCCESS) {
+            continue;
+        }
+        if (frames / TEST_PERIOD_FRAMES != static_cast<uint64_t>(timeNs / TEST_PERIOD_NS) || frames < lastFrames) {
+            torn++;
+        }
+        lastFrames = frames;
+    }
+    writer.join();
+    EXPECT_EQ(0, torn);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_period_scheduler_test.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "daudio_errorcode.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr int64_t TEST_PERIOD_NS = 2000000;
+constexpr int64_t TEST_PHASE_NS = 1000000;
+constexpr int32_t TEST_RUN_MS = 100;
+constexpr uint64_t TEST_MIN_TICKS = 20;
+
+void DAudioPeriodSchedulerTest::SetUpTestCase(void) {}
+
+void DAudioPeriodSchedulerTest::TearDownTestCase(void) {}
+
+void DAudioPeriodSchedulerTest::SetUp(void) {}
+
+void DAudioPeriodSchedulerTest::TearDown(void) {}
+
+/**
+ * @tc.name: Register_001
+ * @tc.desc: Verify invalid registrations are rejected.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioPeriodSchedulerTest, Register_001, TestSize.Level1)
+{
+    auto &scheduler = DaudioPeriodScheduler::GetInstance();
+    uint32_t streamId = 0;
+    EXPECT_EQ(ERR_DH_AUDIO_SA_PARAM_INVALID, scheduler.Register("test", 0, 0, []() {}, streamId));
+    EXPECT_EQ(ERR_DH_AUDIO_SA_PARAM_INVALID, scheduler.Register("test", TEST_PERIOD_NS, -1, []() {}, streamId));
+    EXPECT_EQ(ERR_DH_AUDIO_SA_PARAM_INVALID, scheduler.Register("test", TEST_PERIOD_NS, 0, nullptr, streamId));
+    DaudioPeriodStats stats;
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_FOUND_KEY, scheduler.GetStats(0, stats));
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_FOUND_KEY, scheduler.Unregister(0));
+}
+
+/**
+ * @tc.name: Register_002
+ * @tc.desc: Verify two streams tick periodically on the shared thread and report stats.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioPeriodSchedulerTest, Register_002, TestSize.Level1)
+{
+    auto &scheduler = DaudioPeriodScheduler::GetInstance();
+    std::atomic<uint64_t> firstTicks = 0;
+    std::atomic<uint64_t> secondTicks = 0;
+    std::atomic<std::thread::id> firstThread;
+    std::atomic<std::thread::id> secondThread;
+    uint32_t firstId = 0;
+    uint32_t secondId = 0;
+    EXPECT_EQ(DH_SUCCESS, scheduler.Register("first", TEST_PERIOD_NS, 0, [&firstTicks, &firstThread]() {
+        firstThread.store(std::this_thread::get_id());
+        firstTicks++;
+    }, firstId));
+    EXPECT_EQ(DH_SUCCESS, scheduler.Register("second", TEST_PERIOD_NS, TEST_PHASE_NS,
+        [&secondTicks, &secondThread]() {
+        secondThread.store(std::this_thread::get_id());
+        secondTicks++;
+    }, secondId));
+    EXPECT_NE(firstId, secondId);
+    std::this_thread::sleep_for(std::chrono::milliseconds(TEST_RUN_MS));
+    EXPECT_EQ(DH_SUCCESS, scheduler.Unregister(firstId));
+    EXPECT_EQ(DH_SUCCESS, scheduler.Unregister(secondId));
+    EXPECT_GE(firstTicks.load(), TEST_MIN_TICKS);
+    EXPECT_GE(secondTicks.load(), TEST_MIN_TICKS);
+    EXPECT_EQ(firstThread.load(), secondThread.load());
+
+    uint64_t ticks = firstTicks.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(TEST_RUN_MS / 10));
+    EXPECT_EQ(ticks, firstTicks.load());
+    DaudioPeriodStats stats;
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_FOUND_KEY, scheduler.GetStats(firstId, stats));
+}
+
+/**
+ * @tc.name: GetStats_001
+ * @tc.desc: Verify the stats count every tick in the lateness histogram.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioPeriodSchedulerTest, GetStats_001, TestSize.Level1)
+{
+    auto &scheduler = DaudioPeriodScheduler::GetInstance();
+    uint32_t streamId = 0;
+    EXPECT_EQ(DH_SUCCESS, scheduler.Register("stats", TEST_PERIOD_NS, 0, []() {}, streamId));
+    std::this_thread::sleep_for(std::chrono::milliseconds(TEST_RUN_MS));
+    DaudioPeriodStats stats;
+    EXPECT_EQ(DH_SUCCESS, scheduler.GetStats(streamId, stats));
+    EXPECT_EQ(DH_SUCCESS, scheduler.Unregister(streamId));
+    EXPECT_GE(stats.ticks, TEST_MIN_TICKS);
+    uint64_t histogramTicks = 0;
+    for (auto count : stats.latenessHistogram) {
+        histogramTicks += count;
+    }
+    EXPECT_EQ(stats.ticks, histogramTicks);
+    EXPECT_GE(stats.maxLatenessNs, 0);
+}
+
+/**
+ * @tc.name: Unregister_001
+ * @tc.desc: Verify a stream can unregister itself from inside its tick.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioPeriodSchedulerTest, Unregister_001, TestSize.Level1)
+{
+    auto &scheduler = DaudioPeriodScheduler::GetInstance();
+    std::atomic<uint64_t> ticks = 0;
+    std::atomic<uint32_t> streamId = 0;
+    uint32_t id = 0;
+    EXPECT_EQ(DH_SUCCESS, scheduler.Register("self", TEST_PERIOD_NS, 0, [&scheduler, &ticks, &streamId]() {
+        ticks++;
+        while (streamId.load() == 0) {}
+        scheduler.Unregister(streamId.load());
+    }, id));
+    streamId.store(id);
+    std::this_thread::sleep_for(std::chrono::milliseconds(TEST_RUN_MS / 5));
+    EXPECT_EQ(1, ticks.load());
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_FOUND_KEY, scheduler.Unregister(id));
+}
+} // namespace DistributedHardware
+} // namespace OHOS
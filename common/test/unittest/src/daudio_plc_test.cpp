@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_plc_test.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "audio_param.h"
+#include "daudio_errorcode.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr uint32_t TEST_SAMPLE_RATE = 48000;
+constexpr uint32_t TEST_CHANNELS = 2;
+constexpr uint32_t TEST_FRAME_SAMPLES = 960;
+constexpr uint32_t TEST_TONE_HZ = 200;
+constexpr uint32_t TEST_MAX_CONCEAL_MS = 60;
+constexpr double TEST_AMPLITUDE = 10000.0;
+constexpr double TEST_PI = 3.14159265358979323846;
+
+void DAudioPlcTest::SetUpTestCase(void) {}
+
+void DAudioPlcTest::TearDownTestCase(void) {}
+
+void DAudioPlcTest::SetUp(void)
+{
+    plc_ = std::make_unique<DaudioPlc>();
+}
+
+void DAudioPlcTest::TearDown(void)
+{
+    plc_ = nullptr;
+}
+
+static void FillTone(std::vector<int16_t> &frame, uint64_t &position)
+{
+    for (uint32_t i = 0; i < TEST_FRAME_SAMPLES; i++) {
+        double value = TEST_AMPLITUDE * std::sin(2.0 * TEST_PI * TEST_TONE_HZ * position / TEST_SAMPLE_RATE);
+        for (uint32_t ch = 0; ch < TEST_CHANNELS; ch++) {
+            frame[i * TEST_CHANNELS + ch] = static_cast<int16_t>(value);
+        }
+        position++;
+    }
+}
+
+static uint8_t *AsBytes(std::vector<int16_t> &frame)
+{
+    return reinterpret_cast<uint8_t *>(frame.data());
+}
+
+/**
+ * @tc.name: PlcConceal_001
+ * @tc.desc: Verify a lost frame continues the last pitch period and the output mutes after the budget.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioPlcTest, PlcConceal_001, TestSize.Level1)
+{
+    ASSERT_EQ(DH_SUCCESS, plc_->Init(TEST_SAMPLE_RATE, TEST_CHANNELS, SAMPLE_S16LE, TEST_MAX_CONCEAL_MS));
+    size_t len = TEST_FRAME_SAMPLES * TEST_CHANNELS * sizeof(int16_t);
+    std::vector<int16_t> frame(TEST_FRAME_SAMPLES * TEST_CHANNELS);
+    uint64_t position = 0;
+    for (uint32_t i = 0; i < 3; i++) {
+        FillTone(frame, position);
+        plc_->OnGoodFrame(AsBytes(frame), len);
+    }
+    int16_t lastGood = frame[(TEST_FRAME_SAMPLES - 1) * TEST_CHANNELS];
+
+    EXPECT_TRUE(plc_->Conceal(AsBytes(frame), len));
+    uint32_t period = TEST_SAMPLE_RATE / TEST_TONE_HZ;
+    EXPECT_EQ(0, plc_->GetPitchSamples() % period);
+    EXPECT_LT(std::abs(frame[0] - lastGood), static_cast<int32_t>(TEST_AMPLITUDE / 10));
+    EXPECT_EQ(frame[0], frame[1]);
+
+    EXPECT_TRUE(plc_->Conceal(AsBytes(frame), len));
+    EXPECT_TRUE(plc_->Conceal(AsBytes(frame), len));
+    EXPECT_FALSE(plc_->Conceal(AsBytes(frame), len));
+    for (auto sample : frame) {
+        EXPECT_EQ(0, sample);
+    }
+    EXPECT_EQ(1, plc_->GetLossEvents());
+    EXPECT_EQ(3, plc_->GetConcealedFrames());
+    EXPECT_EQ(1, plc_->GetMutedFrames());
+}
+
+/**
+ * @tc.name: PlcConceal_002
+ * @tc.desc: Verify the first good frame after a loss is cross-faded from the concealment.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioPlcTest, PlcConceal_002, TestSize.Level1)
+{
+    ASSERT_EQ(DH_SUCCESS, plc_->Init(TEST_SAMPLE_RATE, TEST_CHANNELS, SAMPLE_S16LE, 0));
+    size_t len = TEST_FRAME_SAMPLES * TEST_CHANNELS * sizeof(int16_t);
+    std::vector<int16_t> frame(TEST_FRAME_SAMPLES * TEST_CHANNELS);
+    uint64_t position = 0;
+    FillTone(frame, position);
+    plc_->OnGoodFrame(AsBytes(frame), len);
+
+    // A zero budget mutes straight away, so recovery has to fade in from silence.
+    EXPECT_FALSE(plc_->Conceal(AsBytes(frame), len));
+    std::vector<int16_t> good(TEST_FRAME_SAMPLES * TEST_CHANNELS, static_cast<int16_t>(TEST_AMPLITUDE));
+    plc_->OnGoodFrame(AsBytes(good), len);
+    size_t fadeSamples = TEST_SAMPLE_RATE * DaudioPlc::PLC_CROSSFADE_MS / 1000;
+    EXPECT_LT(good[0], static_cast<int16_t>(TEST_AMPLITUDE / 10));
+    EXPECT_LT(good[(fadeSamples / 2) * TEST_CHANNELS], static_cast<int16_t>(TEST_AMPLITUDE));
+    EXPECT_EQ(static_cast<int16_t>(TEST_AMPLITUDE), good[fadeSamples * TEST_CHANNELS]);
+
+    good.assign(good.size(), static_cast<int16_t>(TEST_AMPLITUDE));
+    plc_->OnGoodFrame(AsBytes(good), len);
+    EXPECT_EQ(static_cast<int16_t>(TEST_AMPLITUDE), good[0]);
+}
+
+/**
+ * @tc.name: PlcConceal_003
+ * @tc.desc: Verify unsupported formats and missing history fall back to silence.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioPlcTest, PlcConceal_003, TestSize.Level1)
+{
+    std::vector<int16_t> frame(TEST_FRAME_SAMPLES * TEST_CHANNELS, 1);
+    size_t len = frame.size() * sizeof(int16_t);
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_SUPPORT, plc_->Init(TEST_SAMPLE_RATE, TEST_CHANNELS, SAMPLE_S24LE, TEST_MAX_CONCEAL_MS));
+    EXPECT_FALSE(plc_->Conceal(AsBytes(frame), len));
+    EXPECT_EQ(0, frame[0]);
+    EXPECT_FALSE(plc_->Conceal(nullptr, len));
+
+    ASSERT_EQ(DH_SUCCESS, plc_->Init(TEST_SAMPLE_RATE, TEST_CHANNELS, SAMPLE_S16LE, TEST_MAX_CONCEAL_MS));
+    frame.assign(frame.size(), 1);
+    EXPECT_FALSE(plc_->Conceal(AsBytes(frame), len));
+    EXPECT_EQ(0, frame[0]);
+    EXPECT_EQ(0, plc_->GetConcealedFrames());
+}
+} // namespace DistributedHardware
+} // namespace OHOS
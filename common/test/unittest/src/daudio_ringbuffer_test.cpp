@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_ringbuffer_test.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "daudio_errorcode.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr uint32_t TEST_RING_CAPACITY = 4096;
+constexpr uint32_t TEST_FRAME_SIZE = 960;
+constexpr int64_t TEST_WAIT_NS = 10000000;
+constexpr int64_t TEST_LONG_WAIT_NS = 1000000000;
+
+void DAudioRingBufferTest::SetUpTestCase(void) {}
+
+void DAudioRingBufferTest::TearDownTestCase(void) {}
+
+void DAudioRingBufferTest::SetUp(void)
+{
+    ringBuffer_ = std::make_unique<DaudioSpscRingBuffer>();
+}
+
+void DAudioRingBufferTest::TearDown(void)
+{
+    ringBuffer_ = nullptr;
+}
+
+/**
+ * @tc.name: SpscWriteRead_001
+ * @tc.desc: Verify Write and Read keep byte order across the wrap-around point.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioRingBufferTest, SpscWriteRead_001, TestSize.Level1)
+{
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->Init(TEST_RING_CAPACITY));
+    std::vector<uint8_t> in(TEST_FRAME_SIZE);
+    std::vector<uint8_t> out(TEST_FRAME_SIZE);
+    for (uint32_t round = 0; round < TEST_RING_CAPACITY; round++) {
+        for (uint32_t i = 0; i < TEST_FRAME_SIZE; i++) {
+            in[i] = static_cast<uint8_t>(round + i);
+        }
+        ASSERT_EQ(DH_SUCCESS, ringBuffer_->Write(in.data(), TEST_FRAME_SIZE));
+        ASSERT_EQ(DH_SUCCESS, ringBuffer_->Read(out.data(), TEST_FRAME_SIZE));
+        ASSERT_EQ(in, out);
+    }
+    EXPECT_EQ(0, ringBuffer_->ReadableSize());
+}
+
+/**
+ * @tc.name: SpscWriteRead_002
+ * @tc.desc: Verify Write fails when full and Read fails when not enough data.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioRingBufferTest, SpscWriteRead_002, TestSize.Level1)
+{
+    std::vector<uint8_t> data(TEST_RING_CAPACITY);
+    EXPECT_EQ(ERR_DH_AUDIO_NULLPTR, ringBuffer_->Write(data.data(), TEST_FRAME_SIZE));
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->Init(TEST_RING_CAPACITY));
+    uint32_t capacity = ringBuffer_->Capacity();
+    ASSERT_GE(capacity, TEST_RING_CAPACITY);
+    data.resize(capacity);
+    EXPECT_EQ(ERR_DH_AUDIO_FAILED, ringBuffer_->Read(data.data(), 1));
+    EXPECT_EQ(DH_SUCCESS, ringBuffer_->Write(data.data(), capacity));
+    EXPECT_EQ(ERR_DH_AUDIO_FAILED, ringBuffer_->Write(data.data(), 1));
+    EXPECT_EQ(0, ringBuffer_->WritableSize());
+}
+
+/**
+ * @tc.name: SpscSpan_001
+ * @tc.desc: Verify AcquireWrite and PeekRead return contiguous spans across the wrap-around point.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioRingBufferTest, SpscSpan_001, TestSize.Level1)
+{
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->Init(TEST_RING_CAPACITY));
+    uint32_t capacity = ringBuffer_->Capacity();
+    uint32_t offset = capacity - TEST_FRAME_SIZE / 2;
+    uint8_t *writeSpan = nullptr;
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->AcquireWrite(offset, writeSpan));
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->CommitWrite(offset));
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->ConsumeRead(offset));
+
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->AcquireWrite(TEST_FRAME_SIZE, writeSpan));
+    for (uint32_t i = 0; i < TEST_FRAME_SIZE; i++) {
+        writeSpan[i] = static_cast<uint8_t>(i);
+    }
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_VALUE, ringBuffer_->CommitWrite(capacity + 1));
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->CommitWrite(TEST_FRAME_SIZE));
+
+    const uint8_t *readSpan = nullptr;
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->PeekRead(TEST_FRAME_SIZE, readSpan));
+    for (uint32_t i = 0; i < TEST_FRAME_SIZE; i++) {
+        ASSERT_EQ(static_cast<uint8_t>(i), readSpan[i]);
+    }
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_VALUE, ringBuffer_->ConsumeRead(TEST_FRAME_SIZE + 1));
+    EXPECT_EQ(DH_SUCCESS, ringBuffer_->ConsumeRead(TEST_FRAME_SIZE));
+    EXPECT_EQ(ERR_DH_AUDIO_FAILED, ringBuffer_->PeekRead(1, readSpan));
+}
+
+/**
+ * @tc.name: SpscWaitReadable_001
+ * @tc.desc: Verify WaitReadable times out when empty and wakes up on producer write.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioRingBufferTest, SpscWaitReadable_001, TestSize.Level1)
+{
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->Init(TEST_RING_CAPACITY));
+    EXPECT_EQ(ERR_DH_AUDIO_SA_WAIT_TIMEOUT, ringBuffer_->WaitReadable(TEST_FRAME_SIZE, TEST_WAIT_NS));
+
+    std::vector<uint8_t> data(TEST_FRAME_SIZE);
+    std::thread producer([this, &data]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ringBuffer_->Write(data.data(), TEST_FRAME_SIZE);
+    });
+    int32_t ret = ringBuffer_->WaitReadable(TEST_FRAME_SIZE, TEST_LONG_WAIT_NS);
+    producer.join();
+    EXPECT_EQ(DH_SUCCESS, ret);
+}
+
+/**
+ * @tc.name: SpscOverflow_001
+ * @tc.desc: Verify DROP_NEWEST keeps queued data and counts overrun, underrun and high watermark.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioRingBufferTest, SpscOverflow_001, TestSize.Level1)
+{
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->Init(TEST_RING_CAPACITY));
+    ringBuffer_->SetOverflowPolicy(DaudioRingOverflowPolicy::DROP_NEWEST, TEST_FRAME_SIZE);
+    uint32_t frames = ringBuffer_->Capacity() / TEST_FRAME_SIZE;
+    std::vector<uint8_t> data(TEST_FRAME_SIZE);
+    for (uint32_t i = 0; i < frames; i++) {
+        ASSERT_EQ(DH_SUCCESS, ringBuffer_->Write(data.data(), TEST_FRAME_SIZE));
+    }
+    EXPECT_EQ(ERR_DH_AUDIO_FAILED, ringBuffer_->Write(data.data(), TEST_FRAME_SIZE));
+    for (uint32_t i = 0; i < frames; i++) {
+        ASSERT_EQ(DH_SUCCESS, ringBuffer_->Read(data.data(), TEST_FRAME_SIZE));
+    }
+    EXPECT_EQ(ERR_DH_AUDIO_FAILED, ringBuffer_->Read(data.data(), TEST_FRAME_SIZE));
+
+    DaudioRingStats stats = ringBuffer_->GetStats();
+    EXPECT_EQ(1, stats.overrunCount);
+    EXPECT_EQ(TEST_FRAME_SIZE, stats.overrunBytes);
+    EXPECT_EQ(1, stats.underrunCount);
+    EXPECT_EQ(frames * TEST_FRAME_SIZE, stats.highWatermark);
+}
+
+/**
+ * @tc.name: SpscOverflow_002
+ * @tc.desc: Verify OVERWRITE_OLDEST evicts whole frames and invalidates a stale PeekRead span.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioRingBufferTest, SpscOverflow_002, TestSize.Level1)
+{
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->Init(TEST_RING_CAPACITY));
+    ringBuffer_->SetOverflowPolicy(DaudioRingOverflowPolicy::OVERWRITE_OLDEST, TEST_FRAME_SIZE);
+    uint32_t frames = ringBuffer_->Capacity() / TEST_FRAME_SIZE;
+    std::vector<uint8_t> data(TEST_FRAME_SIZE);
+    for (uint32_t i = 0; i < frames; i++) {
+        std::fill(data.begin(), data.end(), static_cast<uint8_t>(i));
+        ASSERT_EQ(DH_SUCCESS, ringBuffer_->Write(data.data(), TEST_FRAME_SIZE));
+    }
+    const uint8_t *span = nullptr;
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->PeekRead(TEST_FRAME_SIZE, span));
+    std::fill(data.begin(), data.end(), static_cast<uint8_t>(frames));
+    ASSERT_EQ(DH_SUCCESS, ringBuffer_->Write(data.data(), TEST_FRAME_SIZE));
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_OPERATE, ringBuffer_->ConsumeRead(TEST_FRAME_SIZE));
+
+    for (uint32_t i = 1; i <= frames; i++) {
+        ASSERT_EQ(DH_SUCCESS, ringBuffer_->Read(data.data(), TEST_FRAME_SIZE));
+        EXPECT_EQ(static_cast<uint8_t>(i), data[0]);
+        EXPECT_EQ(static_cast<uint8_t>(i), data[TEST_FRAME_SIZE - 1]);
+    }
+    DaudioRingStats stats = ringBuffer_->GetStats();
+    EXPECT_EQ(1, stats.overrunCount);
+    EXPECT_EQ(TEST_FRAME_SIZE, stats.overrunBytes);
+}
+
+/**
+ * @tc.name: SpscCalcCapacity_001
+ * @tc.desc: Verify the capacity derived from the latency budget honours the minimum size.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioRingBufferTest, SpscCalcCapacity_001, TestSize.Level1)
+{
+    uint32_t bytesPerMs = 192;
+    EXPECT_EQ(38400, DaudioSpscRingBuffer::CalcCapacity(bytesPerMs, 200, TEST_FRAME_SIZE));
+    EXPECT_EQ(TEST_FRAME_SIZE * 4, DaudioSpscRingBuffer::CalcCapacity(bytesPerMs, 1, TEST_FRAME_SIZE * 4));
+    EXPECT_EQ(UINT32_MAX / 2, DaudioSpscRingBuffer::CalcCapacity(UINT32_MAX, UINT32_MAX, 0));
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_seqlock_test.h"
+
+#include <atomic>
+#include <thread>
+
+#include "daudio_errorcode.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr uint64_t TEST_WRITE_TIMES = 100000;
+
+struct TestShareData {
+    uint32_t version = 1;
+    uint64_t first = 0;
+    uint64_t second = 0;
+};
+
+void DAudioSeqlockTest::SetUpTestCase(void) {}
+
+void DAudioSeqlockTest::TearDownTestCase(void) {}
+
+void DAudioSeqlockTest::SetUp(void) {}
+
+void DAudioSeqlockTest::TearDown(void) {}
+
+/**
+ * @tc.name: SeqlockReadWrite_001
+ * @tc.desc: Verify readers never observe a half-written update.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioSeqlockTest, SeqlockReadWrite_001, TestSize.Level1)
+{
+    TestShareData shareData;
+    std::atomic<bool> done = false;
+    std::thread writer([&shareData, &done]() {
+        DaudioSeqlock lock(&shareData.version);
+        for (uint64_t i = 1; i <= TEST_WRITE_TIMES; i++) {
+            while (lock.Write([&shareData, i]() {
+                SeqlockStore(shareData.first, i);
+                SeqlockStore(shareData.second, i);
+            }) != DH_SUCCESS) {}
+        }
+        done.store(true);
+    });
+    DaudioSeqlock lock(&shareData.version);
+    uint64_t torn = 0;
+    uint64_t last = 0;
+    while (!done.load()) {
+        uint64_t first = 0;
+        uint64_t second = 0;
+        if (lock.Read([&shareData, &first, &second]() {
+            first = SeqlockLoad(shareData.first);
+            second = SeqlockLoad(shareData.second);
+        }) != DH_SUCCESS) {
+            continue;
+        }
+        torn += (first != second || first < last) ? 1 : 0;
+        last = first;
+    }
+    writer.join();
+    EXPECT_EQ(0, torn);
+    EXPECT_EQ(TEST_WRITE_TIMES, shareData.first);
+    EXPECT_EQ(1 + 2 * TEST_WRITE_TIMES, shareData.version);
+}
+
+/**
+ * @tc.name: SeqlockReadWrite_002
+ * @tc.desc: Verify both sides give up while the word stays held.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioSeqlockTest, SeqlockReadWrite_002, TestSize.Level1)
+{
+    TestShareData shareData;
+    shareData.version = 0;
+    DaudioSeqlock lock(&shareData.version);
+    bool called = false;
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_OPERATE, lock.Write([&called]() { called = true; }));
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_OPERATE, lock.Read([&called]() { called = true; }));
+    EXPECT_FALSE(called);
+
+    shareData.version = 1;
+    EXPECT_EQ(DH_SUCCESS, lock.Read([&called]() { called = true; }));
+    EXPECT_TRUE(called);
+    EXPECT_EQ(1, shareData.version);
+}
+
+/**
+ * @tc.name: SeqlockReadWrite_003
+ * @tc.desc: Verify a write keeps the layout tag and wraps the sequence within its own bits.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioSeqlockTest, SeqlockReadWrite_003, TestSize.Level1)
+{
+    const uint32_t tag = 0x5A000000;
+    TestShareData shareData;
+    shareData.version = tag | DaudioSeqlock::SEQLOCK_SEQUENCE_MASK;
+    DaudioSeqlock lock(&shareData.version);
+    EXPECT_EQ(tag, lock.GetTag());
+    EXPECT_EQ(DH_SUCCESS, lock.Write([&shareData]() { SeqlockStore(shareData.first, static_cast<uint64_t>(1)); }));
+    EXPECT_EQ(tag | 1, shareData.version);
+    EXPECT_EQ(tag, lock.GetTag());
+    uint64_t first = 0;
+    EXPECT_EQ(DH_SUCCESS, lock.Read([&shareData, &first]() { first = SeqlockLoad(shareData.first); }));
+    EXPECT_EQ(1, first);
+}
+
+/**
+ * @tc.name: FlagLockAccess_001
+ * @tc.desc: Verify the legacy flag is taken only while free and handed back as free.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioSeqlockTest, FlagLockAccess_001, TestSize.Level1)
+{
+    TestShareData shareData;
+    DaudioFlagLock lock(&shareData.version);
+    uint32_t seen = DaudioFlagLock::FLAG_FREE;
+    EXPECT_EQ(DH_SUCCESS, lock.Access([&shareData, &seen]() { seen = shareData.version; }));
+    EXPECT_EQ(DaudioFlagLock::FLAG_BUSY, seen);
+    EXPECT_EQ(DaudioFlagLock::FLAG_FREE, shareData.version);
+
+    shareData.version = DaudioFlagLock::FLAG_BUSY;
+    bool called = false;
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_OPERATE, lock.Access([&called]() { called = true; }));
+    EXPECT_FALSE(called);
+    EXPECT_EQ(DaudioFlagLock::FLAG_BUSY, shareData.version);
+}
+
+/**
+ * @tc.name: SeqlockStamp_001
+ * @tc.desc: Verify only a free legacy flag is stamped and a stamped word keeps its sequence.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioSeqlockTest, SeqlockStamp_001, TestSize.Level1)
+{
+    const uint32_t tag = 0x5A000000;
+    TestShareData shareData;
+    DaudioSeqlock seqlock(&shareData.version);
+    EXPECT_EQ(DH_SUCCESS, seqlock.Stamp(tag));
+    EXPECT_EQ(tag | 1, shareData.version);
+    EXPECT_EQ(tag, seqlock.GetTag());
+    EXPECT_EQ(DH_SUCCESS, seqlock.Write([&shareData]() { SeqlockStore(shareData.first, uint64_t(1)); }));
+    EXPECT_EQ(DH_SUCCESS, seqlock.Stamp(tag));
+    EXPECT_EQ(tag | 3, shareData.version);
+
+    shareData.version = DaudioFlagLock::FLAG_BUSY;
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_OPERATE, seqlock.Stamp(tag));
+    EXPECT_EQ(DaudioFlagLock::FLAG_BUSY, shareData.version);
+    const uint32_t foreign = 0x11000001;
+    shareData.version = foreign;
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_OPERATE, seqlock.Stamp(tag));
+    EXPECT_EQ(foreign, shareData.version);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
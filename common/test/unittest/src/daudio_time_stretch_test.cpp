@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_time_stretch_test.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "audio_param.h"
+#include "daudio_errorcode.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedHardware {
+constexpr uint32_t TEST_SAMPLE_RATE = 48000;
+constexpr uint32_t TEST_CHANNELS = 2;
+constexpr size_t TEST_FRAME_SAMPLES = 960;
+constexpr size_t TEST_FRAME_BYTES = TEST_FRAME_SAMPLES * TEST_CHANNELS * sizeof(int16_t);
+constexpr size_t TEST_FRAME_NUM = 50;
+constexpr double TEST_TONE_HZ = 440.0;
+constexpr double TEST_AMPLITUDE = 10000.0;
+// Largest step between adjacent samples of the test tone is about 576; allow a clean splice some margin.
+constexpr int32_t TEST_MAX_STEP = 1200;
+
+static std::vector<int16_t> MakeTone(size_t samples)
+{
+    std::vector<int16_t> tone(samples * TEST_CHANNELS);
+    for (size_t i = 0; i < samples; i++) {
+        int16_t value = static_cast<int16_t>(TEST_AMPLITUDE * std::sin(2 * M_PI * TEST_TONE_HZ * i / TEST_SAMPLE_RATE));
+        for (uint32_t c = 0; c < TEST_CHANNELS; c++) {
+            tone[i * TEST_CHANNELS + c] = value;
+        }
+    }
+    return tone;
+}
+
+static std::vector<int16_t> RunStretch(DaudioTimeStretch &stretch, const std::vector<int16_t> &input)
+{
+    std::vector<int16_t> output;
+    std::vector<int16_t> frame(TEST_FRAME_SAMPLES * TEST_CHANNELS);
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(input.data());
+    for (size_t i = 0; i < input.size() * sizeof(int16_t) / TEST_FRAME_BYTES; i++) {
+        stretch.Push(src + i * TEST_FRAME_BYTES, TEST_FRAME_BYTES);
+        size_t len = 0;
+        while ((len = stretch.Pull(reinterpret_cast<uint8_t *>(frame.data()), TEST_FRAME_BYTES)) > 0) {
+            output.insert(output.end(), frame.begin(), frame.begin() + len / sizeof(int16_t));
+        }
+    }
+    return output;
+}
+
+static int32_t MaxStep(const std::vector<int16_t> &samples)
+{
+    int32_t maxStep = 0;
+    for (size_t i = TEST_CHANNELS; i < samples.size(); i++) {
+        maxStep = std::max(maxStep, std::abs(samples[i] - samples[i - TEST_CHANNELS]));
+    }
+    return maxStep;
+}
+
+void DAudioTimeStretchTest::SetUpTestCase(void) {}
+
+void DAudioTimeStretchTest::TearDownTestCase(void) {}
+
+void DAudioTimeStretchTest::SetUp(void) {}
+
+void DAudioTimeStretchTest::TearDown(void) {}
+
+/**
+ * @tc.name: Init_001
+ * @tc.desc: Verify unsupported formats are rejected and then passed through unchanged.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioTimeStretchTest, Init_001, TestSize.Level1)
+{
+    DaudioTimeStretch stretch;
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_SUPPORT, stretch.Init(TEST_SAMPLE_RATE, TEST_CHANNELS, SAMPLE_U8));
+    EXPECT_EQ(ERR_DH_AUDIO_NOT_SUPPORT, stretch.Init(TEST_SAMPLE_RATE, 0, SAMPLE_S16LE));
+    stretch.SetRate(DaudioTimeStretch::STRETCH_MAX_RATE);
+    EXPECT_EQ(1.0, stretch.GetRate());
+    uint8_t input[3] = {1, 2, 3};
+    uint8_t output[3] = {0};
+    EXPECT_EQ(ERR_DH_AUDIO_NULLPTR, stretch.Push(nullptr, sizeof(input)));
+    EXPECT_EQ(DH_SUCCESS, stretch.Push(input, sizeof(input)));
+    EXPECT_EQ(sizeof(input), stretch.GetBufferedBytes());
+    EXPECT_EQ(sizeof(output), stretch.Pull(output, sizeof(output)));
+    EXPECT_EQ(3, output[2]);
+    EXPECT_EQ(0, stretch.GetBufferedBytes());
+}
+
+/**
+ * @tc.name: Pull_001
+ * @tc.desc: Verify rate 1 passes the input through sample for sample.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioTimeStretchTest, Pull_001, TestSize.Level1)
+{
+    DaudioTimeStretch stretch;
+    ASSERT_EQ(DH_SUCCESS, stretch.Init(TEST_SAMPLE_RATE, TEST_CHANNELS, SAMPLE_S16LE));
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_VALUE, stretch.Push(reinterpret_cast<const uint8_t *>("x"), 1));
+    auto input = MakeTone(TEST_FRAME_SAMPLES * TEST_FRAME_NUM);
+    auto output = RunStretch(stretch, input);
+    ASSERT_FALSE(output.empty());
+    EXPECT_TRUE(std::equal(output.begin(), output.end(), input.begin()));
+    EXPECT_EQ(input.size() * sizeof(int16_t), output.size() * sizeof(int16_t) + stretch.GetBufferedBytes());
+    EXPECT_EQ(0, stretch.GetStretchedHops());
+}
+
+/**
+ * @tc.name: Pull_002
+ * @tc.desc: Verify rates above and below 1 shorten and lengthen the output without discontinuities.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioTimeStretchTest, Pull_002, TestSize.Level1)
+{
+    auto input = MakeTone(TEST_FRAME_SAMPLES * TEST_FRAME_NUM);
+    double inputFrames = static_cast<double>(input.size() / TEST_CHANNELS);
+    for (double rate : { 1.05, 0.95 }) {
+        DaudioTimeStretch stretch;
+        ASSERT_EQ(DH_SUCCESS, stretch.Init(TEST_SAMPLE_RATE, TEST_CHANNELS, SAMPLE_S16LE));
+        stretch.SetRate(rate);
+        EXPECT_EQ(rate, stretch.GetRate());
+        auto output = RunStretch(stretch, input);
+        double consumedFrames = inputFrames -
+            static_cast<double>(stretch.GetBufferedBytes()) / (TEST_CHANNELS * sizeof(int16_t));
+        double outputFrames = static_cast<double>(output.size() / TEST_CHANNELS);
+        EXPECT_NEAR(rate, consumedFrames / outputFrames, 0.01);
+        EXPECT_GT(stretch.GetStretchedHops(), 0);
+        EXPECT_LE(MaxStep(output), TEST_MAX_STEP);
+    }
+}
+
+/**
+ * @tc.name: PlayoutController_001
+ * @tc.desc: Verify the controller holds rate 1 near the target and steers toward it otherwise.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioTimeStretchTest, PlayoutController_001, TestSize.Level1)
+{
+    DaudioPlayoutController controller;
+    uint32_t targetMs = 60;
+    controller.Reset(targetMs);
+    EXPECT_EQ(targetMs, controller.GetTargetMs());
+    EXPECT_EQ(1.0, controller.Update(targetMs + DaudioPlayoutController::PLAYOUT_DEADBAND_MS));
+    EXPECT_EQ(targetMs + DaudioPlayoutController::PLAYOUT_DEADBAND_MS, controller.GetBufferedMs());
+
+    double rate = 1.0;
+    for (uint32_t i = 0; i < 100; i++) {
+        rate = controller.Update(targetMs * 10);
+    }
+    EXPECT_DOUBLE_EQ(1.0 + DaudioPlayoutController::PLAYOUT_MAX_RATE_DEVIATION, rate);
+
+    controller.Reset(targetMs);
+    rate = controller.Update(targetMs - 30);
+    EXPECT_LT(rate, 1.0);
+    EXPECT_GE(rate, 1.0 - DaudioPlayoutController::PLAYOUT_MAX_RATE_DEVIATION);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -29,10 +29,12 @@
 #include "audio_info.h"
 
 #include "audio_data.h"
+#include "audio_data_pool.h"
 #include "audio_event.h"
 #include "audio_param.h"
 #include "audio_status.h"
 #include "av_sender_engine_transport.h"
+#include "daudio_clock_model.h"
 #include "daudio_constants.h"
 #include "daudio_errorcode.h"
 #include "daudio_log.h"
@@ -76,7 +78,8 @@ private:
     int32_t AudioFwkClientSetUp();
     int32_t TransSetUp();
     void AudioFwkCaptureData();
-    void CalcMicDataPts();
+    void CalcMicDataPts(const size_t length);
+    std::shared_ptr<AudioData> AcquireCaptureFrame(bool zeroFill);
 private:
     constexpr static uint8_t CHANNEL_WAIT_SECONDS = 5;
     static constexpr const char* CAPTURETHREAD = "captureThread";
@@ -86,6 +89,7 @@ private:
     int32_t dhId_;
     std::thread captureDataThread_;
     AudioParam audioParam_;
+    std::shared_ptr<AudioDataPool> dataPool_ = nullptr;
     std::atomic<bool> isBlocking_ = false;
     std::atomic<bool> isCaptureReady_ = false;
     std::mutex devMtx_;
@@ -100,14 +104,9 @@ private:
     std::atomic<bool> isPauseStatus_ = false;
     FILE *dumpFile_ = nullptr;
     std::atomic<int64_t>  micDataPts_ = 0;
-    constexpr static int64_t AUDIO_FRAME_INTERVAL_US = 20000;
-    constexpr static int64_t TIME_CONVERSION_NTOU = 1000;
-    constexpr static int64_t TIME_CONVERSION_STOU = 1000000;
-    constexpr static int32_t REVISE_PER_FIFTY_FRAME = 50;
-    constexpr static int32_t LENGTH_PER_TRANS = 960;
-    constexpr static int32_t AUDIO_FRAME_INTERVAL_MS = 20;
-    std::atomic<int64_t> getAudioTimeCounter_ = 0;
-    int64_t frameIndex_ = 0;
+    DaudioClockModel clockModel_;
+    uint32_t bytesPerFrame_ = 0;
+    uint64_t capturedFrames_ = 0;
 };
 } // DistributedHardware
 } // OHOS
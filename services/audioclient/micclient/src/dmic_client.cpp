@@ -15,6 +15,7 @@
 
 #include "dmic_client.h"
 
+#include <algorithm>
 #include <chrono>
 
 #include "cJSON.h"
@@ -23,6 +24,7 @@
 #include "daudio_hisysevent.h"
 #include "daudio_sink_hidumper.h"
 #include "daudio_sink_manager.h"
+#include "daudio_util.h"
 
 #undef DH_LOG_TAG
 #define DH_LOG_TAG "DMicClient"
@@ -200,6 +202,9 @@ int32_t DMicClient::SetUp(const AudioParam &param)
         param.comParam.sampleRate, param.comParam.bitFormat, param.comParam.channelMask, param.captureOpts.sourceType,
         param.captureOpts.capturerFlags, param.comParam.frameSize);
     audioParam_ = param;
+    bytesPerFrame_ = static_cast<uint32_t>(audioParam_.comParam.channelMask) *
+        GetBytesPerSample(audioParam_.comParam.bitFormat);
+    dataPool_ = std::make_shared<AudioDataPool>(audioParam_.comParam.frameSize, AudioDataPool::DEFAULT_POOL_SIZE);
     DumpFileUtil::OpenDumpFile(DUMP_SERVER_PARA, DUMP_DAUDIO_MIC_BEFORE_TRANS_NAME, &dumpFile_);
     int32_t ret = AudioFwkClientSetUp();
     if (ret != DH_SUCCESS) {
@@ -278,6 +283,8 @@ int32_t DMicClient::StartCapture()
         DAudioHisysevent::GetInstance().SysEventWriteFault(DAUDIO_OPT_FAIL, ret, "daudio mic trans start failed.");
         return ret;
     }
+    clockModel_.Reset(static_cast<uint32_t>(audioParam_.comParam.sampleRate));
+    capturedFrames_ = 0;
     if (!audioCapturer_->Start()) {
         DHLOGE("Audio capturer start failed.");
         audioCapturer_->Release();
@@ -289,24 +296,46 @@ int32_t DMicClient::StartCapture()
     return DH_SUCCESS;
 }
 
-void DMicClient::CalcMicDataPts()
+void DMicClient::CalcMicDataPts(const size_t length)
 {
-    micDataPts_.fetch_add(AUDIO_FRAME_INTERVAL_US);
-    if (getAudioTimeCounter_ % REVISE_PER_FIFTY_FRAME == 0) {
+    if (audioCapturer_ != nullptr) {
         AudioStandard::Timestamp timestamp;
-        audioCapturer_->GetTimeStampInfo(timestamp, AudioStandard::Timestamp::Timestampbase::MONOTONIC);
-        int64_t ptsOrigin = timestamp.time.tv_sec * TIME_CONVERSION_STOU +
-            timestamp.time.tv_nsec / TIME_CONVERSION_NTOU;
-        int64_t frameNumOfPts = static_cast<int64_t>(timestamp.framePosition) / LENGTH_PER_TRANS;
-        int64_t ptsFinal = ptsOrigin - (frameNumOfPts - frameIndex_) * AUDIO_FRAME_INTERVAL_MS;
-        micDataPts_.store(ptsFinal);
-        getAudioTimeCounter_ = 0;
+        if (audioCapturer_->GetTimeStampInfo(timestamp, AudioStandard::Timestamp::Timestampbase::MONOTONIC) ==
+            DH_SUCCESS) {
+            clockModel_.AddSample(timestamp.framePosition,
+                timestamp.time.tv_sec * AUDIO_NS_PER_SECOND + timestamp.time.tv_nsec);
+        }
     }
+    uint64_t frames = bytesPerFrame_ == 0 ? 0 : length / bytesPerFrame_;
+    // The pts of a frame is the capture time of its first sample, in microseconds. Until the capturer
+    // has reported a timestamp, the frame is taken to have just finished capturing.
+    int64_t ptsNs = 0;
+    if (clockModel_.IsValid()) {
+        ptsNs = clockModel_.GetTimeNs(capturedFrames_);
+    } else if (audioParam_.comParam.sampleRate > 0) {
+        ptsNs = GetCurNano() - static_cast<int64_t>(frames) * AUDIO_NS_PER_SECOND / audioParam_.comParam.sampleRate;
+    }
+    int64_t pts = ptsNs / (AUDIO_NS_PER_SECOND / AUDIO_US_PER_SECOND);
+    micDataPts_.store(std::max(pts, micDataPts_.load()));
+    capturedFrames_ += frames;
+}
+
+std::shared_ptr<AudioData> DMicClient::AcquireCaptureFrame(bool zeroFill)
+{
+    size_t frameSize = audioParam_.comParam.frameSize;
+    std::shared_ptr<AudioData> audioData = micTrans_ == nullptr ? nullptr : micTrans_->AcquireSendBuffer(frameSize);
+    if (audioData == nullptr) {
+        return AcquireAudioData(dataPool_, frameSize, zeroFill);
+    }
+    if (zeroFill) {
+        (void)memset_s(audioData->Data(), audioData->Size(), 0, audioData->Size());
+    }
+    return audioData;
 }
 
 void DMicClient::AudioFwkCaptureData()
 {
-    std::shared_ptr<AudioData> audioData = std::make_shared<AudioData>(audioParam_.comParam.frameSize);
+    std::shared_ptr<AudioData> audioData = AcquireCaptureFrame(false);
     CHECK_NULL_VOID(audioData);
     size_t bytesRead = 0;
     bool errorFlag = false;
@@ -333,9 +362,7 @@ void DMicClient::AudioFwkCaptureData()
         DHLOGE("Bytes read failed.");
         return;
     }
-    CalcMicDataPts();
-    getAudioTimeCounter_++;
-    frameIndex_++;
+    CalcMicDataPts(bytesRead);
     DHLOGI("micDataPts_: %{public}" PRId64, micDataPts_.load());
     audioData->SetPts(micDataPts_.load());
     if (isPauseStatus_.load()) {
@@ -385,7 +412,7 @@ void DMicClient::OnReadData(size_t length)
     }
     CHECK_NULL_VOID(bufDesc.buffer);
 
-    std::shared_ptr<AudioData> audioData = std::make_shared<AudioData>(audioParam_.comParam.frameSize);
+    std::shared_ptr<AudioData> audioData = AcquireCaptureFrame(bufDesc.bufLength < audioParam_.comParam.frameSize);
     CHECK_NULL_VOID(audioData);
     if (audioData->Capacity() != bufDesc.bufLength) {
         uint64_t capacity = static_cast<uint64_t>(audioData->Capacity());
@@ -397,6 +424,8 @@ void DMicClient::OnReadData(size_t length)
         DHLOGE("Copy audio data failed.");
     }
 
+    CalcMicDataPts(bufDesc.bufLength);
+    audioData->SetPts(micDataPts_.load());
     if (isPauseStatus_.load()) {
         memset_s(audioData->Data(), audioData->Size(), 0, audioData->Size());
     }
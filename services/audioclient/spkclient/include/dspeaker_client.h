@@ -21,11 +21,11 @@
 #include <cstdint>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <securec.h>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
 #include <unistd.h>
 
 #include "audio_info.h"
@@ -33,13 +33,16 @@
 #include "audio_system_manager.h"
 
 #include "audio_data.h"
+#include "audio_data_queue.h"
 #include "audio_status.h"
 #include "audio_event.h"
 #include "av_receiver_engine_transport.h"
+#include "daudio_asrc.h"
 #include "daudio_constants.h"
 #include "daudio_errorcode.h"
 #include "daudio_log.h"
 #include "daudio_sink_ctrl_trans.h"
+#include "daudio_time_stretch.h"
 #include "iaudio_data_transport.h"
 #include "iaudio_datatrans_callback.h"
 #include "iaudio_event_callback.h"
@@ -85,20 +88,28 @@ public:
     void OnCtrlTransMessage(const std::shared_ptr<AVTransMessage> &message) override;
 
     void OnWriteData(size_t length) override;
+    uint32_t GetPlayoutTargetMs() const;
+    uint32_t GetPlayoutBufferedMs() const;
 private:
     std::string GetVolumeLevel();
     void PlayThreadRunning();
     void Pause();
     void ReStart();
     void FillJitterQueue();
-    void FlushJitterQueue();
+    void StartRenderThread();
+    void StopRenderThread();
+    void OnPlayoutResumed();
+    void InitPlayout();
+    size_t ReadPlayoutData(uint8_t *data, size_t len);
+    int32_t PushPlayoutData(const std::shared_ptr<AudioData> &audioData);
+    void OnPlayoutConsumed(size_t len);
+    void UpdatePlayoutRate();
     int32_t CreateAudioRenderer(const AudioParam &param);
 
 private:
-    constexpr static size_t DATA_QUEUE_MAX_SIZE = 12;
-    constexpr static size_t REQUEST_DATA_WAIT = 10;
-    constexpr static size_t DATA_QUEUE_SIZE = 8;
-    constexpr static size_t SLEEP_TIME = 5000;
+    constexpr static uint32_t DATA_QUEUE_MAX_SIZE = 12;
+    constexpr static int64_t REQUEST_DATA_WAIT_NS = 10000000;
+    constexpr static uint32_t DATA_QUEUE_SIZE = 8;
     static constexpr const char* RENDERTHREAD = "renderThread";
     const std::string DUMP_DAUDIO_SPK_AFTER_TRANS_NAME = "dump_sink_spk_recv_from_trans.pcm";
 
@@ -107,10 +118,26 @@ private:
     std::thread renderDataThread_;
     AudioParam audioParam_;
     std::atomic<bool> isRenderReady_ = false;
-    std::mutex dataQueueMtx_;
+    std::atomic<bool> isPlayoutPrimed_ = false;
+    // Futex word, 1 while paused; the render thread parks on it instead of exiting.
+    std::atomic<uint32_t> isPlayPaused_ = 0;
+    std::atomic<bool> isTransHealthy_ = false;
+    std::atomic<int64_t> resumeNs_ = 0;
+    // Bytes of renderBuffer_ still to be written, kept across a pause.
+    size_t renderLen_ = 0;
+    size_t renderOffset_ = 0;
     std::mutex devMtx_;
-    std::queue<std::shared_ptr<AudioData>> dataQueue_;
-    std::condition_variable dataQueueCond_;
+    AudioDataQueue dataQueue_ { DATA_QUEUE_MAX_SIZE + 1 };
+    DaudioTimeStretch timeStretch_;
+    DaudioPlayoutController playout_;
+    DaudioDriftEstimator drift_;
+    DaudioAsrc asrc_;
+    std::vector<uint8_t> renderBuffer_;
+    std::vector<uint8_t> asrcBuffer_;
+    uint32_t bytesPerFrame_ = 0;
+    uint32_t bytesPerMs_ = 0;
+    uint32_t prefillFrames_ = DATA_QUEUE_SIZE;
+    size_t lastFrameBytes_ = 0;
     std::atomic<AudioStatus> clientStatus_ = AudioStatus::STATUS_IDLE;
 
     std::unique_ptr<AudioStandard::AudioRenderer> audioRenderer_ = nullptr;
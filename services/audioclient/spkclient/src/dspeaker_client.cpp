@@ -15,6 +15,8 @@
 
 #include "dspeaker_client.h"
 
+#include <algorithm>
+
 #include "cJSON.h"
 
 #include "daudio_constants.h"
@@ -31,16 +33,19 @@ namespace DistributedHardware {
 DSpeakerClient::~DSpeakerClient()
 {
     DHLOGD("Release speaker client.");
+    StopRenderThread();
     DumpFileUtil::CloseDumpFile(&dumpFile_);
 }
 
 void DSpeakerClient::OnEngineTransEvent(const AVTransEvent &event)
 {
     if (event.type == EventType::EVENT_START_SUCCESS) {
+        isTransHealthy_.store(true);
         OnStateChange(DATA_OPENED);
     } else if ((event.type == EventType::EVENT_STOP_SUCCESS) ||
         (event.type == EventType::EVENT_CHANNEL_CLOSED) ||
         (event.type == EventType::EVENT_START_FAIL)) {
+        isTransHealthy_.store(false);
         OnStateChange(DATA_CLOSED);
     }
 }
@@ -150,29 +155,113 @@ void DSpeakerClient::OnWriteData(size_t length)
     }
     CHECK_NULL_VOID(bufDesc.buffer);
 
-    std::shared_ptr<AudioData> audioData = nullptr;
-    {
-        std::unique_lock<std::mutex> spkLck(dataQueueMtx_);
-        if (dataQueue_.empty()) {
-            audioData = std::make_shared<AudioData>(bufDesc.bufLength);
-            DHLOGD("Pop spk data, dataQueue is empty. write empty data.");
-        } else {
-            audioData = dataQueue_.front();
-            dataQueue_.pop();
-            uint64_t queueSize = static_cast<uint64_t>(dataQueue_.size());
-            DHLOGD("Pop spk data, dataQueue size: %{public}" PRIu64, queueSize);
-        }
+    // The renderer picks its own buffer size, so fill it from the byte stream behind the time stretch rather
+    // than frame by frame; a partial frame stays there for the next callback. Like the normal mode, play
+    // silence until the queue has been primed once, then only on a real underrun.
+    size_t readLen = 0;
+    if (isPlayoutPrimed_.load() || dataQueue_.Size() >= prefillFrames_) {
+        isPlayoutPrimed_.store(true);
+        readLen = ReadPlayoutData(bufDesc.buffer, bufDesc.bufLength);
     }
-    if ((audioData != nullptr) && (audioData->Capacity() != bufDesc.bufLength)) {
-        uint64_t capacity = static_cast<uint64_t>(audioData->Capacity());
-        uint64_t bufLength = static_cast<uint64_t>(bufDesc.bufLength);
-        DHLOGE("Audio data length is not equal to buflength. datalength: %{public}" PRIu64
-            ", bufLength: %{public}" PRIu64, capacity, bufLength);
+    DHLOGD("Pop spk data, dataQueue size: %{public}u, read len: %{public}zu", dataQueue_.Size(), readLen);
+    if (readLen > 0) {
+        OnPlayoutResumed();
     }
-    if (memcpy_s(bufDesc.buffer, bufDesc.bufLength, audioData->Data(), audioData->Capacity()) != EOK) {
-        DHLOGE("Copy audio data failed.");
+    if (readLen < bufDesc.bufLength) {
+        DHLOGD("Spk playout data is not enough, fill the rest with empty data.");
+        (void)memset_s(bufDesc.buffer + readLen, bufDesc.bufLength - readLen, 0, bufDesc.bufLength - readLen);
     }
     audioRenderer_->Enqueue(bufDesc);
+    OnPlayoutConsumed(bufDesc.bufLength);
+}
+
+void DSpeakerClient::InitPlayout()
+{
+    uint32_t sampleRate = static_cast<uint32_t>(audioParam_.comParam.sampleRate);
+    uint32_t channels = static_cast<uint32_t>(audioParam_.comParam.channelMask);
+    bytesPerFrame_ = channels * GetBytesPerSample(audioParam_.comParam.bitFormat);
+    bytesPerMs_ = sampleRate * bytesPerFrame_ / AUDIO_MS_PER_SECOND;
+    if (timeStretch_.Init(sampleRate, channels, audioParam_.comParam.bitFormat) != DH_SUCCESS) {
+        DHLOGI("Time stretch is not supported for this stream, play out without adaptation.");
+    }
+    if (asrc_.Init(channels, audioParam_.comParam.bitFormat) != DH_SUCCESS) {
+        DHLOGI("Asrc is not supported for this stream, play out without drift correction.");
+    }
+    drift_.Reset(sampleRate);
+    int32_t targetMs = static_cast<int32_t>(DaudioPlayoutController::PLAYOUT_DEFAULT_TARGET_MS);
+    if (!GetSysPara(SPK_PLAYOUT_TARGET_PARA.c_str(), targetMs) || targetMs <= 0) {
+        targetMs = static_cast<int32_t>(DaudioPlayoutController::PLAYOUT_DEFAULT_TARGET_MS);
+    }
+    playout_.Reset(static_cast<uint32_t>(targetMs));
+    uint32_t frameSize = audioParam_.comParam.frameSize;
+    prefillFrames_ = DATA_QUEUE_SIZE;
+    if (bytesPerMs_ != 0 && frameSize >= bytesPerMs_) {
+        uint32_t frameMs = frameSize / bytesPerMs_;
+        prefillFrames_ = std::clamp<uint32_t>((static_cast<uint32_t>(targetMs) + frameMs - 1) / frameMs, 1,
+            DATA_QUEUE_SIZE);
+    }
+    renderBuffer_.assign(frameSize != 0 ? frameSize : DEFAULT_AUDIO_DATA_SIZE, 0);
+    lastFrameBytes_ = renderBuffer_.size();
+    DHLOGI("Init playout, target: %{public}d ms, prefill frames: %{public}u.", targetMs, prefillFrames_);
+}
+
+size_t DSpeakerClient::ReadPlayoutData(uint8_t *data, size_t len)
+{
+    size_t readLen = timeStretch_.Pull(data, len);
+    while (readLen < len) {
+        std::shared_ptr<AudioData> audioData = dataQueue_.Pop();
+        if (audioData == nullptr) {
+            break;
+        }
+        DumpFileUtil::WriteDumpFile(dumpFile_, static_cast<void *>(audioData->Data()), audioData->Size());
+        lastFrameBytes_ = audioData->Size();
+        if (PushPlayoutData(audioData) != DH_SUCCESS) {
+            DHLOGE("Push spk data to time stretch failed.");
+            continue;
+        }
+        UpdatePlayoutRate();
+        readLen += timeStretch_.Pull(data + readLen, len - readLen);
+    }
+    return readLen;
+}
+
+int32_t DSpeakerClient::PushPlayoutData(const std::shared_ptr<AudioData> &audioData)
+{
+    // Follow the renderer clock first, so the time stretch only has to absorb network jitter.
+    asrc_.SetRatio(drift_.GetRatio());
+    if (!asrc_.IsEngaged()) {
+        return timeStretch_.Push(audioData->Data(), audioData->Size());
+    }
+    asrcBuffer_.resize(asrc_.GetMaxOutputBytes(audioData->Size()));
+    size_t len = asrc_.Process(audioData->Data(), audioData->Size(), asrcBuffer_.data(), asrcBuffer_.size());
+    return timeStretch_.Push(asrcBuffer_.data(), len);
+}
+
+void DSpeakerClient::OnPlayoutConsumed(size_t len)
+{
+    if (bytesPerFrame_ != 0) {
+        drift_.OnConsumed(len / bytesPerFrame_, GetCurNano());
+    }
+}
+
+void DSpeakerClient::UpdatePlayoutRate()
+{
+    if (bytesPerMs_ == 0) {
+        return;
+    }
+    size_t bufferedBytes = dataQueue_.Size() * lastFrameBytes_ + timeStretch_.GetBufferedBytes();
+    double rate = playout_.Update(static_cast<uint32_t>(bufferedBytes / bytesPerMs_));
+    timeStretch_.SetRate(rate);
+}
+
+uint32_t DSpeakerClient::GetPlayoutTargetMs() const
+{
+    return playout_.GetTargetMs();
+}
+
+uint32_t DSpeakerClient::GetPlayoutBufferedMs() const
+{
+    return playout_.GetBufferedMs();
 }
 
 int32_t DSpeakerClient::SetUp(const AudioParam &param)
@@ -182,6 +271,7 @@ int32_t DSpeakerClient::SetUp(const AudioParam &param)
         DHLOGE("Set up failed, Create Audio renderer failed.");
         return ret;
     }
+    InitPlayout();
     DumpFileUtil::OpenDumpFile(DUMP_SERVER_PARA, DUMP_DAUDIO_SPK_AFTER_TRANS_NAME, &dumpFile_);
     if (speakerTrans_ == nullptr) {
         DHLOGE("Speaker trans is nullptr.");
@@ -259,16 +349,15 @@ int32_t DSpeakerClient::StartRender()
     std::lock_guard<std::mutex> lck(devMtx_);
     CHECK_NULL_RETURN(audioRenderer_, ERR_DH_AUDIO_SA_STATUS_ERR);
 
+    isPlayoutPrimed_.store(false);
+    isPlayPaused_.store(0);
     if (!audioRenderer_->Start()) {
         DHLOGE("Audio renderer start failed.");
         DAudioHisysevent::GetInstance().SysEventWriteFault(DAUDIO_OPT_FAIL, ERR_DH_AUDIO_CLIENT_RENDER_STARTUP_FAILURE,
             "daudio renderer start failed.");
         return ERR_DH_AUDIO_CLIENT_RENDER_STARTUP_FAILURE;
     }
-    if (audioParam_.renderOpts.renderFlags != MMAP_MODE) {
-        isRenderReady_.store(true);
-        renderDataThread_ = std::thread([this]() { this->PlayThreadRunning(); });
-    }
+    StartRenderThread();
     clientStatus_.store(AudioStatus::STATUS_START);
     return DH_SUCCESS;
 }
@@ -290,14 +379,10 @@ int32_t DSpeakerClient::StopRender()
         return ERR_DH_AUDIO_NULLPTR;
     }
 
-    if (audioParam_.renderOpts.renderFlags != MMAP_MODE) {
-        if (isRenderReady_.load()) {
-            isRenderReady_.store(false);
-            if (renderDataThread_.joinable()) {
-                renderDataThread_.join();
-            }
-        }
-    }
+    StopRenderThread();
+    DHLOGI("Spk playout target: %{public}u ms, buffered: %{public}u ms, stretched hops: %{public}" PRIu64
+        ", drift: %{public}.2f ppm, dropped frames: %{public}" PRIu64 ".", playout_.GetTargetMs(),
+        playout_.GetBufferedMs(), timeStretch_.GetStretchedHops(), drift_.GetDriftPpm(), dataQueue_.GetDropCount());
 
     if (!audioRenderer_->Stop()) {
         DHLOGE("Audio renderer stop failed");
@@ -309,6 +394,27 @@ int32_t DSpeakerClient::StopRender()
     return DH_SUCCESS;
 }
 
+void DSpeakerClient::StartRenderThread()
+{
+    if (audioParam_.renderOpts.renderFlags == MMAP_MODE || renderDataThread_.joinable()) {
+        return;
+    }
+    renderLen_ = 0;
+    renderOffset_ = 0;
+    isRenderReady_.store(true);
+    renderDataThread_ = std::thread([this]() { this->PlayThreadRunning(); });
+}
+
+void DSpeakerClient::StopRenderThread()
+{
+    isRenderReady_.store(false);
+    dataQueue_.Wakeup();
+    FutexWake(isPlayPaused_, INT32_MAX);
+    if (renderDataThread_.joinable()) {
+        renderDataThread_.join();
+    }
+}
+
 void DSpeakerClient::PlayThreadRunning()
 {
     DHLOGD("Start the renderer thread.");
@@ -318,36 +424,40 @@ void DSpeakerClient::PlayThreadRunning()
 
     FillJitterQueue();
     while (audioRenderer_ != nullptr && isRenderReady_.load()) {
+        if (isPlayPaused_.load() != 0) {
+            // Park without touching the queue, so what is buffered is what plays first on resume.
+            FutexWait(isPlayPaused_, 1, REQUEST_DATA_WAIT_NS);
+            continue;
+        }
         int64_t startTime = GetNowTimeUs();
-        std::shared_ptr<AudioData> audioData = nullptr;
-        {
-            std::unique_lock<std::mutex> spkLck(dataQueueMtx_);
-            dataQueueCond_.wait_for(spkLck, std::chrono::milliseconds(REQUEST_DATA_WAIT),
-                [this]() { return !dataQueue_.empty(); });
-            if (dataQueue_.empty()) {
+        if (renderOffset_ == renderLen_) {
+            renderLen_ = ReadPlayoutData(renderBuffer_.data(), renderBuffer_.size());
+            renderOffset_ = 0;
+            if (renderLen_ == 0) {
+                dataQueue_.WaitSize(1, REQUEST_DATA_WAIT_NS);
                 continue;
             }
-            audioData = dataQueue_.front();
-            dataQueue_.pop();
-            uint64_t queueSize = static_cast<uint64_t>(dataQueue_.size());
-            DHLOGD("Pop spk data, dataqueue size: %{public}" PRIu64, queueSize);
-        }
-        if (audioData == nullptr) {
-            continue;
         }
-        DumpFileUtil::WriteDumpFile(dumpFile_, static_cast<void *>(audioData->Data()), audioData->Size());
-        int32_t writeOffSet = 0;
-        while (writeOffSet < static_cast<int32_t>(audioData->Capacity())) {
-            int32_t writeLen = audioRenderer_->Write(audioData->Data() + writeOffSet,
-                static_cast<int32_t>(audioData->Capacity()) - writeOffSet);
-            uint64_t capacity = static_cast<uint64_t>(audioData->Capacity());
-            DHLOGD("Write audio render, write len: %{public}d, raw len: %{public}" PRIu64", offset: %{public}d",
-                writeLen, capacity, writeOffSet);
+        DHLOGD("Pop spk data, dataqueue size: %{public}u", dataQueue_.Size());
+        size_t writeStart = renderOffset_;
+        while (renderOffset_ < renderLen_) {
+            int32_t writeLen = audioRenderer_->Write(renderBuffer_.data() + renderOffset_, renderLen_ - renderOffset_);
+            DHLOGD("Write audio render, write len: %{public}d, raw len: %{public}zu, offset: %{public}zu",
+                writeLen, renderLen_, renderOffset_);
             if (writeLen < 0) {
+                // A write cut short by a pause is finished after resume; any other failure drops the rest.
+                if (isPlayPaused_.load() == 0) {
+                    renderOffset_ = renderLen_;
+                }
                 break;
             }
-            writeOffSet += writeLen;
+            renderOffset_ += static_cast<size_t>(writeLen);
+            if (writeLen > 0) {
+                // Also covers the rest of a write cut short by the pause, which is what plays first on resume.
+                OnPlayoutResumed();
+            }
         }
+        OnPlayoutConsumed(renderOffset_ - writeStart);
         int64_t endTime = GetNowTimeUs();
         if (IsOutDurationRange(startTime, endTime, lastPlayStartTime_)) {
             DHLOGD("This time play spend: %{public}" PRId64" us, The interval of play this time and "
@@ -357,29 +467,21 @@ void DSpeakerClient::PlayThreadRunning()
     }
 }
 
-void DSpeakerClient::FillJitterQueue()
+void DSpeakerClient::OnPlayoutResumed()
 {
-    while (isRenderReady_.load()) {
-        {
-            std::lock_guard<std::mutex> lock(dataQueueMtx_);
-            if (dataQueue_.size() >= DATA_QUEUE_SIZE) {
-                break;
-            }
-        }
-        usleep(SLEEP_TIME);
+    int64_t resumeNs = resumeNs_.exchange(0);
+    if (resumeNs != 0) {
+        DHLOGI("Spk resume to first sample: %{public}" PRId64 " us.",
+            (GetCurNano() - resumeNs) * AUDIO_US_PER_SECOND / AUDIO_NS_PER_SECOND);
     }
 }
 
-void DSpeakerClient::FlushJitterQueue()
+void DSpeakerClient::FillJitterQueue()
 {
     while (isRenderReady_.load()) {
-        {
-            std::lock_guard<std::mutex> lock(dataQueueMtx_);
-            if (dataQueue_.empty()) {
-                break;
-            }
+        if (dataQueue_.WaitSize(prefillFrames_, REQUEST_DATA_WAIT_NS) == DH_SUCCESS) {
+            break;
         }
-        usleep(SLEEP_TIME);
     }
 }
 
@@ -389,15 +491,13 @@ int32_t DSpeakerClient::OnDecodeTransDataDone(const std::shared_ptr<AudioData> &
     int64_t startTime = GetNowTimeUs();
     CHECK_NULL_RETURN(audioData, ERR_DH_AUDIO_NULLPTR);
 
-    std::lock_guard<std::mutex> lock(dataQueueMtx_);
-    while (dataQueue_.size() > DATA_QUEUE_MAX_SIZE) {
-        DHLOGD("Data queue overflow.");
-        dataQueue_.pop();
+    if (bytesPerFrame_ != 0) {
+        drift_.OnProduced(audioData->Size() / bytesPerFrame_, GetCurNano());
     }
-    dataQueue_.push(audioData);
-    dataQueueCond_.notify_all();
-    uint64_t queueSize = static_cast<uint64_t>(dataQueue_.size());
-    DHLOGD("Push new spk data, buf len: %{public}" PRIu64, queueSize);
+    // A full queue evicts its oldest frame, so the newest audio is always the one kept.
+    dataQueue_.Push(audioData);
+    DHLOGD("Push new spk data, buf len: %{public}u, dropped: %{public}" PRIu64, dataQueue_.Size(),
+        dataQueue_.GetDropCount());
     int64_t endTime = GetNowTimeUs();
     if (IsOutDurationRange(startTime, endTime, lastReceiveStartTime_)) {
         DHLOGD("This time receivce data spend: %{public}" PRId64" us, Receivce data this time and "
@@ -617,40 +717,31 @@ int32_t DSpeakerClient::SetMute(const AudioEvent &event)
 
 void DSpeakerClient::Pause()
 {
-    DHLOGI("Pause and flush");
-    FlushJitterQueue();
-    if (audioParam_.renderOpts.renderFlags != MMAP_MODE) {
-        isRenderReady_.store(false);
-        if (renderDataThread_.joinable()) {
-            renderDataThread_.join();
-        }
-    }
-
-    if (speakerTrans_ == nullptr || speakerTrans_->Pause() != DH_SUCCESS) {
-        DHLOGE("Speaker trans Pause failed.");
-    }
+    // Pausing only parks the render thread and the renderer: queued and partly written audio are kept,
+    // so resume neither re-primes the jitter queue nor recreates the thread.
+    DHLOGI("Pause spk client.");
+    isPlayPaused_.store(1);
+    dataQueue_.Wakeup();
     if (audioRenderer_ != nullptr) {
-        audioRenderer_->Flush();
         audioRenderer_->Pause();
     }
-    clientStatus_.store(AudioStatus::STATUS_START);
-    isRenderReady_.store(true);
 }
 
 void DSpeakerClient::ReStart()
 {
-    DHLOGI("ReStart");
-    if (speakerTrans_ == nullptr || speakerTrans_->Restart(audioParam_, audioParam_) != DH_SUCCESS) {
-        DHLOGE("Speaker trans Restart failed.");
-    }
-    if (audioParam_.renderOpts.renderFlags != MMAP_MODE) {
-        isRenderReady_.store(true);
-        auto self = shared_from_this();
-        renderDataThread_ = std::thread([self]() { self->PlayThreadRunning(); });
+    DHLOGI("ReStart spk client, trans healthy: %{public}d.", isTransHealthy_.load());
+    if (!isTransHealthy_.load()) {
+        if (speakerTrans_ == nullptr || speakerTrans_->Restart(audioParam_, audioParam_) != DH_SUCCESS) {
+            DHLOGE("Speaker trans Restart failed.");
+        }
     }
+    resumeNs_.store(GetCurNano());
     if (audioRenderer_ != nullptr) {
         audioRenderer_->Start();
+        StartRenderThread();
     }
+    isPlayPaused_.store(0);
+    FutexWake(isPlayPaused_, INT32_MAX);
     clientStatus_.store(AudioStatus::STATUS_START);
 }
 
@@ -16,6 +16,7 @@
 #include "dmic_client_test.h"
 
 #include "audio_event.h"
+#include "daudio_util.h"
 
 using namespace testing::ext;
 
@@ -234,15 +235,28 @@ HWTEST_F(DMicClientTest, TransSetUp_001, TestSize.Level0)
 
 /**
  * @tc.name: CalcMicDataPts_001
- * @tc.desc: Verify the CalcMicDataPts function.
+ * @tc.desc: Verify the CalcMicDataPts function stamps each frame with the modelled time of its first sample.
  * @tc.type: FUNC
  * @tc.require: AR000H0E6G
  */
 HWTEST_F(DMicClientTest, CalcMicDataPts_001, TestSize.Level0)
 {
-    micClient_->getAudioTimeCounter_ = 1;
-    micClient_->CalcMicDataPts();
-    EXPECT_NE(micClient_->getAudioTimeCounter_, 0);
+    ASSERT_TRUE(micClient_ != nullptr);
+    constexpr uint32_t sampleRate = 48000;
+    constexpr uint32_t bytesPerFrame = 4;
+    constexpr size_t frameSize = 3840;
+    micClient_->audioCapturer_ = nullptr;
+    micClient_->bytesPerFrame_ = bytesPerFrame;
+    micClient_->capturedFrames_ = 0;
+    micClient_->micDataPts_.store(0);
+    micClient_->clockModel_.Reset(sampleRate);
+    micClient_->clockModel_.AddSample(0, AUDIO_NS_PER_SECOND);
+    micClient_->CalcMicDataPts(frameSize);
+    EXPECT_EQ(AUDIO_US_PER_SECOND, micClient_->micDataPts_.load());
+    EXPECT_EQ(frameSize / bytesPerFrame, micClient_->capturedFrames_);
+    micClient_->CalcMicDataPts(frameSize);
+    EXPECT_EQ(AUDIO_US_PER_SECOND + AUDIO_US_PER_SECOND * frameSize / bytesPerFrame / sampleRate,
+        micClient_->micDataPts_.load());
 }
 
 /**
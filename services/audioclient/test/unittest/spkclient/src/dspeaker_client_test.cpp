@@ -17,6 +17,7 @@
 
 #include <thread>
 #include <chrono>
+#include <cmath>
 
 #include "av_trans_types.h"
 
@@ -161,13 +162,12 @@ HWTEST_F(DSpeakerClientTest, StopRender001, TestSize.Level0)
     std::string args = "args";
     AudioEvent event;
     speakerClient_->isRenderReady_ = true;
-    speakerClient_->FlushJitterQueue();
     speakerClient_->PlayStatusChange(args);
     speakerClient_->SetAudioParameters(event);
     speakerClient_->SetMute(event);
     for (size_t i = 0; i < 10; i++) {
         std::shared_ptr<AudioData> data = std::make_shared<AudioData>(4096);
-        speakerClient_->dataQueue_.push(data);
+        speakerClient_->dataQueue_.Push(data);
     }
     args = "restart";
     speakerClient_->PlayStatusChange(args);
@@ -194,12 +194,34 @@ HWTEST_F(DSpeakerClientTest, OnDecodeTransDataDone001, TestSize.Level0)
     EXPECT_EQ(ERR_DH_AUDIO_NULLPTR, speakerClient_->OnDecodeTransDataDone(audioData));
     for (size_t i = 0; i < 11; i++) {
         std::shared_ptr<AudioData> data = std::make_shared<AudioData>(4096);
-        speakerClient_->dataQueue_.push(data);
+        speakerClient_->dataQueue_.Push(data);
     }
     audioData = std::make_shared<AudioData>(4096);
     EXPECT_EQ(DH_SUCCESS, speakerClient_->OnDecodeTransDataDone(audioData));
 }
 
+/**
+ * @tc.name: OnDecodeTransDataDone_002
+ * @tc.desc: Verify a stalled render thread only loses the oldest frames and the losses are counted.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E6G
+ */
+HWTEST_F(DSpeakerClientTest, OnDecodeTransDataDone002, TestSize.Level0)
+{
+    ASSERT_TRUE(speakerClient_ != nullptr);
+    AudioDataQueue &queue = speakerClient_->dataQueue_;
+    int64_t frameNum = static_cast<int64_t>(queue.mask_) + 4;
+    for (int64_t i = 0; i < frameNum; i++) {
+        auto data = std::make_shared<AudioData>(4096);
+        data->SetPts(i);
+        EXPECT_EQ(DH_SUCCESS, speakerClient_->OnDecodeTransDataDone(data));
+    }
+    EXPECT_EQ(3, queue.GetDropCount());
+    int64_t maxDepth = static_cast<int64_t>(queue.MaxDepth());
+    EXPECT_EQ(frameNum - maxDepth, queue.Pop()->GetPts());
+    EXPECT_EQ(frameNum - maxDepth, static_cast<int64_t>(queue.GetDropCount()));
+}
+
 /**
  * @tc.name: Release_001
  * @tc.desc: Verify the Release function.
@@ -255,5 +277,170 @@ HWTEST_F(DSpeakerClientTest, SendMessage_001, TestSize.Level0)
     speakerClient_->speakerCtrlTrans_ = nullptr;
     EXPECT_EQ(ERR_DH_AUDIO_NULLPTR, speakerClient_->SendMessage(NOTIFY_OPEN_SPEAKER_RESULT, content, dstDevId));
 }
+
+/**
+ * @tc.name: ReadPlayoutData_001
+ * @tc.desc: Verify 16-bit audio passes through the time stretch byte-accurately while the buffer is on target.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E6G
+ */
+HWTEST_F(DSpeakerClientTest, ReadPlayoutData_001, TestSize.Level0)
+{
+    ASSERT_TRUE(speakerClient_ != nullptr);
+    audioParam_.comParam.frameSize = 1920;
+    speakerClient_->audioParam_ = audioParam_;
+    speakerClient_->InitPlayout();
+    ASSERT_NE(0, speakerClient_->bytesPerMs_);
+    const size_t frameSize = audioParam_.comParam.frameSize;
+    const uint32_t targetMs = speakerClient_->GetPlayoutTargetMs();
+    std::vector<uint8_t> expected;
+    auto pushFrame = [this, frameSize, &expected]() {
+        std::shared_ptr<AudioData> data = std::make_shared<AudioData>(frameSize);
+        for (size_t j = 0; j < data->Size(); j++) {
+            data->Data()[j] = static_cast<uint8_t>(expected.size() + j);
+        }
+        expected.insert(expected.end(), data->Data(), data->Data() + data->Size());
+        speakerClient_->dataQueue_.Push(data);
+    };
+    // 1000 bytes does not divide the frame size, so reads keep straddling frame boundaries. The queue is
+    // topped up to the playout target before every read, so the controller keeps the stretch rate at 1.
+    const uint32_t readNum = 200;
+    std::vector<uint8_t> buffer(1000);
+    std::vector<uint8_t> played;
+    for (uint32_t i = 0; i < readNum; i++) {
+        while ((speakerClient_->dataQueue_.Size() * frameSize + speakerClient_->timeStretch_.GetBufferedBytes()) /
+            speakerClient_->bytesPerMs_ < targetMs) {
+            pushFrame();
+        }
+        size_t len = speakerClient_->ReadPlayoutData(buffer.data(), buffer.size());
+        played.insert(played.end(), buffer.begin(), buffer.begin() + len);
+    }
+    ASSERT_EQ(readNum * buffer.size(), played.size());
+    EXPECT_TRUE(std::equal(played.begin(), played.end(), expected.begin()));
+    EXPECT_EQ(0, speakerClient_->timeStretch_.GetStretchedHops());
+}
+
+/**
+ * @tc.name: ReadPlayoutData_002
+ * @tc.desc: Verify a buffer above the playout target is drained faster through the asrc and the time stretch.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E6G
+ */
+HWTEST_F(DSpeakerClientTest, ReadPlayoutData_002, TestSize.Level0)
+{
+    ASSERT_TRUE(speakerClient_ != nullptr);
+    audioParam_.comParam.frameSize = 3840;
+    speakerClient_->audioParam_ = audioParam_;
+    speakerClient_->InitPlayout();
+    const uint32_t targetMs = 20;
+    speakerClient_->playout_.Reset(targetMs);
+    speakerClient_->asrc_.SetRatio(1.0005);
+    ASSERT_TRUE(speakerClient_->asrc_.IsEngaged());
+    const size_t frameNum = 12;
+    const double toneHz = 440.0;
+    const double amplitude = 8000.0;
+    const size_t bytesPerFrame = speakerClient_->bytesPerFrame_;
+    size_t pushed = 0;
+    uint64_t sample = 0;
+    for (size_t i = 0; i < frameNum; i++) {
+        std::shared_ptr<AudioData> data = std::make_shared<AudioData>(audioParam_.comParam.frameSize);
+        int16_t *samples = reinterpret_cast<int16_t *>(data->Data());
+        for (size_t j = 0; j < data->Size() / bytesPerFrame; j++, sample++) {
+            int16_t value = static_cast<int16_t>(amplitude * std::sin(2 * M_PI * toneHz * sample / SAMPLE_RATE_48000));
+            samples[2 * j] = value;
+            samples[2 * j + 1] = value;
+        }
+        speakerClient_->dataQueue_.Push(data);
+        pushed += data->Size();
+    }
+    std::vector<uint8_t> buffer(1000);
+    size_t played = 0;
+    size_t len = 0;
+    while ((len = speakerClient_->ReadPlayoutData(buffer.data(), buffer.size())) > 0) {
+        played += len;
+    }
+    EXPECT_GT(speakerClient_->timeStretch_.GetStretchedHops(), 0);
+    EXPECT_LT(played, pushed);
+    EXPECT_EQ(0, played % bytesPerFrame);
+}
+
+/**
+ * @tc.name: PauseResume_001
+ * @tc.desc: Verify pause keeps the primed queue and audio is available right after resume.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E6G
+ */
+HWTEST_F(DSpeakerClientTest, PauseResume_001, TestSize.Level0)
+{
+    ASSERT_TRUE(speakerClient_ != nullptr);
+    audioParam_.comParam.frameSize = 3840;
+    speakerClient_->audioParam_ = audioParam_;
+    speakerClient_->InitPlayout();
+    for (uint32_t i = 0; i < speakerClient_->prefillFrames_; i++) {
+        speakerClient_->dataQueue_.Push(std::make_shared<AudioData>(audioParam_.comParam.frameSize));
+    }
+    speakerClient_->isPlayoutPrimed_.store(true);
+    uint32_t queued = speakerClient_->dataQueue_.Size();
+    std::vector<uint8_t> buffer(audioParam_.comParam.frameSize);
+
+    const int64_t maxResumeMs = 20;
+    auto start = std::chrono::steady_clock::now();
+    speakerClient_->Pause();
+    EXPECT_EQ(1, speakerClient_->isPlayPaused_.load());
+    EXPECT_EQ(queued, speakerClient_->dataQueue_.Size());
+    speakerClient_->ReStart();
+    EXPECT_EQ(0, speakerClient_->isPlayPaused_.load());
+    EXPECT_EQ(buffer.size(), speakerClient_->ReadPlayoutData(buffer.data(), buffer.size()));
+    int64_t elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    EXPECT_LT(elapsedMs, maxResumeMs);
+    EXPECT_TRUE(speakerClient_->isPlayoutPrimed_.load());
+    EXPECT_FALSE(speakerClient_->renderDataThread_.joinable());
+}
+
+#ifdef UT_COVER_SPECIAL
+/**
+ * @tc.name: PauseResume_002
+ * @tc.desc: Verify the running render thread writes the first sample soon after resume.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E6G
+ */
+HWTEST_F(DSpeakerClientTest, PauseResume_002, TestSize.Level0)
+{
+    ASSERT_TRUE(speakerClient_ != nullptr);
+    audioParam_.comParam.frameSize = 3840;
+    speakerClient_->audioParam_ = audioParam_;
+    ASSERT_EQ(DH_SUCCESS, speakerClient_->CreateAudioRenderer(audioParam_));
+    ASSERT_TRUE(speakerClient_->audioRenderer_ != nullptr);
+    speakerClient_->InitPlayout();
+    ASSERT_TRUE(speakerClient_->audioRenderer_->Start());
+    for (uint32_t i = 0; i < speakerClient_->prefillFrames_; i++) {
+        speakerClient_->dataQueue_.Push(std::make_shared<AudioData>(audioParam_.comParam.frameSize));
+    }
+    speakerClient_->StartRenderThread();
+    ASSERT_TRUE(speakerClient_->renderDataThread_.joinable());
+
+    speakerClient_->Pause();
+    for (uint32_t i = 0; i < speakerClient_->prefillFrames_; i++) {
+        speakerClient_->dataQueue_.Push(std::make_shared<AudioData>(audioParam_.comParam.frameSize));
+    }
+    const int64_t maxResumeMs = 20;
+    const int64_t waitLimitMs = 1000;
+    auto start = std::chrono::steady_clock::now();
+    speakerClient_->ReStart();
+    int64_t elapsedMs = 0;
+    while (speakerClient_->resumeNs_.load() != 0 && elapsedMs < waitLimitMs) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count();
+    }
+    EXPECT_EQ(0, speakerClient_->resumeNs_.load());
+    EXPECT_LT(elapsedMs, maxResumeMs);
+
+    speakerClient_->StopRenderThread();
+    speakerClient_->audioRenderer_->Stop();
+    speakerClient_->audioRenderer_->Release();
+}
+#endif
 } // DistributedHardware
 } // OHOS
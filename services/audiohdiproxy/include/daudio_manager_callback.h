@@ -16,9 +16,12 @@
 #ifndef OHOS_DAUDIO_MANAGER_CALLBACK_H
 #define OHOS_DAUDIO_MANAGER_CALLBACK_H
 
+#include <mutex>
+
 #include <v3_0/id_audio_callback.h>
 #include <v3_0/types.h>
 
+#include "audio_data_pool.h"
 #include "idaudio_hdi_callback.h"
 
 namespace OHOS {
@@ -60,6 +63,8 @@ private:
 
 private:
     std::shared_ptr<IDAudioHdiCallback> callback_;
+    std::mutex dataPoolMtx_;
+    std::shared_ptr<AudioDataPool> dataPool_ = nullptr;
 };
 } // DistributedHardware
 } // OHOS
@@ -38,6 +38,14 @@ public:
 
     virtual int32_t ReadStreamData(const int32_t streamId, std::shared_ptr<AudioData> &data) = 0;
 
+    // Frame for WriteStreamData to fill in place; nullptr lets the caller use its own buffer.
+    virtual std::shared_ptr<AudioData> AcquireStreamBuffer(const int32_t streamId, const size_t size)
+    {
+        (void)streamId;
+        (void)size;
+        return nullptr;
+    }
+
     virtual int32_t ReadMmapPosition(const int32_t streamId, uint64_t &frames, CurrentTimeHDF &time) = 0;
 
     virtual int32_t RefreshAshmemInfo(const int32_t streamId,
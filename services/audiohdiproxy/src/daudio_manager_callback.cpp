@@ -181,14 +181,27 @@ int32_t DAudioManagerCallback::WriteStreamData(int32_t streamId,
         return HDF_FAILURE;
     }
 
-    std::shared_ptr<AudioData> audioData = std::make_shared<AudioData>(data.param.frameSize);
+    CHECK_NULL_RETURN(callback_, HDF_FAILURE);
+    size_t frameSize = static_cast<size_t>(data.param.frameSize);
+    bool zeroFill = data.data.size() < frameSize;
+    // Copy the payload straight into the speaker's send buffer when it lends one.
+    std::shared_ptr<AudioData> audioData = callback_->AcquireStreamBuffer(streamId, frameSize);
+    if (audioData != nullptr && zeroFill) {
+        (void)memset_s(audioData->Data(), audioData->Size(), 0, audioData->Size());
+    }
+    if (audioData == nullptr) {
+        std::lock_guard<std::mutex> lock(dataPoolMtx_);
+        if (dataPool_ == nullptr || dataPool_->Capacity() != frameSize) {
+            dataPool_ = std::make_shared<AudioDataPool>(frameSize, AudioDataPool::DEFAULT_POOL_SIZE);
+        }
+        audioData = dataPool_->Acquire(frameSize, zeroFill);
+    }
     int32_t ret = memcpy_s(audioData->Data(), audioData->Capacity(), data.data.data(), data.data.size());
     if (ret != EOK) {
         DHLOGE("Copy audio data failed, error code %{public}d.", ret);
         return HDF_FAILURE;
     }
 
-    CHECK_NULL_RETURN(callback_, HDF_FAILURE);
     if (callback_->WriteStreamData(streamId, audioData) != DH_SUCCESS) {
         DHLOGE("WriteStreamData failed.");
         return HDF_FAILURE;
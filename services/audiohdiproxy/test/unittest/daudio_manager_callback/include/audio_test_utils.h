@@ -49,9 +49,15 @@ public:
 
     int32_t WriteStreamData(const int32_t streamId, std::shared_ptr<AudioData> &data) override
     {
+        writtenData_ = data;
         return DH_SUCCESS;
     }
 
+    std::shared_ptr<AudioData> AcquireStreamBuffer(const int32_t streamId, const size_t size) override
+    {
+        return lentBuffer_;
+    }
+
     int32_t ReadStreamData(const int32_t streamId, std::shared_ptr<AudioData> &data) override
     {
         data = std::make_shared<AudioData>(DEFAULT_AUDIO_DATA_SIZE);
@@ -67,6 +73,9 @@ public:
     {
         return DH_SUCCESS;
     }
+
+    std::shared_ptr<AudioData> lentBuffer_ = nullptr;
+    std::shared_ptr<AudioData> writtenData_ = nullptr;
 };
 } // DistributedHardware
 } // OHOS
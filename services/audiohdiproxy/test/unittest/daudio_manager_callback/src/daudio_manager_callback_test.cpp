@@ -266,6 +266,35 @@ HWTEST_F(DAudioManagerCallbackTest, WriteStreamData_002, TestSize.Level1)
     EXPECT_EQ(HDF_SUCCESS, manCallback_->DestroyStream(streamId_));
 }
 
+/**
+ * @tc.name: WriteStreamData_003
+ * @tc.desc: Verify the payload is written into the buffer lent by the callback.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E6H
+ */
+HWTEST_F(DAudioManagerCallbackTest, WriteStreamData_003, TestSize.Level1)
+{
+    ASSERT_TRUE(manCallback_ != nullptr);
+    auto callback = std::make_shared<MockIDAudioHdiCallback>();
+    manCallback_->callback_ = callback;
+    EXPECT_EQ(HDF_SUCCESS, manCallback_->CreateStream(streamId_));
+    OHOS::HDI::DistributedAudio::Audioext::V3_0::AudioData data;
+    data.param.frameSize = 4096;
+    uint32_t dataSize = 3000;
+    data.data.assign(dataSize, 1);
+    callback->lentBuffer_ = std::make_shared<AudioData>(data.param.frameSize);
+    memset_s(callback->lentBuffer_->Data(), callback->lentBuffer_->Size(), 0xff, callback->lentBuffer_->Size());
+    EXPECT_EQ(HDF_SUCCESS, manCallback_->WriteStreamData(streamId_, data));
+    ASSERT_EQ(callback->lentBuffer_, callback->writtenData_);
+    EXPECT_EQ(1, callback->writtenData_->Data()[dataSize - 1]);
+    EXPECT_EQ(0, callback->writtenData_->Data()[dataSize]);
+
+    callback->lentBuffer_ = nullptr;
+    EXPECT_EQ(HDF_SUCCESS, manCallback_->WriteStreamData(streamId_, data));
+    EXPECT_NE(nullptr, callback->writtenData_);
+    EXPECT_EQ(HDF_SUCCESS, manCallback_->DestroyStream(streamId_));
+}
+
 /**
  * @tc.name: ReadStreamData_001
  * @tc.desc: Verify the ReadStreamData function.
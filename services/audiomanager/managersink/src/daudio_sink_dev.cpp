@@ -17,6 +17,7 @@
 
 #include <random>
 
+#include "audio_packetizer.h"
 #include "daudio_constants.h"
 #include "daudio_errorcode.h"
 #include "daudio_log.h"
@@ -648,6 +649,17 @@ int32_t DAudioSinkDev::GetCJsonObjectItems(const cJSON *j, AudioParam &audioPara
         CHECK_AND_RETURN_RET_LOG(ret != DH_SUCCESS, ret, "%{public}s", "Get param value error.");
     }
     DHLOGD("codecType: %{public}d", static_cast<int32_t>(audioParam.comParam.codecType));
+    // A source that does not send the key does not aggregate frames into packets.
+    if (CJsonParamCheck(j, { KEY_PACKET_FRAMES })) {
+        int32_t packetFrames = 0;
+        ret = GetParamValue(j, KEY_PACKET_FRAMES, packetFrames);
+        CHECK_AND_RETURN_RET_LOG(ret != DH_SUCCESS, ret, "%{public}s", "Get param value error.");
+        CHECK_AND_RETURN_RET_LOG(packetFrames < 1, ERR_DH_AUDIO_FAILED, "Invalid packetFrames: %{public}d",
+            packetFrames);
+        audioParam.comParam.packetFrames = static_cast<uint32_t>(packetFrames);
+        CHECK_AND_RETURN_RET_LOG(!AudioPacketizer::IsValidFramesPerPacket(audioParam), ERR_DH_AUDIO_FAILED,
+            "Invalid packetFrames: %{public}d", packetFrames);
+    }
     return ret;
 }
 
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DAUDIO_AEC_FALLBACK_H
+#define OHOS_DAUDIO_AEC_FALLBACK_H
+
+#include "aec_effector.h"
+
+#include "audio_param.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Creates the built-in AecEffector used when the vendor echo cancel library cannot be loaded. It
+ * runs DaudioAec with the reference format passed to Init() and the mic format given here, and
+ * passes the mic through unchanged when that pair is not supported. Release() frees the effector.
+ */
+AecEffector *CreateAecFallbackEffector(const AudioCommonParam &micParam);
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DAUDIO_AEC_FALLBACK_H
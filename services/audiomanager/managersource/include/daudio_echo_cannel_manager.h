@@ -17,6 +17,7 @@
 #define OHOS_DAUDIO_ECHO_CANNEL_MANAGER_H
 
 #include <queue>
+#include <vector>
 
 #include "dhfwk_single_instance.h"
 
@@ -26,7 +27,10 @@
 #include "iaudio_datatrans_callback.h"
 
 #include "audio_data.h"
+#include "audio_data_pool.h"
 #include "audio_param.h"
+#include "daudio_aec_fallback.h"
+#include "daudio_echo_delay.h"
 #include "daudio_util.h"
 
 namespace OHOS {
@@ -51,6 +55,7 @@ private:
     void CircuitStart();
     int32_t ProcessMicData(const std::shared_ptr<AudioData> &pipeInData,
         std::shared_ptr<AudioData> &micOutData);
+    int32_t ProcessAlignedRef(const std::shared_ptr<AudioData> &pipeInData);
     
     int32_t AudioCaptureSetUp();
     int32_t AudioCaptureStart();
@@ -58,6 +63,7 @@ private:
     int32_t AudioCaptureRelease();
 
     int32_t LoadAecProcessor();
+    int32_t LoadAecFallback();
     void UnLoadAecProcessor();
     int32_t InitAecProcessor();
     int32_t StartAecProcessor();
@@ -80,15 +86,26 @@ private:
     std::shared_ptr<IAudioDataTransCallback> devCallback_;
     void *aecHandler_ = nullptr;
     AecEffector *aecProcessor_ = nullptr;
+    bool isAecFallback_ = false;
+    AudioCommonParam micParam_;
     constexpr static size_t COND_WAIT_TIME_MS = 10;
     constexpr static size_t WAIT_MIC_DATA_TIME_US = 5000;
     constexpr static size_t REF_QUEUE_MAX_SIZE = 4;
     std::queue<std::shared_ptr<AudioData>> refDataQueue_;
+    std::shared_ptr<AudioDataPool> refDataPool_ = nullptr;
+    std::shared_ptr<AudioDataPool> micDataPool_ = nullptr;
     std::queue<std::shared_ptr<AudioData>> outDataQueue_;
     std::mutex refQueueMtx_;
     std::mutex outQueueMtx_;
     std::condition_variable refQueueCond_;
     std::atomic<bool> isStarted = false;
+    // The reference is fed to the aec next to each mic frame, shifted by the estimated echo path delay.
+    std::mutex delayMtx_;
+    DaudioEchoDelayEstimator delayEstimator_;
+    bool isRefAligned_ = false;
+    uint32_t micSampleRate_ = 0;
+    size_t micFrameBytes_ = 0;
+    std::vector<uint8_t> alignedRef_;
     FILE *dumpFileRef_ = nullptr;
     FILE *dumpFileRec_ = nullptr;
     FILE *dumpFileAft_ = nullptr;
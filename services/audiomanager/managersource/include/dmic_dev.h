@@ -16,23 +16,29 @@
 #ifndef OHOS_DMIC_DEV_H
 #define OHOS_DMIC_DEV_H
 
+#include <array>
 #include <deque>
 #include <set>
 #include <thread>
 #include "cJSON.h"
 
+#include "audio_data_chain.h"
+#include "audio_data_pool.h"
 #include "audio_param.h"
 #include "audio_status.h"
 #include "av_receiver_engine_transport.h"
 #include "ashmem.h"
+#include "daudio_asrc.h"
 #include "daudio_constants.h"
 #ifdef ECHO_CANNEL_ENABLE
 #include "daudio_echo_cannel_manager.h"
 #endif
 #include "daudio_hdi_handler.h"
+#include "daudio_jitter_estimator.h"
+#include "daudio_plc.h"
 #include "daudio_io_dev.h"
+#include "daudio_mmap_position.h"
 #include "daudio_source_ctrl_trans.h"
-#include "daudio_ringbuffer.h"
 #include "iaudio_data_transport.h"
 #include "iaudio_datatrans_callback.h"
 #include "iaudio_event_callback.h"
@@ -94,11 +100,11 @@ public:
         const AudioAsyncParam &param) override;
     int32_t AVsyncRefreshAshmem(int32_t fd, int32_t ashmemLength);
     void AVsyncDeintAshmem();
+    void StampAVsyncLock();
 
 private:
-    void EnqueueThread();
-    void FillJitterQueue();
-    void ReadFromRingbuffer();
+    void EnqueueTick();
+    bool FillJitterQueue();
     void SendToProcess(const std::shared_ptr<AudioData> &audioData);
     void GetCodecCaps(const std::string &capability);
     void AddToVec(std::vector<AudioCodecType> &container, const AudioCodecType value);
@@ -109,13 +115,29 @@ private:
     uint32_t GetQueSize();
     bool IsAVsync();
     int32_t AVsyncMacthScene(std::shared_ptr<AudioData> &data);
+    void PushPtsAnchor(const int64_t pts);
+    int64_t GetPtsAtOffset(const uint64_t offset);
+    void ResetReframer();
+    std::shared_ptr<AudioData> ResampleInput(const std::shared_ptr<AudioData> &audioData);
+    void InitResamplePool();
+    void OnMicDataConsumed();
+    std::shared_ptr<AudioData> ConcealLostFrame();
+    void OnFrameDequeued(const std::shared_ptr<AudioData> &data);
+    uint32_t GetPlcMaxConcealMs();
+    uint32_t GetQueueBudget();
+    bool IsDropNewestPolicy();
 
 private:
+    struct PtsAnchor {
+        uint64_t offset = 0;
+        int64_t pts = 0;
+    };
+
     static constexpr uint8_t CHANNEL_WAIT_SECONDS = 5;
-    static constexpr uint8_t RINGBUFFER_WAIT_SECONDS = 5;
     static constexpr uint8_t SCENE_WAIT_SECONDS = 5;
     static constexpr size_t DATA_QUEUE_MAX_SIZE = 10;
     static constexpr size_t DATA_QUEUE_HALF_SIZE = DATA_QUEUE_MAX_SIZE >> 1U;
+    static constexpr uint32_t DATA_QUEUE_MIN_SIZE = 2;
     static constexpr size_t DATA_QUEUE_BROADCAST_SIZE = 20;
     static constexpr size_t DATA_QUEUE_VIDEOCALL_SIZE = 20;
     static constexpr int64_t TIMESTAMP_COMPENSATION = 0;
@@ -123,9 +145,13 @@ private:
     static constexpr uint32_t LOW_LATENCY_JITTER_TIME_MS = 50;
     static constexpr uint8_t MMAP_NORMAL_PERIOD = 5;
     static constexpr uint8_t MMAP_VOIP_PERIOD = 20;
-    static constexpr uint32_t MMAP_WAIT_FRAME_US = 5000;
     static constexpr uint32_t DADUIO_TIME_DIFF_MAX = 5;
     constexpr static int64_t ONE_FRAME_COMPENSATION = 20000;
+    static constexpr uint32_t PTS_ANCHOR_NUM = 16;
+    static constexpr uint32_t QUEUE_LATENCY_BUDGET_MS = 200;
+    static constexpr uint32_t QUEUE_MIN_BUDGET_FRAMES = 4;
+    static constexpr uint32_t JITTER_HEADROOM_FRAMES = 2;
+    static constexpr int32_t QUEUE_POLICY_DROP_NEWEST = 1;
     static constexpr const char* ENQUEUE_THREAD = "micEnqueueTh";
     const std::string DUMP_DAUDIO_MIC_READ_FROM_BUF_NAME = "dump_source_mic_read_from_trans.pcm";
     const std::string DUMP_DAUDIO_LOWLATENCY_MIC_FROM_BUF_NAME = "dump_source_mic_write_to_ashmem.pcm";
@@ -144,25 +170,35 @@ private:
     std::shared_ptr<DAudioEchoCannelManager> echoManager_ = nullptr;
 #endif
     std::deque<std::shared_ptr<AudioData>> dataQueue_;
+    DaudioJitterEstimator jitterEstimator_;
+    DaudioPlc plc_;
+    // Deepest the jitter queue may grow, from the latency budget, and what to drop once it is full.
+    uint32_t queueBudget_ = DATA_QUEUE_MAX_SIZE;
+    bool isDropNewest_ = false;
+    uint64_t overrunCount_ = 0;
+    uint64_t underrunCount_ = 0;
+    size_t highWatermark_ = 0;
+    std::shared_ptr<AudioDataPool> dataPool_ = nullptr;
     AudioStatus curStatus_ = AudioStatus::STATUS_IDLE;
     // Mic capture parameters
     AudioParamHDF paramHDF_;
     AudioParam param_;
 
     std::atomic<bool> isExistedEmpty_ = false;
+    // Playout depth picked by the jitter estimator, and the depth above which frames are dropped.
     size_t dataQueSize_ = 0;
+    size_t dataQueMaxSize_ = DATA_QUEUE_MAX_SIZE;
     sptr<Ashmem> ashmem_ = nullptr;
     std::atomic<bool> isEnqueueRunning_ = false;
     int32_t ashmemLength_ = -1;
     int32_t lengthPerTrans_ = -1;
     int32_t writeIndex_ = -1;
     int64_t frameIndex_ = 0;
-    int64_t startTime_ = 0;
     uint64_t writeNum_ = 0;
-    int64_t writeTvSec_ = 0;
-    int64_t writeTvNSec_ = 0;
+    DaudioMmapPosition writePosition_;
     int64_t lastReadStartTime_ = 0;
-    std::thread enqueueDataThread_;
+    uint32_t enqueueStreamId_ = 0;
+    bool isJitterFilled_ = false;
     std::mutex writeAshmemMutex_;
     std::condition_variable dataQueueCond_;
     int32_t dhId_ = -1;
@@ -171,21 +207,23 @@ private:
     FILE *dumpFileFast_ = nullptr;
     uint32_t lowLatencyHalfSize_ = 0;
     uint32_t lowLatencyMaxfSize_ = 0;
-    std::unique_ptr<DaudioRingBuffer> ringBuffer_ = nullptr;
-    uint8_t *frameData_ = nullptr;
     int32_t frameSize_ = 0;
-    std::thread ringbufferThread_;
-    std::atomic<bool> isRingbufferOn_ = false;
-    std::mutex ringbufferMutex_;
+    AudioDataChain reframeChain_;
+    std::mutex reframeMutex_;
+    // Timestamp of the first byte of each received packet, oldest first, used to interpolate frame pts.
+    std::array<PtsAnchor, PTS_ANCHOR_NUM> ptsAnchors_ {};
+    uint32_t ptsAnchorHead_ = 0;
+    uint32_t ptsAnchorNum_ = 0;
+    uint64_t bytesIn_ = 0;
+    uint64_t bytesOut_ = 0;
+    int64_t bytesPerSecond_ = 0;
+    uint32_t bytesPerFrame_ = 0;
+    DaudioDriftEstimator drift_;
+    DaudioAsrc asrc_;
+    std::shared_ptr<AudioDataPool> resamplePool_ = nullptr;
     std::vector<AudioCodecType> codec_;
 
-    uint64_t frameInIndex_ = 0;
-    uint64_t frameOutIndex_ = 0;
     uint64_t framnum_ = 0;
-    uint64_t indexFlag_ = 15;
-    uint64_t frameOutIndexFlag_ = 16;
-    std::map<uint64_t, int64_t> ptsMap_;
-    std::mutex ptsMutex_;
     AudioAsyncParam avSyncParam_ {};
     std::mutex avSyncMutex_;
     uint32_t scene_ = DATA_QUEUE_HALF_SIZE;
@@ -193,8 +231,18 @@ private:
     sptr<Ashmem> avsyncAshmem_ = nullptr;
     constexpr static int64_t TIME_CONVERSION_NTOU = 1000;
     constexpr static int64_t TIME_CONVERSION_STOU = 1000000;
+    /*
+     * Layout shared with the video side, which creates it. lock is versioned by its top byte:
+     * - 0x00: the legacy 0-while-busy, 1-while-free flag (DaudioFlagLock).
+     * - AVSYNC_SEQLOCK_TAG: a DaudioSeqlock; readers retry on a sequence change and never write.
+     * When the audio side maps the memory it stamps a free legacy flag with AVSYNC_SEQLOCK_TAG, and
+     * either side may do so first. A peer must re-read the tag before every access and use the
+     * protocol it names. A video side that cannot read the tag needs avsync.legacy_lock set to 1,
+     * which leaves the word untagged.
+     */
+    constexpr static uint32_t AVSYNC_SEQLOCK_TAG = 0x5A000000;
     struct AVsyncShareData {
-        volatile int lock = 1;
+        uint32_t lock = 1;
         uint64_t audio_current_pts = 0;
         uint64_t audio_update_clock = 0;
         float audio_speed = 1.0f;
@@ -204,7 +252,7 @@ private:
         uint64_t sync_strategy = 1;
         bool reset = false;
     };
-    std::shared_ptr<AVsyncShareData> avsyncShareData_ = nullptr;
+    AVsyncShareData *avsyncShareData_ = nullptr;
 };
 } // DistributedHardware
 } // OHOS
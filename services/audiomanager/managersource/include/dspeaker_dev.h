@@ -21,12 +21,14 @@
 #include <thread>
 #include "cJSON.h"
 
+#include "audio_data_pool.h"
 #include "audio_param.h"
 #include "ashmem.h"
 #include "av_sender_engine_transport.h"
 #include "daudio_constants.h"
 #include "daudio_hdi_handler.h"
 #include "daudio_io_dev.h"
+#include "daudio_mmap_position.h"
 #include "daudio_source_ctrl_trans.h"
 #include "iaudio_event_callback.h"
 #include "iaudio_data_transport.h"
@@ -61,6 +63,7 @@ public:
     int32_t DestroyStream(const int32_t streamId) override;
     int32_t SetParameters(const int32_t streamId, const AudioParamHDF &param) override;
     int32_t WriteStreamData(const int32_t streamId, std::shared_ptr<AudioData> &data) override;
+    std::shared_ptr<AudioData> AcquireStreamBuffer(const int32_t streamId, const size_t size) override;
     int32_t ReadStreamData(const int32_t streamId, std::shared_ptr<AudioData> &data) override;
     int32_t NotifyEvent(const int32_t streamId, const AudioEvent &event) override;
     int32_t ReadMmapPosition(const int32_t streamId, uint64_t &frames, CurrentTimeHDF &time) override;
@@ -88,7 +91,8 @@ public:
         const AudioAsyncParam &param) override;
 
 private:
-    void EnqueueThread();
+    void EnqueueTick();
+    std::shared_ptr<AudioData> ReadFrameFromAshmem();
     void GetCodecCaps(const std::string &capability);
     void AddToVec(std::vector<AudioCodecType> &container, const AudioCodecType value);
     bool IsMimeSupported(const AudioCodecType coder);
@@ -118,11 +122,12 @@ private:
     int32_t lengthPerTrans_ = -1;
     int32_t readIndex_ = -1;
     int64_t frameIndex_ = 0;
-    int64_t startTime_ = 0;
     uint64_t readNum_ = 0;
-    int64_t readTvSec_ = 0;
-    int64_t readTvNSec_ = 0;
-    std::thread enqueueDataThread_;
+    DaudioMmapPosition readPosition_;
+    uint32_t enqueueStreamId_ = 0;
+    std::shared_ptr<AudioDataPool> enqueuePool_ = nullptr;
+    // Owns the mapping of ashmem_ together with the frames viewing it, and unmaps it after the last one.
+    std::shared_ptr<void> ashmemKeeper_ = nullptr;
     int64_t lastwriteStartTime_ = 0;
     int32_t dhId_ = -1;
     FILE *dumpFileCommn_ = nullptr;
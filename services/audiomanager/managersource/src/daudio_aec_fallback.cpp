@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "daudio_aec_fallback.h"
+
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <securec.h>
+
+#include "daudio_aec.h"
+#include "daudio_errorcode.h"
+#include "daudio_log.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "DAudioAecFallback"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+class AecFallbackProcessor {
+public:
+    explicit AecFallbackProcessor(const AudioCommonParam &micParam) : micParam_(micParam) {}
+    ~AecFallbackProcessor() = default;
+
+    int32_t Init(const AudioCommonParam &refParam);
+    int32_t StartUp();
+    int32_t ShutDown();
+    int32_t OnSendOriginData(const uint8_t *data, const size_t len, const bool isRef, uint8_t **out);
+
+private:
+    std::mutex aecMtx_;
+    AudioCommonParam micParam_;
+    DaudioAec aec_;
+    bool isRunning_ = false;
+};
+
+struct AecFallbackEffector {
+    AecEffector effector;
+    AecFallbackProcessor *processor;
+};
+static_assert(std::is_standard_layout<AecFallbackEffector>::value, "The effector must start the fallback.");
+
+int32_t AecFallbackProcessor::Init(const AudioCommonParam &refParam)
+{
+    std::lock_guard<std::mutex> lock(aecMtx_);
+    int32_t ret = aec_.Init(static_cast<uint32_t>(refParam.sampleRate), static_cast<uint32_t>(refParam.channelMask),
+        static_cast<uint32_t>(micParam_.sampleRate), static_cast<uint32_t>(micParam_.channelMask),
+        micParam_.bitFormat == refParam.bitFormat ? micParam_.bitFormat : INVALID_WIDTH);
+    if (ret != DH_SUCCESS) {
+        DHLOGW("Built-in aec does not support the formats, pass the mic through.");
+        return DH_SUCCESS;
+    }
+    DHLOGI("Built-in aec init success.");
+    return DH_SUCCESS;
+}
+
+int32_t AecFallbackProcessor::StartUp()
+{
+    std::lock_guard<std::mutex> lock(aecMtx_);
+    aec_.Reset();
+    isRunning_ = true;
+    return DH_SUCCESS;
+}
+
+int32_t AecFallbackProcessor::ShutDown()
+{
+    std::lock_guard<std::mutex> lock(aecMtx_);
+    isRunning_ = false;
+    return DH_SUCCESS;
+}
+
+int32_t AecFallbackProcessor::OnSendOriginData(const uint8_t *data, const size_t len, const bool isRef,
+    uint8_t **out)
+{
+    CHECK_AND_RETURN_RET_LOG(data == nullptr || out == nullptr, ERR_DH_AUDIO_NULLPTR, "data or out is nullptr.");
+    *out = nullptr;
+    std::lock_guard<std::mutex> lock(aecMtx_);
+    if (isRef) {
+        if (isRunning_) {
+            aec_.PushReference(data, len);
+        }
+        return DH_SUCCESS;
+    }
+    CHECK_AND_RETURN_RET_LOG(len == 0, ERR_DH_AUDIO_BAD_VALUE, "mic data is empty.");
+    // The caller releases the output with free().
+    uint8_t *buffer = static_cast<uint8_t *>(malloc(len));
+    CHECK_AND_RETURN_RET_LOG(buffer == nullptr, ERR_DH_AUDIO_NULLPTR, "malloc aec output failed.");
+    size_t processed = isRunning_ ? aec_.Process(data, len, buffer, len) : 0;
+    if (processed != len && memcpy_s(buffer, len, data, len) != EOK) {
+        free(buffer);
+        return ERR_DH_AUDIO_FAILED;
+    }
+    *out = buffer;
+    return DH_SUCCESS;
+}
+}
+
+AecEffector *CreateAecFallbackEffector(const AudioCommonParam &micParam)
+{
+    auto *fallback = new (std::nothrow) AecFallbackEffector {};
+    CHECK_NULL_RETURN(fallback, nullptr);
+    fallback->processor = new (std::nothrow) AecFallbackProcessor(micParam);
+    if (fallback->processor == nullptr) {
+        delete fallback;
+        return nullptr;
+    }
+    // The entry point signatures come from the extension headers; the generic lambdas take on their parameter types.
+    fallback->effector.Init = [](auto self, auto param) {
+        CHECK_NULL_RETURN(self, static_cast<int32_t>(ERR_DH_AUDIO_NULLPTR));
+        return reinterpret_cast<AecFallbackEffector *>(self)->processor->Init(param);
+    };
+    fallback->effector.StartUp = [](auto self) {
+        CHECK_NULL_RETURN(self, static_cast<int32_t>(ERR_DH_AUDIO_NULLPTR));
+        return reinterpret_cast<AecFallbackEffector *>(self)->processor->StartUp();
+    };
+    fallback->effector.ShutDown = [](auto self) {
+        CHECK_NULL_RETURN(self, static_cast<int32_t>(ERR_DH_AUDIO_NULLPTR));
+        return reinterpret_cast<AecFallbackEffector *>(self)->processor->ShutDown();
+    };
+    fallback->effector.Release = [](auto self) {
+        CHECK_NULL_RETURN(self, static_cast<int32_t>(ERR_DH_AUDIO_NULLPTR));
+        auto *effector = reinterpret_cast<AecFallbackEffector *>(self);
+        delete effector->processor;
+        delete effector;
+        return static_cast<int32_t>(DH_SUCCESS);
+    };
+    fallback->effector.OnSendOriginData = [](auto self, auto data, auto size, auto type, auto out) {
+        CHECK_NULL_RETURN(self, static_cast<int32_t>(ERR_DH_AUDIO_NULLPTR));
+        return reinterpret_cast<AecFallbackEffector *>(self)->processor->OnSendOriginData(
+            reinterpret_cast<const uint8_t *>(data), static_cast<size_t>(size), type == StreamType::REF,
+            reinterpret_cast<uint8_t **>(out));
+    };
+    DHLOGI("Create built-in aec effector.");
+    return &fallback->effector;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -19,6 +19,7 @@
 
 #include "daudio_constants.h"
 #include "daudio_errorcode.h"
+#include "daudio_hidumper.h"
 #include "daudio_log.h"
 #include "daudio_util.h"
 
@@ -35,6 +36,9 @@ using AecEffectProcessorProvider = AecEffector *(*)();
 const std::string ECHOCANNEL_SO_NAME = "libdaudio_aec_effect_processor.z.so";
 const std::string GET_AEC_EFFECT_PROCESSOR_FUNC = "GetAecEffector";
 const int32_t FRAME_SIZE_NORMAL = 3840;
+const uint32_t REF_SAMPLE_RATE = SAMPLE_RATE_48000;
+const uint32_t REF_CHANNELS = STEREO;
+const size_t REF_FRAME_BYTES = REF_CHANNELS * sizeof(int16_t);
 
 DAudioEchoCannelManager::DAudioEchoCannelManager()
 {
@@ -49,9 +53,18 @@ DAudioEchoCannelManager::~DAudioEchoCannelManager()
 int32_t DAudioEchoCannelManager::SetUp(const AudioCommonParam param,
     const std::shared_ptr<IAudioDataTransCallback> &callback)
 {
-    (void) param;
     devCallback_ = callback;
+    micParam_ = param;
+    micDataPool_ = std::make_shared<AudioDataPool>(param.frameSize, AudioDataPool::DEFAULT_POOL_SIZE);
     DHLOGI("SetUp EchoCannel.");
+    {
+        std::lock_guard<std::mutex> lock(delayMtx_);
+        micSampleRate_ = static_cast<uint32_t>(param.sampleRate);
+        micFrameBytes_ = static_cast<size_t>(param.channelMask) * GetBytesPerSample(param.bitFormat);
+        isRefAligned_ = delayEstimator_.Init(REF_SAMPLE_RATE, REF_CHANNELS, micSampleRate_,
+            static_cast<uint32_t>(param.channelMask), param.bitFormat) == DH_SUCCESS;
+        DHLOGI("Echo reference alignment enabled: %{public}d.", isRefAligned_);
+    }
 
     if (!isCircuitStartRunning_.load()) {
         isCircuitStartRunning_.store(true);
@@ -97,6 +110,11 @@ int32_t DAudioEchoCannelManager::Stop()
 {
     DHLOGI("Stop EchoCannel.");
     isStarted.store(false);
+    {
+        std::lock_guard<std::mutex> lock(delayMtx_);
+        delayEstimator_.Reset();
+    }
+    DaudioHidumper::GetInstance().SetAecDelay(false, 0);
     int32_t ret = StopAecProcessor();
     CHECK_AND_RETURN_RET_LOG(ret != DH_SUCCESS, ret, "Stop Aec Processor error. ret: %{public}d.", ret);
     ret = AudioCaptureStop();
@@ -129,7 +147,7 @@ int32_t DAudioEchoCannelManager::OnMicDataReceived(const std::shared_ptr<AudioDa
     CHECK_AND_RETURN_RET_LOG(devCallback_ == nullptr, ERR_DH_AUDIO_NULLPTR, "callback is nullptr.");
     if (isStarted.load()) {
         CHECK_AND_RETURN_RET_LOG(pipeInData == nullptr, ERR_DH_AUDIO_NULLPTR, "pipeInData is nullptr.");
-        auto micOutData = std::make_shared<AudioData>(pipeInData->Size());
+        auto micOutData = AcquireAudioData(micDataPool_, pipeInData->Size());
         int32_t ret = ProcessMicData(pipeInData, micOutData);
         if (ret != DH_SUCCESS) {
             DHLOGE("Mic data call processor error. ret : %{public}d.", ret);
@@ -153,7 +171,9 @@ int32_t DAudioEchoCannelManager::ProcessMicData(const std::shared_ptr<AudioData>
     CHECK_AND_RETURN_RET_LOG(pipeInData == nullptr, ERR_DH_AUDIO_NULLPTR, "pipeInData is nullptr.");
     CHECK_AND_RETURN_RET_LOG(micOutData == nullptr, ERR_DH_AUDIO_NULLPTR, "micOutData is nullptr.");
     CHECK_AND_RETURN_RET_LOG(aecProcessor_ == nullptr, ERR_DH_AUDIO_NULLPTR, "aec processor is nullptr.");
-    int32_t ret = aecProcessor_->OnSendOriginData(aecProcessor_, pipeInData->Data(),
+    int32_t ret = ProcessAlignedRef(pipeInData);
+    CHECK_AND_RETURN_RET_LOG(ret != DH_SUCCESS, ret, "Process aligned reference error. ret: %{public}d.", ret);
+    ret = aecProcessor_->OnSendOriginData(aecProcessor_, pipeInData->Data(),
         pipeInData->Size(), StreamType::MIC1, &micOutDataExt);
     if (ret != DH_SUCCESS || micOutDataExt == nullptr) {
         DHLOGI("aec effect process pipeInReferenceData fail. errocode:%{public}d", ret);
@@ -172,6 +192,40 @@ int32_t DAudioEchoCannelManager::ProcessMicData(const std::shared_ptr<AudioData>
     return ret;
 }
 
+int32_t DAudioEchoCannelManager::ProcessAlignedRef(const std::shared_ptr<AudioData> &pipeInData)
+{
+    CHECK_AND_RETURN_RET_LOG(pipeInData == nullptr, ERR_DH_AUDIO_NULLPTR, "pipeInData is nullptr.");
+    std::lock_guard<std::mutex> lock(delayMtx_);
+    if (!isRefAligned_ || micFrameBytes_ == 0 || micSampleRate_ == 0) {
+        return DH_SUCCESS;
+    }
+    delayEstimator_.PushCapture(pipeInData->Data(), pipeInData->Size());
+    size_t refLen = pipeInData->Size() / micFrameBytes_ * REF_SAMPLE_RATE / micSampleRate_ * REF_FRAME_BYTES;
+    if (refLen == 0) {
+        return DH_SUCCESS;
+    }
+    CHECK_AND_RETURN_RET_LOG(aecProcessor_ == nullptr, ERR_DH_AUDIO_NULLPTR, "aec processor is nullptr.");
+    alignedRef_.resize(refLen);
+    if (delayEstimator_.GetAlignedReference(alignedRef_.data(), refLen) != refLen) {
+        DHLOGE("Get aligned reference failed, len: %{public}zu.", refLen);
+        return ERR_DH_AUDIO_FAILED;
+    }
+    DaudioHidumper::GetInstance().SetAecDelay(delayEstimator_.IsValid(), delayEstimator_.GetDelayUs());
+    DumpFileUtil::WriteDumpFile(dumpFileRef_, static_cast<void *>(alignedRef_.data()), refLen);
+    uint8_t *refOutDataExt = nullptr;
+    int32_t ret = aecProcessor_->OnSendOriginData(aecProcessor_, alignedRef_.data(), refLen, StreamType::REF,
+        &refOutDataExt);
+    if (refOutDataExt != nullptr) {
+        free(refOutDataExt);
+        refOutDataExt = nullptr;
+    }
+    if (ret != DH_SUCCESS) {
+        DHLOGE("aec effect process aligned reference fail. errocode:%{public}d", ret);
+        return ERR_DH_AUDIO_FAILED;
+    }
+    return DH_SUCCESS;
+}
+
 void DAudioEchoCannelManager::AecProcessData()
 {
     DHLOGI("Start the aec process thread.");
@@ -194,11 +248,21 @@ void DAudioEchoCannelManager::AecProcessData()
             refDataQueue_.pop();
             DHLOGD("Pop new echo ref data, ref dataqueue size: %{public}zu.", refDataQueue_.size());
         }
-        DumpFileUtil::WriteDumpFile(dumpFileRef_, static_cast<void *>(refInData->Data()), refInData->Size());
-        int32_t ret = aecProcessor_->OnSendOriginData(aecProcessor_, refInData->Data(), refInData->Size(),
-            StreamType::REF, &refOutDataExt);
-        if (ret != DH_SUCCESS) {
-            DHLOGE("aec effect process pipeInReferenceData fail. errocode:%{public}d", ret);
+        bool isAligned = false;
+        {
+            std::lock_guard<std::mutex> lock(delayMtx_);
+            isAligned = isRefAligned_;
+            if (isAligned) {
+                delayEstimator_.PushReference(refInData->Data(), refInData->Size());
+            }
+        }
+        if (!isAligned) {
+            DumpFileUtil::WriteDumpFile(dumpFileRef_, static_cast<void *>(refInData->Data()), refInData->Size());
+            int32_t ret = aecProcessor_->OnSendOriginData(aecProcessor_, refInData->Data(), refInData->Size(),
+                StreamType::REF, &refOutDataExt);
+            if (ret != DH_SUCCESS) {
+                DHLOGE("aec effect process pipeInReferenceData fail. errocode:%{public}d", ret);
+            }
         }
         if (!isStarted.load()) {
             isStarted.store(true);
@@ -225,7 +289,10 @@ void DAudioEchoCannelManager::OnReadData(size_t length)
         return;
     }
     DHLOGD("Get echo ref data. size: %{public}zu.", bufDesc.bufLength);
-    std::shared_ptr<AudioData> audioData = std::make_shared<AudioData>(bufDesc.bufLength);
+    if (refDataPool_ == nullptr || refDataPool_->Capacity() != bufDesc.bufLength) {
+        refDataPool_ = std::make_shared<AudioDataPool>(bufDesc.bufLength, AudioDataPool::DEFAULT_POOL_SIZE);
+    }
+    std::shared_ptr<AudioData> audioData = refDataPool_->Acquire(bufDesc.bufLength);
     if (audioData->Capacity() != bufDesc.bufLength) {
         DHLOGE("Audio data length is not equal to buflength. datalength: %{public}zu, bufLength: %{public}zu",
             audioData->Capacity(), bufDesc.bufLength);
@@ -327,26 +394,41 @@ int32_t DAudioEchoCannelManager::LoadAecProcessor()
         return ERR_DH_AUDIO_NULLPTR;
     }
     aecHandler_ = dlopen(ECHOCANNEL_SO_NAME.c_str(), RTLD_LAZY | RTLD_NODELETE);
-    CHECK_AND_RETURN_RET_LOG(aecHandler_ == nullptr, ERR_DH_AUDIO_NULLPTR, "dlOpen error.");
+    if (aecHandler_ == nullptr) {
+        DHLOGW("dlOpen error, use the built-in aec.");
+        return LoadAecFallback();
+    }
     AecEffectProcessorProvider getAecEffectProcessorFunc = (AecEffectProcessorProvider)dlsym(aecHandler_,
         GET_AEC_EFFECT_PROCESSOR_FUNC.c_str());
     if (getAecEffectProcessorFunc == nullptr) {
         DHLOGE("AecEffectProcessor function handler is null, failed reason : %s", dlerror());
         dlclose(aecHandler_);
         aecHandler_ = nullptr;
-        return ERR_DH_AUDIO_NULLPTR;
+        return LoadAecFallback();
     }
     aecProcessor_ = getAecEffectProcessorFunc();
     DHLOGI("LoadAecEffectProcessor exit");
     return DH_SUCCESS;
 }
 
+int32_t DAudioEchoCannelManager::LoadAecFallback()
+{
+    aecProcessor_ = CreateAecFallbackEffector(micParam_);
+    CHECK_AND_RETURN_RET_LOG(aecProcessor_ == nullptr, ERR_DH_AUDIO_NULLPTR, "Create built-in aec failed.");
+    isAecFallback_ = true;
+    return DH_SUCCESS;
+}
+
 void DAudioEchoCannelManager::UnLoadAecProcessor()
 {
     if (aecHandler_ != nullptr) {
         dlclose(aecHandler_);
         aecHandler_ = nullptr;
     }
+    if (isAecFallback_ && aecProcessor_ != nullptr) {
+        aecProcessor_->Release(aecProcessor_);
+    }
+    isAecFallback_ = false;
     aecProcessor_ = nullptr;
 }
 
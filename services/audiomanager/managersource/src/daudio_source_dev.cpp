@@ -1594,6 +1594,7 @@ void DAudioSourceDev::to_json(cJSON *j, const AudioParam &param)
     cJSON_AddNumberToObject(j, KEY_CHANNELS, param.comParam.channelMask);
     cJSON_AddNumberToObject(j, KEY_FRAMESIZE, param.comParam.frameSize);
     cJSON_AddNumberToObject(j, KEY_CODEC_TYPE, param.comParam.codecType);
+    cJSON_AddNumberToObject(j, KEY_PACKET_FRAMES, param.comParam.packetFrames);
     cJSON_AddNumberToObject(j, KEY_CONTENT_TYPE, param.renderOpts.contentType);
     cJSON_AddNumberToObject(j, KEY_STREAM_USAGE, param.renderOpts.streamUsage);
     cJSON_AddNumberToObject(j, KEY_RENDER_FLAGS, param.renderOpts.renderFlags);
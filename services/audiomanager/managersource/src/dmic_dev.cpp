@@ -15,19 +15,23 @@
 
 #include "dmic_dev.h"
 
+#include <algorithm>
 #include <condition_variable>
 #include <ctime>
 #include <mutex>
 #include <string>
 #include <thread>
 
+#include "audio_packetizer.h"
 #include "daudio_constants.h"
 #include "daudio_errorcode.h"
 #include "daudio_hidumper.h"
 #include "daudio_hisysevent.h"
 #include "daudio_hitrace.h"
 #include "daudio_log.h"
+#include "daudio_period_scheduler.h"
 #include "daudio_radar.h"
+#include "daudio_seqlock.h"
 #include "daudio_source_manager.h"
 #include "daudio_util.h"
 
@@ -58,76 +62,114 @@ void DMicDev::OnEngineTransMessage(const std::shared_ptr<AVTransMessage> &messag
 
 void DMicDev::OnEngineTransDataAvailable(const std::shared_ptr<AudioData> &audioData)
 {
-    std::lock_guard<std::mutex> lock(ringbufferMutex_);
-    CHECK_NULL_VOID(ringBuffer_);
     CHECK_NULL_VOID(audioData);
-    CHECK_AND_RETURN_LOG(ringBuffer_->RingBufferInsert(audioData->Data(),
-        static_cast<int32_t>(audioData->Capacity())) != DH_SUCCESS, "RingBufferInsert failed.");
-    DHLOGD("Ringbuffer insert one");
-    int64_t timestamp = audioData->GetPts();
-    std::lock_guard<std::mutex> timeLock(ptsMutex_);
-    ptsMap_[frameInIndex_] = timestamp;
-    frameInIndex_++;
-    if (frameInIndex_ == indexFlag_) {
-        timestamp = audioData->GetPtsSpecial();
-        ptsMap_[frameInIndex_] = timestamp;
-        DHLOGD("audioData->GetPtsSpecial(): %{public}" PRId64", index: %{public}" PRIu64, timestamp, frameInIndex_);
-        frameInIndex_ = 0;
-    }
-}
-
-void DMicDev::ReadFromRingbuffer()
-{
-    std::shared_ptr<AudioData> sendData = std::make_shared<AudioData>(frameSize_);
-    bool canRead = false;
-    while (isRingbufferOn_.load()) {
-        CHECK_NULL_VOID(ringBuffer_);
-        canRead = false;
-        {
-            std::lock_guard<std::mutex> lock(ringbufferMutex_);
-            if (ringBuffer_->CanBufferReadLen(frameSize_)) {
-                canRead = true;
-            }
-        }
-        if (!canRead) {
-            DHLOGD("Can not read from ringbuffer.");
-            std::this_thread::sleep_for(std::chrono::milliseconds(RINGBUFFER_WAIT_SECONDS));
-            continue;
-        }
-        {
-            std::lock_guard<std::mutex> lock(ringbufferMutex_);
-            if (ringBuffer_->RingBufferGetData(sendData->Data(), sendData->Capacity()) != DH_SUCCESS) {
-                DHLOGE("Read ringbuffer failed.");
-                continue;
-            }
-        }
-        SendToProcess(sendData);
+    CHECK_AND_RETURN_LOG(frameSize_ <= 0, "Invalid frame size: %{public}d.", frameSize_);
+    // Cut the received packets into frameSize_ frames right here: a frame inside one packet is a
+    // zero-copy slice, a frame straddling two packets is gathered with a single copy.
+    std::lock_guard<std::mutex> lock(reframeMutex_);
+    if (audioData->Size() > 0) {
+        std::shared_ptr<AudioData> input = ResampleInput(audioData);
+        PushPtsAnchor(audioData->GetPts());
+        bytesIn_ += input->Size();
+        reframeChain_.Append(input);
+    }
+    size_t frameSize = static_cast<size_t>(frameSize_);
+    while (reframeChain_.Size() >= frameSize) {
+        std::shared_ptr<AudioData> frame = reframeChain_.Take(frameSize, dataPool_);
+        CHECK_NULL_VOID(frame);
+        frame->SetPts(GetPtsAtOffset(bytesOut_));
+        bytesOut_ += frameSize;
+        SendToProcess(frame);
+    }
+}
+
+std::shared_ptr<AudioData> DMicDev::ResampleInput(const std::shared_ptr<AudioData> &audioData)
+{
+    if (bytesPerFrame_ == 0) {
+        return audioData;
+    }
+    // Follow the local capture clock before the jitter queue, so drift never has to be dropped there.
+    drift_.OnProduced(audioData->Size() / bytesPerFrame_, GetCurNano());
+    asrc_.SetRatio(drift_.GetRatio());
+    if (!asrc_.IsEngaged()) {
+        return audioData;
+    }
+    // Resampled packets are sliced into frames that outlive this call, so they come from the pool sized
+    // at SetUp rather than from one scratch buffer. A buffer above the negotiated packet size is a miss.
+    size_t capacity = resamplePool_ != nullptr ? resamplePool_->Capacity() : 0;
+    std::shared_ptr<AudioData> output = AcquireAudioData(resamplePool_,
+        std::max(capacity, asrc_.GetMaxOutputBytes(audioData->Size())));
+    size_t len = asrc_.Process(audioData->Data(), audioData->Size(), output->Data(), output->Capacity());
+    output->SetRange(0, len);
+    return output;
+}
+
+void DMicDev::InitResamplePool()
+{
+    // Sized once for the largest packet the peer may send, so the transport thread never rebuilds it.
+    uint32_t packetFrames = AudioPacketizer::IsValidFramesPerPacket(param_) ? param_.comParam.packetFrames : 1;
+    size_t maxOutputBytes = asrc_.GetMaxOutputBytes(static_cast<size_t>(param_.comParam.frameSize) * packetFrames);
+    if (resamplePool_ == nullptr || resamplePool_->Capacity() != maxOutputBytes) {
+        resamplePool_ = std::make_shared<AudioDataPool>(maxOutputBytes, AudioDataPool::DEFAULT_POOL_SIZE);
+    }
+}
+
+void DMicDev::OnMicDataConsumed()
+{
+    // ResetReframer resets drift_ under the same lock.
+    std::lock_guard<std::mutex> lock(reframeMutex_);
+    if (bytesPerFrame_ != 0) {
+        drift_.OnConsumed(param_.comParam.frameSize / bytesPerFrame_, GetCurNano());
+    }
+}
+
+void DMicDev::PushPtsAnchor(const int64_t pts)
+{
+    if (ptsAnchorNum_ == PTS_ANCHOR_NUM) {
+        ptsAnchorHead_ = (ptsAnchorHead_ + 1) % PTS_ANCHOR_NUM;
+        ptsAnchorNum_--;
+    }
+    ptsAnchors_[(ptsAnchorHead_ + ptsAnchorNum_) % PTS_ANCHOR_NUM] = { bytesIn_, pts };
+    ptsAnchorNum_++;
+}
+
+int64_t DMicDev::GetPtsAtOffset(const uint64_t offset)
+{
+    // Anchors are recorded in stream order, so any anchor followed by another one at or before
+    // offset can no longer be the nearest one for this or any later frame.
+    while (ptsAnchorNum_ > 1 && ptsAnchors_[(ptsAnchorHead_ + 1) % PTS_ANCHOR_NUM].offset <= offset) {
+        ptsAnchorHead_ = (ptsAnchorHead_ + 1) % PTS_ANCHOR_NUM;
+        ptsAnchorNum_--;
+    }
+    if (ptsAnchorNum_ == 0) {
+        return 0;
     }
+    const PtsAnchor &anchor = ptsAnchors_[ptsAnchorHead_];
+    if (bytesPerSecond_ == 0) {
+        return anchor.pts;
+    }
+    int64_t deltaBytes = static_cast<int64_t>(offset) - static_cast<int64_t>(anchor.offset);
+    return anchor.pts + deltaBytes * AUDIO_US_PER_SECOND / bytesPerSecond_;
+}
+
+void DMicDev::ResetReframer()
+{
+    std::lock_guard<std::mutex> lock(reframeMutex_);
+    reframeChain_.Clear();
+    asrc_.Reset();
+    drift_.Reset(static_cast<uint32_t>(param_.comParam.sampleRate));
+    ptsAnchorHead_ = 0;
+    ptsAnchorNum_ = 0;
+    bytesIn_ = 0;
+    bytesOut_ = 0;
 }
 
 void DMicDev::SendToProcess(const std::shared_ptr<AudioData> &audioData)
 {
     DHLOGD("On Engine Data available");
     CHECK_NULL_VOID(audioData);
-    int64_t pts = 0;
-    {
-        std::lock_guard<std::mutex> lock(ptsMutex_);
-        auto iter = ptsMap_.find(frameOutIndex_);
-        if (iter != ptsMap_.end()) {
-            pts = iter->second;
-            audioData->SetPts(pts);
-            ptsMap_.erase(iter);
-        } else {
-            DHLOGI("iter == ptsMap_.end()");
-        }
-        frameOutIndex_++;
-        if (frameOutIndex_ == frameOutIndexFlag_) {
-            frameOutIndex_ = 0;
-        }
-    }
-    DHLOGD("Set timestamp %{public}" PRId64 " for frame index %{public}" PRIu64, audioData->GetPts(), frameOutIndex_);
     framnum_++;
-    DHLOGD("current frame index: %{public}" PRIu64, framnum_);
+    DHLOGD("current frame index: %{public}" PRIu64 ", pts: %{public}" PRId64, framnum_, audioData->GetPts());
     if (echoCannelOn_) {
 #ifdef ECHO_CANNEL_ENABLE
         CHECK_NULL_VOID(echoManager_);
@@ -340,6 +382,7 @@ int32_t DMicDev::SetParameters(const int32_t streamId, const AudioParamHDF &para
     } else if (IsMimeSupported(AudioCodecType::AUDIO_CODEC_AAC_EN)) {
         param_.comParam.codecType = AudioCodecType::AUDIO_CODEC_AAC_EN;
     }
+    param_.comParam.packetFrames = AudioPacketizer::NegotiateFramesPerPacket(param_);
     DHLOGI("codecType : %{public}d.", static_cast<int>(param_.comParam.codecType));
     return DH_SUCCESS;
 }
@@ -377,19 +420,33 @@ int32_t DMicDev::SetUp()
         return ret;
     }
     frameSize_ = static_cast<int32_t>(param_.comParam.frameSize);
+    if (dataPool_ == nullptr || dataPool_->Capacity() != param_.comParam.frameSize) {
+        dataPool_ = std::make_shared<AudioDataPool>(param_.comParam.frameSize, AudioDataPool::DEFAULT_POOL_SIZE);
+    }
+    bytesPerSecond_ = static_cast<int64_t>(param_.comParam.sampleRate) *
+        static_cast<int64_t>(param_.comParam.channelMask) * GetBytesPerSample(param_.comParam.bitFormat);
+    bytesPerFrame_ = static_cast<uint32_t>(param_.comParam.channelMask) * GetBytesPerSample(param_.comParam.bitFormat);
+    if (asrc_.Init(static_cast<uint32_t>(param_.comParam.channelMask), param_.comParam.bitFormat) != DH_SUCCESS) {
+        DHLOGI("Asrc is not supported for this stream, capture without drift correction.");
+    } else {
+        InitResamplePool();
+    }
+    ResetReframer();
     {
-        std::lock_guard<std::mutex> lock(ringbufferMutex_);
-        ringBuffer_ = std::make_unique<DaudioRingBuffer>();
-        ringBuffer_->RingBufferInit(frameData_);
-        CHECK_NULL_RETURN(frameData_, ERR_DH_AUDIO_NULLPTR);
-    }
-    isRingbufferOn_.store(true);
-    ringbufferThread_ = std::thread([ptr = shared_from_this()]() {
-        if (!ptr) {
-            return;
-        }
-        ptr->ReadFromRingbuffer();
-    });
+        std::lock_guard<std::mutex> lock(dataQueueMtx_);
+        int64_t frameDurationUs = bytesPerSecond_ > 0 ?
+            static_cast<int64_t>(param_.comParam.frameSize) * AUDIO_US_PER_SECOND / bytesPerSecond_ : 0;
+        jitterEstimator_.Reset(frameDurationUs, DATA_QUEUE_MIN_SIZE, DATA_QUEUE_EXT_SIZE);
+        dataQueSize_ = jitterEstimator_.GetTargetDepth();
+        dataQueMaxSize_ = DATA_QUEUE_MAX_SIZE;
+        queueBudget_ = GetQueueBudget();
+        isDropNewest_ = IsDropNewestPolicy();
+        overrunCount_ = 0;
+        underrunCount_ = 0;
+        highWatermark_ = 0;
+        plc_.Init(static_cast<uint32_t>(param_.comParam.sampleRate), static_cast<uint32_t>(param_.comParam.channelMask),
+            static_cast<int32_t>(param_.comParam.bitFormat), GetPlcMaxConcealMs());
+    }
     echoCannelOn_ = false;
     DHLOGI("echoCannelOn_: %{public}d", echoCannelOn_);
 #ifdef ECHO_CANNEL_ENABLE
@@ -491,17 +548,15 @@ int32_t DMicDev::Release()
         DHLOGE("Release mic trans failed, ret: %{public}d.", ret);
         return ret;
     }
-    isRingbufferOn_.store(false);
-    if (ringbufferThread_.joinable()) {
-        ringbufferThread_.join();
-    }
+    DHLOGI("Mic drift: %{public}.2f ppm, asrc ratio: %{public}.6f.", drift_.GetDriftPpm(), asrc_.GetRatio());
+    ResetReframer();
     {
-        std::lock_guard<std::mutex> lock(ringbufferMutex_);
-        ringBuffer_ = nullptr;
-        if (frameData_ != nullptr) {
-            delete[] frameData_;
-            frameData_ = nullptr;
-        }
+        std::lock_guard<std::mutex> lock(dataQueueMtx_);
+        DHLOGI("Mic plc stats, loss runs: %{public}" PRIu64 ", concealed frames: %{public}" PRIu64
+            ", muted frames: %{public}" PRIu64, plc_.GetLossEvents(), plc_.GetConcealedFrames(),
+            plc_.GetMutedFrames());
+        DHLOGI("Mic queue stats, overrun: %{public}" PRIu64 ", underrun: %{public}" PRIu64
+            ", high watermark: %{public}zu.", overrunCount_, underrunCount_, highWatermark_);
     }
 #ifdef ECHO_CANNEL_ENABLE
     if (echoManager_ != nullptr) {
@@ -528,56 +583,42 @@ int32_t DMicDev::WriteStreamData(const int32_t streamId, std::shared_ptr<AudioDa
 
 int32_t DMicDev::ReadTimeStampFromAVsync(int64_t &timePts)
 {
-    CHECK_AND_RETURN_RET_LOG(!IsAVsync() || avsyncAshmem_ == nullptr, DH_SUCCESS,
+    CHECK_AND_RETURN_RET_LOG(!IsAVsync() || avsyncShareData_ == nullptr, DH_SUCCESS,
         "Ashmem is nullptr or IsAVsync is false.");
-    auto syncData = avsyncAshmem_->ReadFromAshmem(avSyncParam_.sharedMemLen, 0);
-    CHECK_AND_RETURN_RET_LOG(syncData == nullptr, ERR_DH_AUDIO_FAILED, "syncData is null.");
-    AVsyncShareData *readSyncShareData = reinterpret_cast<AVsyncShareData *>(const_cast<void *>(syncData));
-    while (!readSyncShareData->lock && IsAVsync()) {
-        DHLOGE("AVsync lock is false");
-        syncData = avsyncAshmem_->ReadFromAshmem(avSyncParam_.sharedMemLen, 0);
-        CHECK_AND_RETURN_RET_LOG(syncData == nullptr, ERR_DH_AUDIO_FAILED, "syncData is null.");
-        readSyncShareData = reinterpret_cast<AVsyncShareData *>(const_cast<void *>(syncData));
-    }
-    readSyncShareData->lock = 0;
-    bool ret = avsyncAshmem_->WriteToAshmem(static_cast<void*>(readSyncShareData), sizeof(AVsyncShareData), 0);
-    CHECK_AND_RETURN_RET_LOG(!ret, ERR_DH_AUDIO_FAILED, "Write avsync data failed.");
-    timePts = static_cast<int64_t>(readSyncShareData->video_current_pts);
-    readSyncShareData->lock = 1;
-    ret = avsyncAshmem_->WriteToAshmem(static_cast<void*>(readSyncShareData), sizeof(AVsyncShareData), 0);
-    CHECK_AND_RETURN_RET_LOG(!ret, ERR_DH_AUDIO_FAILED, "Write avsync data failed.");
-    DHLOGD("readSyncShareData->audio_current_pts: %{public}" PRId64", readSyncShareData->audio_update_clock: "
-        "%{public}" PRId64, readSyncShareData->audio_current_pts, readSyncShareData->audio_update_clock);
+    AVsyncShareData *shareData = avsyncShareData_;
+    uint64_t videoPts = 0;
+    auto readVideoPts = [shareData, &videoPts]() {
+        videoPts = SeqlockLoad(shareData->video_current_pts);
+    };
+    DaudioSeqlock seqlock(&shareData->lock);
+    int32_t ret = seqlock.GetTag() == AVSYNC_SEQLOCK_TAG ? seqlock.Read(readVideoPts) :
+        DaudioFlagLock(&shareData->lock).Access(readVideoPts);
+    CHECK_AND_RETURN_RET_LOG(ret != DH_SUCCESS, ret, "Read avsync data failed.");
+    timePts = static_cast<int64_t>(videoPts);
+    DHLOGD("Read video_current_pts: %{public}" PRId64, timePts);
     return DH_SUCCESS;
 }
 
 int32_t DMicDev::WriteTimeStampToAVsync(const int64_t timePts)
 {
-    CHECK_AND_RETURN_RET_LOG(!IsAVsync() || avsyncAshmem_ == nullptr, DH_SUCCESS,
+    CHECK_AND_RETURN_RET_LOG(!IsAVsync() || avsyncShareData_ == nullptr, DH_SUCCESS,
         "Ashmem is nullptr or IsAVsync is false.");
-    auto syncData = avsyncAshmem_->ReadFromAshmem(avSyncParam_.sharedMemLen, 0);
-    CHECK_AND_RETURN_RET_LOG(syncData == nullptr, ERR_DH_AUDIO_FAILED, "syncData is null.");
-    AVsyncShareData *readSyncShareData = reinterpret_cast<AVsyncShareData *>(const_cast<void *>(syncData));
-    while (!readSyncShareData->lock && IsAVsync()) {
-        DHLOGE("AVsync lock is false");
-        syncData = avsyncAshmem_->ReadFromAshmem(avSyncParam_.sharedMemLen, 0);
-        CHECK_AND_RETURN_RET_LOG(syncData == nullptr, ERR_DH_AUDIO_FAILED, "syncData is null.");
-        readSyncShareData = reinterpret_cast<AVsyncShareData *>(const_cast<void *>(syncData));
-    }
-    readSyncShareData->lock = 0;
-    bool ret = avsyncAshmem_->WriteToAshmem(static_cast<void*>(readSyncShareData), sizeof(AVsyncShareData), 0);
-    CHECK_AND_RETURN_RET_LOG(!ret, ERR_DH_AUDIO_FAILED, "Write avsync data failed.");
     struct timespec time = {0, 0};
     clock_gettime(CLOCK_REALTIME, &time);
-    int64_t updatePts = static_cast<int64_t>(time.tv_sec) * TIME_CONVERSION_STOU +
-        static_cast<int64_t>(time.tv_nsec) / TIME_CONVERSION_NTOU;
-    readSyncShareData->lock = 1;
-    readSyncShareData->audio_current_pts = static_cast<uint64_t>(timePts);
-    readSyncShareData->audio_update_clock = static_cast<uint64_t>(updatePts);
-    ret = avsyncAshmem_->WriteToAshmem(static_cast<void*>(readSyncShareData), sizeof(AVsyncShareData), 0);
-    CHECK_AND_RETURN_RET_LOG(!ret, ERR_DH_AUDIO_FAILED, "Write avsync data failed.");
-    DHLOGD("readSyncShareData->audio_current_pts: %{public}" PRId64", readSyncShareData->audio_update_clock: "
-        "%{public}" PRId64, readSyncShareData->audio_current_pts, readSyncShareData->audio_update_clock);
+    uint64_t updatePts = static_cast<uint64_t>(static_cast<int64_t>(time.tv_sec) * TIME_CONVERSION_STOU +
+        static_cast<int64_t>(time.tv_nsec) / TIME_CONVERSION_NTOU);
+    uint64_t audioPts = static_cast<uint64_t>(timePts);
+    AVsyncShareData *shareData = avsyncShareData_;
+    auto writeAudioPts = [shareData, audioPts, updatePts]() {
+        SeqlockStore(shareData->audio_current_pts, audioPts);
+        SeqlockStore(shareData->audio_update_clock, updatePts);
+    };
+    DaudioSeqlock seqlock(&shareData->lock);
+    int32_t ret = seqlock.GetTag() == AVSYNC_SEQLOCK_TAG ? seqlock.Write(writeAudioPts) :
+        DaudioFlagLock(&shareData->lock).Access(writeAudioPts);
+    CHECK_AND_RETURN_RET_LOG(ret != DH_SUCCESS, ret, "Write avsync data failed.");
+    DHLOGD("Write audio_current_pts: %{public}" PRIu64 ", audio_update_clock: %{public}" PRIu64,
+        audioPts, updatePts);
     return DH_SUCCESS;
 }
 
@@ -610,11 +651,12 @@ int32_t DMicDev::AVsyncMacthScene(std::shared_ptr<AudioData> &data)
         DHLOGI("diff: %{public}" PRId64", videoPts: %{public}" PRId64
             ", audioPts: %{public}" PRId64, diff, videoPts, audioPts);
         if (diff > DADUIO_TIME_DIFF_MAX || GetQueSize() == 0) {
-            data = std::make_shared<AudioData>(param_.comParam.frameSize);
+            data = AcquireAudioData(dataPool_, param_.comParam.frameSize, true);
         } else {
             isStartStatus_.store(false);
             data = dataQueue_.front();
             dataQueue_.pop_front();
+            OnFrameDequeued(data);
         }
         return DH_SUCCESS;
     }
@@ -622,31 +664,79 @@ int32_t DMicDev::AVsyncMacthScene(std::shared_ptr<AudioData> &data)
     if (GetQueSize() == 0) {
         isExistedEmpty_.store(true);
         DHLOGD("Data queue is empty");
-        data = std::make_shared<AudioData>(param_.comParam.frameSize);
+        data = ConcealLostFrame();
     } else {
         data = dataQueue_.front();
         dataQueue_.pop_front();
+        OnFrameDequeued(data);
     }
     return DH_SUCCESS;
 }
 
+std::shared_ptr<AudioData> DMicDev::ConcealLostFrame()
+{
+    underrunCount_++;
+    std::shared_ptr<AudioData> data = AcquireAudioData(dataPool_, param_.comParam.frameSize);
+    bool concealed = plc_.Conceal(data->Data(), data->Size());
+    data->SetFlags(concealed ? AUDIO_DATA_FLAG_CONCEALED : AUDIO_DATA_FLAG_SILENCE);
+    return data;
+}
+
+void DMicDev::OnFrameDequeued(const std::shared_ptr<AudioData> &data)
+{
+    CHECK_NULL_VOID(data);
+    plc_.OnGoodFrame(data->Data(), data->Size());
+}
+
+uint32_t DMicDev::GetPlcMaxConcealMs()
+{
+    int32_t maxConcealMs = -1;
+    if (!GetSysPara(MIC_PLC_MAX_CONCEAL_PARA.c_str(), maxConcealMs) || maxConcealMs < 0) {
+        return DaudioPlc::PLC_DEFAULT_MAX_CONCEAL_MS;
+    }
+    return static_cast<uint32_t>(maxConcealMs);
+}
+
+uint32_t DMicDev::GetQueueBudget()
+{
+    int32_t latencyMs = 0;
+    if (!GetSysPara(MIC_LATENCY_BUDGET_PARA.c_str(), latencyMs) || latencyMs <= 0) {
+        latencyMs = static_cast<int32_t>(QUEUE_LATENCY_BUDGET_MS);
+    }
+    uint32_t budget = QUEUE_MIN_BUDGET_FRAMES;
+    if (bytesPerSecond_ > 0 && param_.comParam.frameSize > 0) {
+        uint64_t budgetBytes = static_cast<uint64_t>(bytesPerSecond_) * static_cast<uint64_t>(latencyMs) /
+            AUDIO_MS_PER_SECOND;
+        budget = std::max(budget, static_cast<uint32_t>(budgetBytes / param_.comParam.frameSize));
+    }
+    DHLOGI("Mic queue latency budget: %{public}d ms, %{public}u frames.", latencyMs, budget);
+    return budget;
+}
+
+bool DMicDev::IsDropNewestPolicy()
+{
+    int32_t policy = 0;
+    return GetSysPara(MIC_OVERFLOW_POLICY_PARA.c_str(), policy) && policy == QUEUE_POLICY_DROP_NEWEST;
+}
+
 int32_t DMicDev::GetAudioDataFromQueue(std::shared_ptr<AudioData> &data)
 {
     if (IsAVsync()) {
         int32_t ret = AVsyncMacthScene(data);
         if (ret != DH_SUCCESS) {
             DHLOGD("AVsyncMacthScene failed, insert empty frame");
-            data = std::make_shared<AudioData>(param_.comParam.frameSize);
+            data = AcquireAudioData(dataPool_, param_.comParam.frameSize, true);
         }
     } else {
         std::lock_guard<std::mutex> lock(dataQueueMtx_);
         if (GetQueSize() == 0) {
             isExistedEmpty_.store(true);
             DHLOGD("Data queue is empty");
-            data = std::make_shared<AudioData>(param_.comParam.frameSize);
+            data = ConcealLostFrame();
         } else {
             data = dataQueue_.front();
             dataQueue_.pop_front();
+            OnFrameDequeued(data);
         }
     }
     return DH_SUCCESS;
@@ -661,6 +751,7 @@ int32_t DMicDev::ReadStreamData(const int32_t streamId, std::shared_ptr<AudioDat
     }
     int32_t ret = GetAudioDataFromQueue(data);
     CHECK_AND_RETURN_RET_LOG(ret != DH_SUCCESS || data == nullptr, ERR_DH_AUDIO_NULLPTR, "GetAudioData failed");
+    OnMicDataConsumed();
     ret = WriteTimeStampToAVsync(data->GetPts());
     CHECK_AND_RETURN_RET_LOG(ret != DH_SUCCESS, ERR_DH_AUDIO_FAILED, "WriteTimeStampToAVsync failed");
     DHLOGD("Read stream data audioPts: %{public}" PRId64, data->GetPts());
@@ -676,11 +767,13 @@ int32_t DMicDev::ReadStreamData(const int32_t streamId, std::shared_ptr<AudioDat
 
 int32_t DMicDev::ReadMmapPosition(const int32_t streamId, uint64_t &frames, CurrentTimeHDF &time)
 {
+    int64_t timeNs = 0;
+    int32_t ret = writePosition_.Read(frames, timeNs);
+    CHECK_AND_RETURN_RET_LOG(ret != DH_SUCCESS, ret, "Read mmap position failed, ret: %{public}d.", ret);
+    time.tvSec = timeNs / AUDIO_NS_PER_SECOND;
+    time.tvNSec = timeNs % AUDIO_NS_PER_SECOND;
     DHLOGD("Read mmap position. frames: %{public}" PRIu64", tvsec: %{public}" PRId64", tvNSec:%{public}" PRId64,
-        writeNum_, writeTvSec_, writeTvNSec_);
-    frames = writeNum_;
-    time.tvSec = writeTvSec_;
-    time.tvNSec = writeTvNSec_;
+        frames, time.tvSec, time.tvNSec);
     return DH_SUCCESS;
 }
 
@@ -714,90 +807,102 @@ int32_t DMicDev::MmapStart()
 {
     CHECK_NULL_RETURN(ashmem_, ERR_DH_AUDIO_NULLPTR);
     std::lock_guard<std::mutex> lock(writeAshmemMutex_);
+    CHECK_AND_RETURN_RET_LOG(enqueueStreamId_ != 0, DH_SUCCESS, "Mic mmap already started.");
     frameIndex_ = 0;
-    startTime_ = 0;
+    writeIndex_ = 0;
+    writeNum_ = 0;
+    bool isInterpolated = false;
+    IsParamEnabled(MMAP_POSITION_INTERP_PARA, isInterpolated);
+    writePosition_.Reset(param_.comParam.sampleRate,
+        static_cast<uint32_t>(CalculateSampleNum(param_.comParam.sampleRate, paramHDF_.period)), isInterpolated);
+    isJitterFilled_ = false;
+    int64_t periodNs = static_cast<int64_t>(paramHDF_.period) * AUDIO_NS_PER_SECOND / AUDIO_MS_PER_SECOND;
+    DHLOGD("Enqueue start, lengthPerWrite length: %{public}d, interval: %{public}d.", lengthPerTrans_,
+        paramHDF_.period);
     isEnqueueRunning_.store(true);
-    enqueueDataThread_ = std::thread([ptr = shared_from_this()]() {
-        if (!ptr) {
-            return;
+    std::weak_ptr<DMicDev> weakMic = shared_from_this();
+    int32_t ret = DaudioPeriodScheduler::GetInstance().Register(ENQUEUE_THREAD, periodNs, 0, [weakMic]() {
+        auto ptr = weakMic.lock();
+        if (ptr != nullptr) {
+            ptr->EnqueueTick();
         }
-        ptr->EnqueueThread();
-    });
-    if (pthread_setname_np(enqueueDataThread_.native_handle(), ENQUEUE_THREAD) != DH_SUCCESS) {
-        DHLOGE("Enqueue data thread setname failed.");
+    }, enqueueStreamId_);
+    if (ret != DH_SUCCESS) {
+        DHLOGE("Register mic enqueue period failed, ret: %{public}d.", ret);
+        isEnqueueRunning_.store(false);
+        enqueueStreamId_ = 0;
+        return ret;
     }
     return DH_SUCCESS;
 }
 
-void DMicDev::EnqueueThread()
+void DMicDev::EnqueueTick()
 {
-    writeIndex_ = 0;
-    writeNum_ = 0;
-    int64_t timeIntervalns = static_cast<int64_t>(paramHDF_.period * AUDIO_NS_PER_SECOND / AUDIO_MS_PER_SECOND);
-    DHLOGD("Enqueue thread start, lengthPerWrite length: %{public}d, interval: %{public}d.", lengthPerTrans_,
-        paramHDF_.period);
-    FillJitterQueue();
-    while (ashmem_ != nullptr && isEnqueueRunning_.load()) {
-        int64_t timeOffset = UpdateTimeOffset(frameIndex_, timeIntervalns, startTime_);
-        DHLOGD("Write frameIndex: %{public}" PRId64", timeOffset: %{public}" PRId64, frameIndex_, timeOffset);
+    if (ashmem_ == nullptr || !isEnqueueRunning_.load()) {
+        return;
+    }
+    if (!isJitterFilled_) {
+        if (!FillJitterQueue()) {
+            return;
+        }
+        isJitterFilled_ = true;
+        DHLOGD("Mic jitter data queue fill end.");
+    }
+    DHLOGD("Write frameIndex: %{public}" PRId64, frameIndex_);
+    {
+        std::lock_guard<std::mutex> lock(dataQueueMtx_);
         std::shared_ptr<AudioData> audioData = nullptr;
-        {
-            std::lock_guard<std::mutex> lock(dataQueueMtx_);
-            if (dataQueue_.empty()) {
-                DHLOGD("Data queue is Empty.");
-                audioData = std::make_shared<AudioData>(param_.comParam.frameSize);
-            } else {
-                audioData = dataQueue_.front();
-                dataQueue_.pop_front();
-            }
-            if (audioData == nullptr) {
-                DHLOGD("The audioData is nullptr.");
-                continue;
-            }
-            DumpFileUtil::WriteDumpFile(dumpFileFast_, static_cast<void *>(audioData->Data()), audioData->Size());
-            bool writeRet = ashmem_->WriteToAshmem(audioData->Data(), audioData->Size(), writeIndex_);
-            if (writeRet) {
-                DHLOGD("Write to ashmem success! write index: %{public}d, writeLength: %{public}d.",
-                    writeIndex_, lengthPerTrans_);
-            } else {
-                DHLOGE("Write data to ashmem failed.");
-            }
+        if (dataQueue_.empty()) {
+            DHLOGD("Data queue is Empty.");
+            audioData = ConcealLostFrame();
+        } else {
+            audioData = dataQueue_.front();
+            dataQueue_.pop_front();
+            OnFrameDequeued(audioData);
         }
-        writeIndex_ += lengthPerTrans_;
-        if (writeIndex_ >= ashmemLength_) {
-            writeIndex_ = 0;
+        if (audioData == nullptr) {
+            DHLOGD("The audioData is nullptr.");
+            return;
+        }
+        DumpFileUtil::WriteDumpFile(dumpFileFast_, static_cast<void *>(audioData->Data()), audioData->Size());
+        bool writeRet = ashmem_->WriteToAshmem(audioData->Data(), audioData->Size(), writeIndex_);
+        if (writeRet) {
+            DHLOGD("Write to ashmem success! write index: %{public}d, writeLength: %{public}d.",
+                writeIndex_, lengthPerTrans_);
+        } else {
+            DHLOGE("Write data to ashmem failed.");
         }
-        writeNum_ += static_cast<uint64_t>(CalculateSampleNum(param_.comParam.sampleRate, paramHDF_.period));
-        GetCurrentTime(writeTvSec_, writeTvNSec_);
-        frameIndex_++;
-        AbsoluteSleep(startTime_ + frameIndex_ * timeIntervalns - timeOffset);
     }
+    // Outside dataQueueMtx_: the receive path takes reframeMutex_ before it.
+    OnMicDataConsumed();
+    writeIndex_ += lengthPerTrans_;
+    if (writeIndex_ >= ashmemLength_) {
+        writeIndex_ = 0;
+    }
+    writeNum_ += static_cast<uint64_t>(CalculateSampleNum(param_.comParam.sampleRate, paramHDF_.period));
+    writePosition_.Publish(writeNum_, GetCurNano());
+    frameIndex_++;
 }
 
-void DMicDev::FillJitterQueue()
+bool DMicDev::FillJitterQueue()
 {
-    while (isEnqueueRunning_.load()) {
-        {
-            std::lock_guard<std::mutex> lock(dataQueueMtx_);
-            if (paramHDF_.period == 0) {
-                DHLOGE("DMicDev paramHDF_.period is zero");
-                break;
-            }
-            if (dataQueue_.size() >= (LOW_LATENCY_JITTER_TIME_MS / paramHDF_.period)) {
-                break;
-            }
-        }
-        usleep(MMAP_WAIT_FRAME_US);
+    std::lock_guard<std::mutex> lock(dataQueueMtx_);
+    if (paramHDF_.period == 0) {
+        DHLOGE("DMicDev paramHDF_.period is zero");
+        return true;
     }
-    DHLOGD("Mic jitter data queue fill end.");
+    // Start playing out once the queue holds the jitter target, and never below the low-latency jitter time.
+    return dataQueue_.size() >= std::max(dataQueSize_, static_cast<size_t>(LOW_LATENCY_JITTER_TIME_MS /
+        paramHDF_.period));
 }
 
 int32_t DMicDev::MmapStop()
 {
     std::lock_guard<std::mutex> lock(writeAshmemMutex_);
     isEnqueueRunning_.store(false);
-    if (enqueueDataThread_.joinable()) {
-        enqueueDataThread_.join();
+    if (enqueueStreamId_ != 0) {
+        DaudioPeriodScheduler::GetInstance().Unregister(enqueueStreamId_);
+        enqueueStreamId_ = 0;
     }
     DHLOGI("Mic mmap stop end.");
     return DH_SUCCESS;
@@ -858,25 +963,55 @@ int32_t DMicDev::SendMessage(uint32_t type, std::string content, std::string dst
 int32_t DMicDev::OnDecodeTransDataDone(const std::shared_ptr<AudioData> &audioData)
 {
     CHECK_NULL_RETURN(audioData, ERR_DH_AUDIO_NULLPTR);
+    bool isAVsync = IsAVsync();
     std::lock_guard<std::mutex> lock(dataQueueMtx_);
-    dataQueSize_ = curStatus_ != AudioStatus::STATUS_START ?
-        (param_.captureOpts.capturerFlags == MMAP_MODE ? lowLatencyHalfSize_ : scene_) :
-        (param_.captureOpts.capturerFlags == MMAP_MODE ? lowLatencyMaxfSize_ : scene_ + scene_);
-    if (isExistedEmpty_.load()) {
-        dataQueSize_ = param_.captureOpts.capturerFlags == MMAP_MODE ? dataQueSize_ : DATA_QUEUE_EXT_SIZE;
+    uint32_t minDepth = lowLatencyHalfSize_;
+    uint32_t maxDepth = lowLatencyMaxfSize_;
+    if (param_.captureOpts.capturerFlags != MMAP_MODE) {
+        // AVsync needs scene_ frames queued before it can match the video clock.
+        minDepth = isAVsync ? scene_ : DATA_QUEUE_MIN_SIZE;
+        maxDepth = std::max(static_cast<uint32_t>(DATA_QUEUE_EXT_SIZE), scene_ + scene_);
+    }
+    if (!isAVsync) {
+        // AVsync sizes its queue from the scene; everything else stays within the latency budget.
+        maxDepth = std::max(minDepth, std::min(maxDepth, queueBudget_));
+    }
+    // The target is only re-estimated every few frames, so frames are dropped only above a separate maximum
+    // that keeps JITTER_HEADROOM_FRAMES of room above any target for bursts arriving in between.
+    maxDepth = std::max(maxDepth, minDepth + JITTER_HEADROOM_FRAMES);
+    jitterEstimator_.SetDepthRange(minDepth, maxDepth - JITTER_HEADROOM_FRAMES);
+    if (isExistedEmpty_.exchange(false)) {
+        jitterEstimator_.OnUnderrun();
     }
+    jitterEstimator_.OnFrameArrived(audioData->GetPts(), GetNowTimeUs());
+    dataQueSize_ = jitterEstimator_.GetTargetDepth();
+    dataQueMaxSize_ = maxDepth;
     uint64_t queueSize;
-    while (dataQueue_.size() > dataQueSize_) {
+    if (isDropNewest_ && dataQueue_.size() > dataQueMaxSize_) {
+        overrunCount_++;
+        DHLOGD("Data queue full, drop newest frame, audioPts: %{public}" PRId64, audioData->GetPts());
+        return DH_SUCCESS;
+    }
+    while (dataQueue_.size() > dataQueMaxSize_) {
         queueSize = static_cast<uint64_t>(dataQueue_.size());
         DHLOGI("Data queue overflow. buf current size: %{public}" PRIu64, queueSize);
         dataQueue_.pop_front();
+        overrunCount_++;
     }
-    std::shared_ptr<AudioData> writeAudioData = std::make_shared<AudioData>(param_.comParam.frameSize);
-    if (memcpy_s(writeAudioData->Data(), writeAudioData->Capacity(), audioData->Data(), audioData->Capacity()) != EOK) {
-        DHLOGE("Copy audio data failed");
+    // Frames cut by the reframer already have the negotiated size and are queued as they are; anything
+    // else is copied into a frame of that size.
+    if (audioData->Size() == param_.comParam.frameSize) {
+        dataQueue_.push_back(audioData);
+    } else {
+        std::shared_ptr<AudioData> writeAudioData = AcquireAudioData(dataPool_, param_.comParam.frameSize, true);
+        size_t copyLen = std::min(audioData->Size(), writeAudioData->Capacity());
+        if (memcpy_s(writeAudioData->Data(), writeAudioData->Capacity(), audioData->Data(), copyLen) != EOK) {
+            DHLOGE("Copy audio data failed");
+        }
+        writeAudioData->SetPts(audioData->GetPts());
+        dataQueue_.push_back(writeAudioData);
     }
-    writeAudioData->SetPts(audioData->GetPts());
-    dataQueue_.push_back(writeAudioData);
+    highWatermark_ = std::max(highWatermark_, dataQueue_.size());
     queueSize = static_cast<uint64_t>(dataQueue_.size());
     DHLOGD("Push new mic data, buf len: %{public}" PRIu64", audioPts: %{public}" PRId64,
         queueSize, audioData->GetPts());
@@ -893,12 +1028,35 @@ int32_t DMicDev::AVsyncRefreshAshmem(int32_t fd, int32_t ashmemLength)
         DHLOGD("Create ashmem success. fd:%{public}d, ashmem length: %{public}d", fd, ashmemLength_);
         bool mapRet = avsyncAshmem_->MapReadAndWriteAshmem();
         CHECK_AND_RETURN_RET_LOG(!mapRet, ERR_DH_AUDIO_NULLPTR, "Mmap ashmem failed.");
+        // ReadFromAshmem hands back the mapped address; the share data is accessed in place from here on.
+        const void *mapped = avsyncAshmem_->ReadFromAshmem(sizeof(AVsyncShareData), 0);
+        CHECK_AND_RETURN_RET_LOG(mapped == nullptr, ERR_DH_AUDIO_NULLPTR, "Get avsync share data failed.");
+        avsyncShareData_ = reinterpret_cast<AVsyncShareData *>(const_cast<void *>(mapped));
+        StampAVsyncLock();
     }
     return DH_SUCCESS;
 }
 
+void DMicDev::StampAVsyncLock()
+{
+    CHECK_NULL_VOID(avsyncShareData_);
+    bool isLegacyLock = false;
+    IsParamEnabled(AVSYNC_LEGACY_LOCK_PARA, isLegacyLock);
+    if (isLegacyLock) {
+        DHLOGI("AVsync keeps the legacy flag lock.");
+        return;
+    }
+    DaudioSeqlock seqlock(&avsyncShareData_->lock);
+    if (seqlock.Stamp(AVSYNC_SEQLOCK_TAG) != DH_SUCCESS) {
+        DHLOGE("Stamp avsync seqlock failed, keep the legacy flag lock.");
+        return;
+    }
+    DHLOGI("AVsync uses the seqlock.");
+}
+
 void DMicDev::AVsyncDeintAshmem()
 {
+    avsyncShareData_ = nullptr;
     if (avsyncAshmem_ != nullptr) {
         avsyncAshmem_->UnmapAshmem();
         avsyncAshmem_->CloseAshmem();
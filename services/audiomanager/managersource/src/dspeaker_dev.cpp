@@ -22,12 +22,15 @@
 #include <thread>
 #include <securec.h>
 
+#include "audio_data_pool.h"
+#include "audio_packetizer.h"
 #include "daudio_constants.h"
 #include "daudio_errorcode.h"
 #include "daudio_hidumper.h"
 #include "daudio_hisysevent.h"
 #include "daudio_hitrace.h"
 #include "daudio_log.h"
+#include "daudio_period_scheduler.h"
 #include "daudio_radar.h"
 #include "daudio_source_manager.h"
 #include "daudio_util.h"
@@ -248,6 +251,7 @@ int32_t DSpeakerDev::SetParameters(const int32_t streamId, const AudioParamHDF &
     } else if (IsMimeSupported(AudioCodecType::AUDIO_CODEC_AAC_EN)) {
         param_.comParam.codecType = AudioCodecType::AUDIO_CODEC_AAC_EN;
     }
+    param_.comParam.packetFrames = AudioPacketizer::NegotiateFramesPerPacket(param_);
     DHLOGI("codecType: %{public}d", static_cast<int>(param_.comParam.codecType));
     return DH_SUCCESS;
 }
@@ -317,9 +321,10 @@ int32_t DSpeakerDev::Release()
 {
     DHLOGI("Release speaker device.");
     if (ashmem_ != nullptr) {
-        ashmem_->UnmapAshmem();
-        ashmem_->CloseAshmem();
+        MmapStop();
+        // Frames still in flight may view the mapping; the keeper unmaps it once the last of them is gone.
         ashmem_ = nullptr;
+        ashmemKeeper_ = nullptr;
         DHLOGI("UnInit ashmem success.");
     }
     if (speakerCtrlTrans_ != nullptr) {
@@ -397,14 +402,23 @@ int32_t DSpeakerDev::WriteStreamData(const int32_t streamId, std::shared_ptr<Aud
     return DH_SUCCESS;
 }
 
+std::shared_ptr<AudioData> DSpeakerDev::AcquireStreamBuffer(const int32_t streamId, const size_t size)
+{
+    (void)streamId;
+    CHECK_NULL_RETURN(speakerTrans_, nullptr);
+    return speakerTrans_->AcquireSendBuffer(size);
+}
+
 int32_t DSpeakerDev::ReadMmapPosition(const int32_t streamId,
     uint64_t &frames, CurrentTimeHDF &time)
 {
+    int64_t timeNs = 0;
+    int32_t ret = readPosition_.Read(frames, timeNs);
+    CHECK_AND_RETURN_RET_LOG(ret != DH_SUCCESS, ret, "Read mmap position failed, ret: %{public}d.", ret);
+    time.tvSec = timeNs / AUDIO_NS_PER_SECOND;
+    time.tvNSec = timeNs % AUDIO_NS_PER_SECOND;
     DHLOGD("Read mmap position. frames: %{public}" PRIu64", tvsec: %{public}" PRId64", tvNSec:%{public}" PRId64,
-        readNum_, readTvSec_, readTvNSec_);
-    frames = readNum_;
-    time.tvSec = readTvSec_;
-    time.tvNSec = readTvNSec_;
+        frames, time.tvSec, time.tvNSec);
     return DH_SUCCESS;
 }
 
@@ -420,6 +434,10 @@ int32_t DSpeakerDev::RefreshAshmemInfo(const int32_t streamId,
         }
         if (ashmemLength < ASHMEM_MAX_LEN) {
             ashmem_ = sptr<Ashmem>(new Ashmem(fd, ashmemLength));
+            ashmemKeeper_ = std::shared_ptr<void>(ashmem_.GetRefPtr(), [ashmem = ashmem_](void *) {
+                ashmem->UnmapAshmem();
+                ashmem->CloseAshmem();
+            });
             ashmemLength_ = ashmemLength;
             lengthPerTrans_ = lengthPerTrans;
             DHLOGI("Create ashmem success. fd:%{public}d, ashmem length: %{public}d, lengthPreTrans: %{public}d",
@@ -437,58 +455,91 @@ int32_t DSpeakerDev::RefreshAshmemInfo(const int32_t streamId,
 int32_t DSpeakerDev::MmapStart()
 {
     CHECK_NULL_RETURN(ashmem_, ERR_DH_AUDIO_NULLPTR);
+    CHECK_AND_RETURN_RET_LOG(enqueueStreamId_ != 0, DH_SUCCESS, "Spk mmap already started.");
+    readIndex_ = 0;
+    readNum_ = 0;
+    bool isInterpolated = false;
+    IsParamEnabled(MMAP_POSITION_INTERP_PARA, isInterpolated);
+    readPosition_.Reset(param_.comParam.sampleRate,
+        static_cast<uint32_t>(CalculateSampleNum(param_.comParam.sampleRate, paramHDF_.period)), isInterpolated);
+    frameIndex_ = 0;
+    enqueuePool_ = std::make_shared<AudioDataPool>(lengthPerTrans_, AudioDataPool::DEFAULT_POOL_SIZE);
+    int64_t periodNs = static_cast<int64_t>(paramHDF_.period) * AUDIO_NS_PER_SECOND / AUDIO_MS_PER_SECOND;
+    DHLOGI("Enqueue start, lengthPerRead length: %{public}d, interval: %{public}d.", lengthPerTrans_,
+        paramHDF_.period);
     isEnqueueRunning_.store(true);
-    enqueueDataThread_ = std::thread([this]() { this->EnqueueThread(); });
-    if (pthread_setname_np(enqueueDataThread_.native_handle(), ENQUEUE_THREAD) != DH_SUCCESS) {
-        DHLOGE("Enqueue data thread setname failed.");
+    std::weak_ptr<DSpeakerDev> weakSpk = shared_from_this();
+    int32_t ret = DaudioPeriodScheduler::GetInstance().Register(ENQUEUE_THREAD, periodNs, 0, [weakSpk]() {
+        auto ptr = weakSpk.lock();
+        if (ptr != nullptr) {
+            ptr->EnqueueTick();
+        }
+    }, enqueueStreamId_);
+    if (ret != DH_SUCCESS) {
+        DHLOGE("Register spk enqueue period failed, ret: %{public}d.", ret);
+        isEnqueueRunning_.store(false);
+        enqueueStreamId_ = 0;
+        return ret;
     }
     return DH_SUCCESS;
 }
 
-void DSpeakerDev::EnqueueThread()
+void DSpeakerDev::EnqueueTick()
 {
-    readIndex_ = 0;
-    readNum_ = 0;
-    frameIndex_ = 0;
-    int64_t timeIntervalns = static_cast<int64_t>(paramHDF_.period * AUDIO_NS_PER_SECOND / AUDIO_MS_PER_SECOND);
-    DHLOGI("Enqueue thread start, lengthPerRead length: %{public}d, interval: %{pubic}d.", lengthPerTrans_,
-        paramHDF_.period);
-    while (ashmem_ != nullptr && isEnqueueRunning_.load()) {
-        int64_t timeOffset = UpdateTimeOffset(frameIndex_, timeIntervalns, startTime_);
-        DHLOGD("Read frameIndex: %{public}" PRId64", timeOffset: %{public}" PRId64, frameIndex_, timeOffset);
-        auto readData = ashmem_->ReadFromAshmem(lengthPerTrans_, readIndex_);
-        DHLOGD("Read from ashmem success! read index: %{public}d, readLength: %{public}d.",
-            readIndex_, lengthPerTrans_);
-        std::shared_ptr<AudioData> audioData = std::make_shared<AudioData>(lengthPerTrans_);
-        if (readData != nullptr) {
-            const uint8_t *readAudioData = reinterpret_cast<const uint8_t *>(readData);
-            if (memcpy_s(audioData->Data(), audioData->Capacity(), readAudioData, param_.comParam.frameSize) != EOK) {
-                DHLOGE("Copy audio data failed.");
-            }
-        }
-        CHECK_NULL_VOID(speakerTrans_);
-        DumpFileUtil::WriteDumpFile(dumpFileFast_, static_cast<void *>(audioData->Data()), audioData->Size());
-        int32_t ret = speakerTrans_->FeedAudioData(audioData);
-        if (ret != DH_SUCCESS) {
-            DHLOGE("Speaker enqueue thread, write stream data failed, ret: %{public}d.", ret);
+    if (ashmem_ == nullptr || !isEnqueueRunning_.load()) {
+        return;
+    }
+    DHLOGD("Read frameIndex: %{public}" PRId64, frameIndex_);
+    std::shared_ptr<AudioData> audioData = ReadFrameFromAshmem();
+    CHECK_NULL_VOID(audioData);
+    CHECK_NULL_VOID(speakerTrans_);
+    DumpFileUtil::WriteDumpFile(dumpFileFast_, static_cast<void *>(audioData->Data()), audioData->Size());
+    int32_t ret = speakerTrans_->FeedAudioData(audioData);
+    if (ret != DH_SUCCESS) {
+        DHLOGE("Speaker enqueue tick, write stream data failed, ret: %{public}d.", ret);
+    }
+    readIndex_ += lengthPerTrans_;
+    if (readIndex_ >= ashmemLength_) {
+        readIndex_ = 0;
+    }
+    readNum_ += static_cast<uint64_t>(CalculateSampleNum(param_.comParam.sampleRate, paramHDF_.period));
+    readPosition_.Publish(readNum_, GetCurNano());
+    frameIndex_++;
+}
+
+std::shared_ptr<AudioData> DSpeakerDev::ReadFrameFromAshmem()
+{
+    auto readData = ashmem_->ReadFromAshmem(lengthPerTrans_, readIndex_);
+    DHLOGD("Read from ashmem, read index: %{public}d, readLength: %{public}d.", readIndex_, lengthPerTrans_);
+    if (readData != nullptr && static_cast<int32_t>(param_.comParam.frameSize) == lengthPerTrans_) {
+        // The slot is handed over in place; the transport copies it before FeedAudioData returns, so the
+        // HDF rewriting the slot later cannot tear what is sent. The keeper owns the mapping, so the view
+        // stays readable even if it outlives Release.
+        auto view = AudioData::Wrap(const_cast<uint8_t *>(reinterpret_cast<const uint8_t *>(readData)),
+            static_cast<size_t>(lengthPerTrans_), ashmemKeeper_);
+        if (view != nullptr) {
+            return view;
         }
-        readIndex_ += lengthPerTrans_;
-        if (readIndex_ >= ashmemLength_) {
-            readIndex_ = 0;
+    }
+    bool zeroFill = readData == nullptr || static_cast<int32_t>(param_.comParam.frameSize) < lengthPerTrans_;
+    std::shared_ptr<AudioData> audioData = AcquireAudioData(enqueuePool_, lengthPerTrans_, zeroFill);
+    if (readData != nullptr) {
+        const uint8_t *readAudioData = reinterpret_cast<const uint8_t *>(readData);
+        if (memcpy_s(audioData->Data(), audioData->Capacity(), readAudioData, param_.comParam.frameSize) != EOK) {
+            DHLOGE("Copy audio data failed.");
         }
-        readNum_ += static_cast<uint64_t>(CalculateSampleNum(param_.comParam.sampleRate, paramHDF_.period));
-        GetCurrentTime(readTvSec_, readTvNSec_);
-        frameIndex_++;
-        AbsoluteSleep(startTime_ + frameIndex_ * timeIntervalns - timeOffset);
     }
+    return audioData;
 }
 
 int32_t DSpeakerDev::MmapStop()
 {
     isEnqueueRunning_.store(false);
-    if (enqueueDataThread_.joinable()) {
-        enqueueDataThread_.join();
+    if (enqueueStreamId_ != 0) {
+        DaudioPeriodScheduler::GetInstance().Unregister(enqueueStreamId_);
+        enqueueStreamId_ = 0;
     }
+    enqueuePool_ = nullptr;
     DHLOGI("Spk mmap stop end.");
     return DH_SUCCESS;
 }
@@ -1227,5 +1227,42 @@ HWTEST_F(DAudioSinkDevTest, NotifyEnhanceParamChange_002, TestSize.Level1)
     ASSERT_NE(sinkDev_->handler_, nullptr);
     sinkDev_->handler_->NotifyEnhanceParamChange(msgEvent);
 }
+
+/**
+ * @tc.name: GetCJsonObjectItems_001
+ * @tc.desc: Verify a packetFrames from the source outside the packet time limit is rejected.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioSinkDevTest, GetCJsonObjectItems_001, TestSize.Level1)
+{
+    ASSERT_NE(sinkDev_, nullptr);
+    cJSON *j = cJSON_CreateObject();
+    CHECK_NULL_VOID(j);
+    cJSON_AddNumberToObject(j, KEY_SAMPLING_RATE, SAMPLE_RATE_48000);
+    cJSON_AddNumberToObject(j, KEY_FORMAT, SAMPLE_S16LE);
+    cJSON_AddNumberToObject(j, KEY_CHANNELS, STEREO);
+    cJSON_AddNumberToObject(j, KEY_FRAMESIZE, 3840);
+    cJSON_AddNumberToObject(j, KEY_SOURCE_TYPE, 0);
+    cJSON_AddNumberToObject(j, KEY_CONTENT_TYPE, 0);
+    cJSON_AddNumberToObject(j, KEY_STREAM_USAGE, 0);
+    cJSON_AddNumberToObject(j, KEY_RENDER_FLAGS, 0);
+    cJSON_AddNumberToObject(j, KEY_CAPTURE_FLAGS, 0);
+    AudioParam audioParam;
+    EXPECT_EQ(DH_SUCCESS, sinkDev_->GetCJsonObjectItems(j, audioParam));
+    EXPECT_EQ(1, audioParam.comParam.packetFrames);
+
+    cJSON_AddNumberToObject(j, KEY_PACKET_FRAMES, 3);
+    EXPECT_EQ(DH_SUCCESS, sinkDev_->GetCJsonObjectItems(j, audioParam));
+    EXPECT_EQ(3, audioParam.comParam.packetFrames);
+
+    const double hostile[] = { 0, -1, 4, INT32_MAX };
+    for (double packetFrames : hostile) {
+        cJSON_ReplaceItemInObject(j, KEY_PACKET_FRAMES, cJSON_CreateNumber(packetFrames));
+        AudioParam hostileParam;
+        EXPECT_EQ(ERR_DH_AUDIO_FAILED, sinkDev_->GetCJsonObjectItems(j, hostileParam));
+    }
+    cJSON_Delete(j);
+}
 } // DistributedHardware
 } // OHOS
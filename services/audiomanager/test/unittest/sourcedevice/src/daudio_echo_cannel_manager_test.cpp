@@ -50,6 +50,30 @@ HWTEST_F(DAudioEchoCannelManagerTest, SetUp_001, TestSize.Level1)
     EXPECT_EQ(DH_SUCCESS, echoCannelManager_->SetUp(param, callback));
 }
 
+/**
+ * @tc.name: ProcessAlignedRef_001
+ * @tc.desc: Verify ProcessAlignedRef function.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioEchoCannelManagerTest, ProcessAlignedRef_001, TestSize.Level1)
+{
+    AudioCommonParam param;
+    std::shared_ptr<IAudioDataTransCallback> callback = nullptr;
+    EXPECT_EQ(DH_SUCCESS, echoCannelManager_->SetUp(param, callback));
+    EXPECT_FALSE(echoCannelManager_->isRefAligned_);
+    auto micData = std::make_shared<AudioData>(640);
+    EXPECT_EQ(ERR_DH_AUDIO_NULLPTR, echoCannelManager_->ProcessAlignedRef(nullptr));
+    EXPECT_EQ(DH_SUCCESS, echoCannelManager_->ProcessAlignedRef(micData));
+
+    param.sampleRate = SAMPLE_RATE_16000;
+    param.bitFormat = SAMPLE_S16LE;
+    EXPECT_EQ(DH_SUCCESS, echoCannelManager_->SetUp(param, callback));
+    EXPECT_TRUE(echoCannelManager_->isRefAligned_);
+    echoCannelManager_->aecProcessor_ = nullptr;
+    EXPECT_EQ(ERR_DH_AUDIO_NULLPTR, echoCannelManager_->ProcessAlignedRef(micData));
+}
+
 /**
  * @tc.name: OnMicDataReceived_001
  * @tc.desc: Verify OnMicDataReceived function.
@@ -122,5 +146,30 @@ HWTEST_F(DAudioEchoCannelManagerTest, LoadAecProcessor_002, TestSize.Level1)
     EXPECT_EQ(ERR_DH_AUDIO_NULLPTR, echoCannelManager_->StopAecProcessor());
     EXPECT_EQ(DH_SUCCESS, echoCannelManager_->ReleaseAecProcessor());
 }
+
+/**
+ * @tc.name: LoadAecFallback_001
+ * @tc.desc: Verify the built-in aec runs through the processor flow and passes unsupported mic formats through.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DAudioEchoCannelManagerTest, LoadAecFallback_001, TestSize.Level1)
+{
+    EXPECT_EQ(DH_SUCCESS, echoCannelManager_->LoadAecFallback());
+    EXPECT_TRUE(echoCannelManager_->isAecFallback_);
+    EXPECT_EQ(DH_SUCCESS, echoCannelManager_->InitAecProcessor());
+    EXPECT_EQ(DH_SUCCESS, echoCannelManager_->StartAecProcessor());
+
+    auto micInData = std::make_shared<AudioData>(640);
+    micInData->Data()[0] = 1;
+    auto micOutData = std::make_shared<AudioData>(640);
+    EXPECT_EQ(DH_SUCCESS, echoCannelManager_->ProcessMicData(micInData, micOutData));
+    EXPECT_EQ(1, micOutData->Data()[0]);
+
+    EXPECT_EQ(DH_SUCCESS, echoCannelManager_->StopAecProcessor());
+    echoCannelManager_->UnLoadAecProcessor();
+    EXPECT_FALSE(echoCannelManager_->isAecFallback_);
+    EXPECT_EQ(nullptr, echoCannelManager_->aecProcessor_);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -15,6 +15,8 @@
 
 #include "dmic_dev_test.h"
 
+#include <unistd.h>
+
 using namespace testing::ext;
 
 namespace OHOS {
@@ -93,16 +95,8 @@ HWTEST_F(DMicDevTest, SendToProcess_001, TestSize.Level1)
     auto writeData = std::make_shared<AudioData>(capacity);
     // Call SendToProcess with valid audio data
     mic_->SendToProcess(writeData);
-    // Set frame index value
-    mic_->frameIndex_ = 10;
-    // Store pts value in map
-    mic_->ptsMap_[mic_->frameIndex_] = 10;
     // Call SendToProcess again
     mic_->SendToProcess(writeData);
-    // Set frame output index flag
-    mic_->frameOutIndexFlag_ = 13;
-    // Call SendToProcess with flag set
-    mic_->SendToProcess(writeData);
     // Verify audio data is not null
     EXPECT_NE(nullptr, writeData);
 }
@@ -455,6 +449,63 @@ HWTEST_F(DMicDevTest, WriteTimeStampToAVsync_001, TestSize.Level1)
     EXPECT_EQ(DH_SUCCESS, mic_->WriteTimeStampToAVsync(timePts));
 }
 
+/**
+ * @tc.name: WriteTimeStampToAVsync_002
+ * @tc.desc: Verify timestamps go through the seqlock when the share data carries the seqlock tag.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DMicDevTest, WriteTimeStampToAVsync_002, TestSize.Level1)
+{
+    DMicDev::AVsyncShareData shareData;
+    shareData.lock = DMicDev::AVSYNC_SEQLOCK_TAG | 1;
+    shareData.video_current_pts = 2000;
+    mic_->avsyncShareData_ = &shareData;
+    mic_->avSyncParam_.isAVsync = 1;
+    int64_t timePts = 1000;
+    EXPECT_EQ(DH_SUCCESS, mic_->WriteTimeStampToAVsync(timePts));
+    EXPECT_EQ(1000, shareData.audio_current_pts);
+    EXPECT_NE(0, shareData.audio_update_clock);
+    EXPECT_EQ(DMicDev::AVSYNC_SEQLOCK_TAG | 3, shareData.lock);
+    EXPECT_EQ(DH_SUCCESS, mic_->ReadTimeStampFromAVsync(timePts));
+    EXPECT_EQ(2000, timePts);
+    EXPECT_EQ(DMicDev::AVSYNC_SEQLOCK_TAG | 3, shareData.lock);
+
+    // A peer that never releases the word makes both sides fail instead of spinning forever.
+    shareData.lock = DMicDev::AVSYNC_SEQLOCK_TAG | 4;
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_OPERATE, mic_->WriteTimeStampToAVsync(timePts));
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_OPERATE, mic_->ReadTimeStampFromAVsync(timePts));
+    mic_->avsyncShareData_ = nullptr;
+}
+
+/**
+ * @tc.name: WriteTimeStampToAVsync_003
+ * @tc.desc: Verify untagged share data is accessed with the legacy busy flag.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DMicDevTest, WriteTimeStampToAVsync_003, TestSize.Level1)
+{
+    DMicDev::AVsyncShareData shareData;
+    shareData.video_current_pts = 2000;
+    mic_->avsyncShareData_ = &shareData;
+    mic_->avSyncParam_.isAVsync = 1;
+    int64_t timePts = 1000;
+    EXPECT_EQ(DH_SUCCESS, mic_->WriteTimeStampToAVsync(timePts));
+    EXPECT_EQ(1000, shareData.audio_current_pts);
+    EXPECT_EQ(1, shareData.lock);
+    EXPECT_EQ(DH_SUCCESS, mic_->ReadTimeStampFromAVsync(timePts));
+    EXPECT_EQ(2000, timePts);
+    EXPECT_EQ(1, shareData.lock);
+
+    // A legacy peer holding the flag is waited for, not overridden.
+    shareData.lock = 0;
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_OPERATE, mic_->WriteTimeStampToAVsync(timePts));
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_OPERATE, mic_->ReadTimeStampFromAVsync(timePts));
+    EXPECT_EQ(0, shareData.lock);
+    mic_->avsyncShareData_ = nullptr;
+}
+
 /**
  * @tc.name: AVsyncMacthScene_001
  * @tc.desc: Verify AVsyncMacthScene function.
@@ -894,6 +945,47 @@ HWTEST_F(DMicDevTest, AVsyncRefreshAshmem001, TestSize.Level1)
     EXPECT_EQ(nullptr, mic_->avsyncAshmem_);
 }
 
+/**
+ * @tc.name: AVsyncRefreshAshmem002
+ * @tc.desc: Verify mapping the video side's share data stamps the seqlock tag and timestamps use it.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DMicDevTest, AVsyncRefreshAshmem002, TestSize.Level1)
+{
+    const int32_t ashmemLength = static_cast<int32_t>(sizeof(DMicDev::AVsyncShareData));
+    sptr<Ashmem> shared = Ashmem::CreateAshmem("avsync_ashmem_test", ashmemLength);
+    ASSERT_NE(nullptr, shared);
+    ASSERT_TRUE(shared->MapReadAndWriteAshmem());
+    DMicDev::AVsyncShareData created;
+    created.video_current_pts = 2000;
+    ASSERT_TRUE(shared->WriteToAshmem(&created, ashmemLength, 0));
+    const void *mapped = shared->ReadFromAshmem(ashmemLength, 0);
+    ASSERT_NE(nullptr, mapped);
+    auto videoView = reinterpret_cast<const DMicDev::AVsyncShareData *>(mapped);
+
+    std::string devId = "devId";
+    std::string dhId = "dhId";
+    AudioAsyncParam param{dup(shared->GetAshmemFd()), ashmemLength,
+        static_cast<uint32_t>(AudioAVScene::VIDEOCALL), true};
+    EXPECT_EQ(DH_SUCCESS, mic_->UpdateWorkModeParam(devId, dhId, param));
+    ASSERT_NE(nullptr, mic_->avsyncShareData_);
+    EXPECT_EQ(DMicDev::AVSYNC_SEQLOCK_TAG | 1, videoView->lock);
+
+    int64_t timePts = 1000;
+    EXPECT_EQ(DH_SUCCESS, mic_->WriteTimeStampToAVsync(timePts));
+    EXPECT_EQ(DMicDev::AVSYNC_SEQLOCK_TAG | 3, videoView->lock);
+    EXPECT_EQ(1000, videoView->audio_current_pts);
+    EXPECT_EQ(DH_SUCCESS, mic_->ReadTimeStampFromAVsync(timePts));
+    EXPECT_EQ(2000, timePts);
+
+    AudioAsyncParam closeParam{-1, 0, 0, false};
+    EXPECT_EQ(DH_SUCCESS, mic_->UpdateWorkModeParam(devId, dhId, closeParam));
+    EXPECT_EQ(nullptr, mic_->avsyncShareData_);
+    shared->UnmapAshmem();
+    shared->CloseAshmem();
+}
+
 /**
  * @tc.name: UpdateWorkModeParam001
  * @tc.desc: Verify UpdateWorkModeParam function.
@@ -1025,77 +1117,127 @@ HWTEST_F(DMicDevTest, IsAVsync_001, TestSize.Level1)
 
 /**
  * @tc.name: OnEngineTransDataAvailable_002
- * @tc.desc: Verify OnEngineTransDataAvailable with index flag.
+ * @tc.desc: Verify frame pts is interpolated from the byte position of the packet anchors.
  * @tc.type: FUNC
  * @tc.require: AR000H0E5F
  */
 HWTEST_F(DMicDevTest, OnEngineTransDataAvailable_002, TestSize.Level1)
 {
-    // Set audio data size
-    size_t size = 4096;
-    // Create audio data instance
-    auto audioData = std::make_shared<AudioData>(size);
-    // Set audio data PTS
-    audioData->SetPts(1000);
-    // Set audio data special PTS
-    audioData->SetPtsSpecial(2000);
-
-    // Set frame input index
-    mic_->frameInIndex_ = 14;
-    // Create ring buffer instance
-    mic_->ringBuffer_ = std::make_unique<DaudioRingBuffer>();
-    // Initialize ring buffer
-    mic_->ringBuffer_->RingBufferInit(mic_->frameData_);
-    // Handle engine transport data available
+    size_t packetSize = 4096;
+    size_t frameSize = 3840;
+    int64_t firstPts = 1000000;
+    int64_t secondPts = 1021333;
+    mic_->frameSize_ = static_cast<int32_t>(frameSize);
+    mic_->param_.comParam.frameSize = frameSize;
+    mic_->bytesPerSecond_ = 192000;
+    mic_->echoCannelOn_ = false;
+    mic_->dataQueue_.clear();
+    mic_->jitterEstimator_.Reset(0, mic_->DATA_QUEUE_MAX_SIZE, mic_->DATA_QUEUE_MAX_SIZE);
+    mic_->ResetReframer();
+
+    auto audioData = std::make_shared<AudioData>(packetSize);
+    audioData->SetPts(firstPts);
+    mic_->OnEngineTransDataAvailable(audioData);
+    audioData = std::make_shared<AudioData>(packetSize);
+    audioData->SetPts(secondPts);
     mic_->OnEngineTransDataAvailable(audioData);
-    // Verify frame input index is reset to 0
-    EXPECT_EQ(0, mic_->frameInIndex_);
+    ASSERT_EQ(2, mic_->dataQueue_.size());
+    EXPECT_EQ(firstPts, mic_->dataQueue_[0]->GetPts());
+    EXPECT_EQ(1020000, mic_->dataQueue_[1]->GetPts());
 
-    // Set frame input index
-    mic_->frameInIndex_ = 15;
-    // Handle engine transport data available
+    audioData = std::make_shared<AudioData>(packetSize);
+    audioData->SetPts(1042667);
     mic_->OnEngineTransDataAvailable(audioData);
-    // Verify frame input index is incremented
-    EXPECT_EQ(16, mic_->frameInIndex_);
+    ASSERT_EQ(3, mic_->dataQueue_.size());
+    EXPECT_EQ(secondPts + 18666, mic_->dataQueue_[2]->GetPts());
+    EXPECT_EQ(2, mic_->ptsAnchorNum_);
 }
 
 /**
- * @tc.name: SendToProcess_002
- * @tc.desc: Verify SendToProcess with ptsMap scenarios.
+ * @tc.name: GetPtsAtOffset_001
+ * @tc.desc: Verify the anchor ring keeps the newest anchors once it is full.
  * @tc.type: FUNC
  * @tc.require: AR000H0E5F
  */
-HWTEST_F(DMicDevTest, SendToProcess_002, TestSize.Level1)
+HWTEST_F(DMicDevTest, GetPtsAtOffset_001, TestSize.Level1)
 {
-    // Define data capacity
-    const size_t capacity = 1;
-    // Create audio data instance
-    auto audioData = std::make_shared<AudioData>(capacity);
+    mic_->ResetReframer();
+    mic_->bytesPerSecond_ = 0;
+    EXPECT_EQ(0, mic_->GetPtsAtOffset(0));
+    int64_t packetBytes = 100;
+    for (uint32_t i = 0; i < mic_->PTS_ANCHOR_NUM + 2; i++) {
+        mic_->PushPtsAnchor(static_cast<int64_t>(i));
+        mic_->bytesIn_ += static_cast<uint64_t>(packetBytes);
+    }
+    EXPECT_EQ(mic_->PTS_ANCHOR_NUM, mic_->ptsAnchorNum_);
+    EXPECT_EQ(2, mic_->GetPtsAtOffset(0));
+    EXPECT_EQ(5, mic_->GetPtsAtOffset(5 * packetBytes + 1));
 
-    // Clear PTS map
-    mic_->ptsMap_.clear();
-    // Reset frame output index
-    mic_->frameOutIndex_ = 0;
-    // Send data to process
-    mic_->SendToProcess(audioData);
+    mic_->bytesPerSecond_ = 1000;
+    EXPECT_EQ(5 + 1000, mic_->GetPtsAtOffset(5 * packetBytes + 1));
+}
 
-    // Add PTS entry to map
-    mic_->ptsMap_[0] = 100;
-    // Send data to process
-    mic_->SendToProcess(audioData);
-    // Verify PTS map size is 1
-    EXPECT_EQ(1, mic_->ptsMap_.size());
-
-    // Add another PTS entry to map
-    mic_->ptsMap_[15] = 200;
-    // Set frame output index
-    mic_->frameOutIndex_ = 15;
-    // Set frame output index flag
-    mic_->frameOutIndexFlag_ = 16;
-    // Send data to process
-    mic_->SendToProcess(audioData);
-    // Verify frame output index is reset to 0
-    EXPECT_EQ(0, mic_->frameOutIndex_);
+/**
+ * @tc.name: ResampleInput_001
+ * @tc.desc: Verify resampled packets come from a pool sized once for the largest packet of the stream.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DMicDevTest, ResampleInput_001, TestSize.Level1)
+{
+    const size_t packetSize = 3840;
+    mic_->param_.comParam.frameSize = packetSize;
+    mic_->param_.comParam.packetFrames = 1;
+    mic_->bytesPerFrame_ = 4;
+    ASSERT_EQ(DH_SUCCESS, mic_->asrc_.Init(STEREO, SAMPLE_S16LE));
+    mic_->InitResamplePool();
+    std::shared_ptr<AudioDataPool> pool = mic_->resamplePool_;
+    ASSERT_NE(nullptr, pool);
+    mic_->asrc_.SetRatio(1.0001);
+    ASSERT_TRUE(mic_->asrc_.IsEngaged());
+    EXPECT_EQ(mic_->asrc_.GetMaxOutputBytes(packetSize), pool->Capacity());
+    auto packet = std::make_shared<AudioData>(packetSize);
+    std::shared_ptr<AudioData> first = mic_->ResampleInput(packet);
+    std::shared_ptr<AudioData> second = mic_->ResampleInput(std::make_shared<AudioData>(packetSize / 2));
+    EXPECT_EQ(pool, mic_->resamplePool_);
+    EXPECT_EQ(0, pool->GetMissCount());
+    EXPECT_NE(packet, first);
+    EXPECT_NE(first->Data(), second->Data());
+    EXPECT_GT(first->Size(), 0);
+
+    mic_->OnMicDataConsumed();
+    mic_->ResetReframer();
+    EXPECT_FALSE(mic_->asrc_.IsEngaged());
+}
+
+/**
+ * @tc.name: OnEngineTransDataAvailable_003
+ * @tc.desc: Verify received packets are cut into frameSize_ frames without a reader thread.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DMicDevTest, OnEngineTransDataAvailable_003, TestSize.Level1)
+{
+    size_t packetSize = 4096;
+    size_t frameSize = 3072;
+    mic_->frameSize_ = static_cast<int32_t>(frameSize);
+    mic_->param_.comParam.frameSize = frameSize;
+    mic_->echoCannelOn_ = false;
+    mic_->dataQueue_.clear();
+    mic_->jitterEstimator_.Reset(0, mic_->DATA_QUEUE_MAX_SIZE, mic_->DATA_QUEUE_MAX_SIZE);
+    for (int32_t i = 0; i < 3; i++) {
+        mic_->OnEngineTransDataAvailable(std::make_shared<AudioData>(packetSize));
+    }
+    EXPECT_EQ(4, mic_->dataQueue_.size());
+    EXPECT_EQ(0, mic_->reframeChain_.Size());
+    EXPECT_TRUE(mic_->dataQueue_.front()->IsView());
+    for (const auto &frame : mic_->dataQueue_) {
+        EXPECT_EQ(frameSize, frame->Size());
+    }
+
+    mic_->OnEngineTransDataAvailable(std::make_shared<AudioData>(frameSize / 2));
+    EXPECT_EQ(4, mic_->dataQueue_.size());
+    EXPECT_EQ(frameSize / 2, mic_->reframeChain_.Size());
 }
 
 /**
@@ -1308,6 +1450,39 @@ HWTEST_F(DMicDevTest, GetAudioParam_001, TestSize.Level1)
     EXPECT_EQ(SAMPLE_S16LE, param.comParam.bitFormat);
 }
 
+/**
+ * @tc.name: GetAudioDataFromQueue_003
+ * @tc.desc: Verify an empty queue yields a concealed frame once there is audio history.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DMicDevTest, GetAudioDataFromQueue_003, TestSize.Level1)
+{
+    const size_t frameSize = 3840;
+    mic_->param_.comParam.frameSize = frameSize;
+    std::shared_ptr<AudioData> data = nullptr;
+    mic_->dataQueue_.clear();
+    mic_->underrunCount_ = 0;
+    EXPECT_EQ(DH_SUCCESS, mic_->GetAudioDataFromQueue(data));
+    ASSERT_NE(nullptr, data);
+    EXPECT_TRUE(data->HasFlag(AUDIO_DATA_FLAG_SILENCE));
+    EXPECT_EQ(1, mic_->underrunCount_);
+
+    ASSERT_EQ(DH_SUCCESS, mic_->plc_.Init(SAMPLE_RATE_48000, STEREO, SAMPLE_S16LE,
+        DaudioPlc::PLC_DEFAULT_MAX_CONCEAL_MS));
+    auto good = std::make_shared<AudioData>(frameSize);
+    int16_t *samples = reinterpret_cast<int16_t *>(good->Data());
+    for (size_t i = 0; i < frameSize / sizeof(int16_t); i++) {
+        samples[i] = static_cast<int16_t>(i % 100);
+    }
+    mic_->dataQueue_.push_back(good);
+    EXPECT_EQ(DH_SUCCESS, mic_->GetAudioDataFromQueue(data));
+    EXPECT_EQ(good, data);
+    EXPECT_EQ(DH_SUCCESS, mic_->GetAudioDataFromQueue(data));
+    EXPECT_TRUE(data->HasFlag(AUDIO_DATA_FLAG_CONCEALED));
+    EXPECT_EQ(1, mic_->plc_.GetConcealedFrames());
+}
+
 /**
  * @tc.name: OnDecodeTransDataDone_003
  * @tc.desc: Verify OnDecodeTransDataDone with queue overflow.
@@ -1326,6 +1501,98 @@ HWTEST_F(DMicDevTest, OnDecodeTransDataDone_003, TestSize.Level1)
     }
 
     EXPECT_GT(mic_->dataQueue_.size(), 0);
+    EXPECT_LE(mic_->dataQueue_.size(), mic_->dataQueMaxSize_ + 1);
+}
+
+/**
+ * @tc.name: OnDecodeTransDataDone_005
+ * @tc.desc: Verify frames are dropped above the maximum depth rather than above the jitter target.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DMicDevTest, OnDecodeTransDataDone_005, TestSize.Level1)
+{
+    const size_t capacity = 4096;
+    mic_->curStatus_ = AudioStatus::STATUS_START;
+    mic_->param_.comParam.frameSize = capacity;
+    mic_->dataQueue_.clear();
+    mic_->queueBudget_ = mic_->DATA_QUEUE_MAX_SIZE;
+    mic_->isDropNewest_ = false;
+    mic_->overrunCount_ = 0;
+    mic_->jitterEstimator_.Reset(0, mic_->DATA_QUEUE_MIN_SIZE, mic_->DATA_QUEUE_MIN_SIZE);
+    for (size_t i = 0; i < mic_->DATA_QUEUE_MAX_SIZE; i++) {
+        EXPECT_EQ(DH_SUCCESS, mic_->OnDecodeTransDataDone(std::make_shared<AudioData>(capacity)));
+    }
+    EXPECT_EQ(mic_->DATA_QUEUE_MIN_SIZE, mic_->dataQueSize_);
+    EXPECT_EQ(mic_->DATA_QUEUE_MAX_SIZE, mic_->dataQueMaxSize_);
+    EXPECT_EQ(mic_->DATA_QUEUE_MAX_SIZE, mic_->dataQueue_.size());
+    EXPECT_EQ(0, mic_->overrunCount_);
+
+    for (uint32_t i = 0; i < mic_->DATA_QUEUE_MAX_SIZE; i++) {
+        mic_->jitterEstimator_.OnUnderrun();
+    }
+    EXPECT_EQ(DH_SUCCESS, mic_->OnDecodeTransDataDone(std::make_shared<AudioData>(capacity)));
+    EXPECT_EQ(mic_->DATA_QUEUE_MAX_SIZE - mic_->JITTER_HEADROOM_FRAMES, mic_->dataQueSize_);
+    EXPECT_EQ(mic_->DATA_QUEUE_MAX_SIZE + 1, mic_->dataQueue_.size());
+    EXPECT_EQ(0, mic_->overrunCount_);
+}
+
+/**
+ * @tc.name: OnDecodeTransDataDone_004
+ * @tc.desc: Verify the overflow policy and the overrun and high-watermark counters of the data queue.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DMicDevTest, OnDecodeTransDataDone_004, TestSize.Level1)
+{
+    const size_t capacity = 4096;
+    const uint32_t budget = 4;
+    mic_->curStatus_ = AudioStatus::STATUS_START;
+    mic_->param_.comParam.frameSize = capacity;
+    mic_->dataQueue_.clear();
+    mic_->queueBudget_ = budget;
+    mic_->isDropNewest_ = true;
+    mic_->overrunCount_ = 0;
+    mic_->highWatermark_ = 0;
+    mic_->jitterEstimator_.Reset(0, budget, budget);
+    for (int64_t pts = 1; pts <= 8; pts++) {
+        auto data = std::make_shared<AudioData>(capacity);
+        data->SetPts(pts);
+        EXPECT_EQ(DH_SUCCESS, mic_->OnDecodeTransDataDone(data));
+    }
+    ASSERT_EQ(budget + 1, mic_->dataQueue_.size());
+    EXPECT_EQ(1, mic_->dataQueue_.front()->GetPts());
+    EXPECT_EQ(3, mic_->overrunCount_);
+    EXPECT_EQ(budget + 1, mic_->highWatermark_);
+
+    mic_->isDropNewest_ = false;
+    auto data = std::make_shared<AudioData>(capacity);
+    data->SetPts(100);
+    EXPECT_EQ(DH_SUCCESS, mic_->OnDecodeTransDataDone(data));
+    ASSERT_EQ(budget + 1, mic_->dataQueue_.size());
+    EXPECT_EQ(2, mic_->dataQueue_.front()->GetPts());
+    EXPECT_EQ(100, mic_->dataQueue_.back()->GetPts());
+    EXPECT_EQ(4, mic_->overrunCount_);
+}
+
+/**
+ * @tc.name: GetQueueBudget_001
+ * @tc.desc: Verify the data queue budget follows the latency budget and keeps a minimum depth.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5F
+ */
+HWTEST_F(DMicDevTest, GetQueueBudget_001, TestSize.Level1)
+{
+    mic_->bytesPerSecond_ = 192000;
+    mic_->param_.comParam.frameSize = 3840;
+    EXPECT_EQ(mic_->QUEUE_LATENCY_BUDGET_MS / 20, mic_->GetQueueBudget());
+
+    mic_->param_.comParam.frameSize = 192000;
+    EXPECT_EQ(mic_->QUEUE_MIN_BUDGET_FRAMES, mic_->GetQueueBudget());
+
+    mic_->bytesPerSecond_ = 0;
+    EXPECT_EQ(mic_->QUEUE_MIN_BUDGET_FRAMES, mic_->GetQueueBudget());
+    EXPECT_FALSE(mic_->IsDropNewestPolicy());
 }
 
 /**
@@ -15,6 +15,8 @@
 
 #include "dspeaker_dev_test.h"
 
+#include <unistd.h>
+
 using namespace testing::ext;
 
 namespace OHOS {
@@ -2090,5 +2092,40 @@ HWTEST_F(DSpeakerDevTest, SimpleParameterTests_017, TestSize.Level1)
         EXPECT_EQ(DH_SUCCESS, spk_->RefreshAshmemInfo(largeValue, largeValue, largeValue, largeValue));
     }
 }
+
+/**
+ * @tc.name: ReadFrameFromAshmem_001
+ * @tc.desc: Verify a frame viewing the ashmem slot keeps the mapping alive after Release.
+ * @tc.type: FUNC (Functional Test)
+ * @tc.require: AR000H0E5F (Dependency requirement ID)
+ * @tc.level: Level1 (Basic function verification)
+ */
+HWTEST_F(DSpeakerDevTest, ReadFrameFromAshmem_001, TestSize.Level1)
+{
+    const int32_t lengthPerTrans = 3840;
+    const int32_t ashmemLength = lengthPerTrans * 4;
+    sptr<Ashmem> shared = Ashmem::CreateAshmem("spk_ashmem_test", ashmemLength);
+    ASSERT_NE(nullptr, shared);
+    ASSERT_TRUE(shared->MapReadAndWriteAshmem());
+    std::vector<uint8_t> pattern(lengthPerTrans, 0x5A);
+    ASSERT_TRUE(shared->WriteToAshmem(pattern.data(), lengthPerTrans, 0));
+
+    spk_->param_.renderOpts.renderFlags = MMAP_MODE;
+    spk_->param_.comParam.frameSize = static_cast<uint32_t>(lengthPerTrans);
+    EXPECT_EQ(DH_SUCCESS, spk_->RefreshAshmemInfo(streamId_, dup(shared->GetAshmemFd()), ashmemLength,
+        lengthPerTrans));
+    spk_->readIndex_ = 0;
+    std::shared_ptr<AudioData> frame = spk_->ReadFrameFromAshmem();
+    ASSERT_NE(nullptr, frame);
+    EXPECT_TRUE(frame->IsView());
+
+    EXPECT_EQ(DH_SUCCESS, spk_->Release());
+    EXPECT_EQ(nullptr, spk_->ashmem_);
+    EXPECT_EQ(0x5A, frame->Data()[0]);
+    EXPECT_EQ(0x5A, frame->Data()[lengthPerTrans - 1]);
+    frame = nullptr;
+    shared->UnmapAshmem();
+    shared->CloseAshmem();
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -38,6 +38,16 @@ public:
     virtual int32_t CreateCtrl() = 0;
     virtual int32_t InitEngine(IAVEngineProvider *providerPtr) = 0;
     virtual int32_t SendMessage(uint32_t type, std::string content, std::string dstDevId) = 0;
+    /*
+     * Lends a frame backed by memory the transport sends from, so a producer can write its data in
+     * place and FeedAudioData hands it over without a copy. Returns nullptr when the transport has
+     * nothing better than the caller's own buffers; the frame must not be written after it is fed.
+     */
+    virtual std::shared_ptr<AudioData> AcquireSendBuffer(const size_t size)
+    {
+        (void)size;
+        return nullptr;
+    }
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -16,11 +16,13 @@
 #ifndef OHOS_AV_TRANS_RECEIVER_TRANS_H
 #define OHOS_AV_TRANS_RECEIVER_TRANS_H
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <string>
 
 #include "audio_data.h"
+#include "audio_packetizer.h"
 #include "audio_param.h"
 #include "av_receiver_engine_adapter.h"
 #include "iaudio_data_transport.h"
@@ -72,6 +74,8 @@ private:
     std::shared_ptr<AVTransReceiverAdapter> receiverAdapter_;
     std::weak_ptr<AVReceiverTransportCallback> transCallback_;
     std::string devId_;
+    AudioParam param_;
+    std::atomic<uint64_t> packetMismatchCount_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -49,7 +49,12 @@ int32_t AVTransReceiverTransport::SetUp(const AudioParam &localParam, const Audi
     (void)remoteParam;
     (void)callback;
     (void)capType;
-    return SetParameter(localParam);
+    param_ = localParam;
+    if (!AudioPacketizer::IsValidFramesPerPacket(param_)) {
+        DHLOGE("Invalid packetFrames: %{public}u, receive one frame per packet.", param_.comParam.packetFrames);
+        param_.comParam.packetFrames = 1;
+    }
+    return SetParameter(param_);
 }
 
 int32_t AVTransReceiverTransport::CreateCtrl()
@@ -68,7 +73,7 @@ int32_t AVTransReceiverTransport::Start()
 
 int32_t AVTransReceiverTransport::Stop()
 {
-    DHLOGI("Stop av receiver engine.");
+    DHLOGI("Stop av receiver engine, packet size mismatches: %{public}" PRIu64, packetMismatchCount_.load());
     CHECK_NULL_RETURN(receiverAdapter_, ERR_DH_AUDIO_NULLPTR);
     return receiverAdapter_->Stop();
 }
@@ -132,18 +137,28 @@ void AVTransReceiverTransport::OnEngineDataAvailable(const std::shared_ptr<AVTra
     CHECK_NULL_VOID(buffer);
     auto bufferData = buffer->GetBufferData(0);
     CHECK_NULL_VOID(bufferData);
-    std::shared_ptr<AudioData> audioData = std::make_shared<AudioData>(bufferData->GetSize());
-    int32_t ret = memcpy_s(audioData->Data(), audioData->Capacity(), bufferData->GetAddress(), bufferData->GetSize());
-    if (ret != EOK) {
-        DHLOGE("Copy audio data failed, error code %{public}d.", ret);
-        return;
-    }
+    size_t size = bufferData->GetSize();
+    // View the decoder output in place; the frame keeps the transport buffer alive until it is consumed.
+    std::shared_ptr<AudioData> audioData = AudioData::Wrap(bufferData->GetAddress(), size, buffer);
+    CHECK_NULL_VOID(audioData);
     DHLOGD("AudioDataPts: %{public}" PRId64, buffer->GetPts());
     audioData->SetPts(buffer->GetPts());
     audioData->SetPtsSpecial(buffer->GetPtsSpecial());
+    if (AudioPacketizer::IsMismatchedPacket(param_, size)) {
+        uint64_t mismatchCount = ++packetMismatchCount_;
+        DHLOGW("Packet size mismatch, size: %{public}zu, frame size: %{public}u, packet frames: %{public}u, "
+            "count: %{public}" PRIu64, size, param_.comParam.frameSize, param_.comParam.packetFrames, mismatchCount);
+    }
+    std::vector<std::shared_ptr<AudioData>> frames;
+    if (AudioPacketizer::Split(audioData, param_, frames) != DH_SUCCESS) {
+        DHLOGE("Split packet failed, size: %{public}zu.", size);
+        return;
+    }
     auto sourceDevObj = transCallback_.lock();
     CHECK_NULL_VOID(sourceDevObj);
-    sourceDevObj->OnEngineTransDataAvailable(audioData);
+    for (const auto &frame : frames) {
+        sourceDevObj->OnEngineTransDataAvailable(frame);
+    }
 }
 
 int32_t AVTransReceiverTransport::SetParameter(const AudioParam &audioParam)
@@ -155,7 +170,11 @@ int32_t AVTransReceiverTransport::SetParameter(const AudioParam &audioParam)
     receiverAdapter_->SetParameter(AVTransTag::AUDIO_CHANNEL_MASK, std::to_string(audioParam.comParam.channelMask));
     receiverAdapter_->SetParameter(AVTransTag::AUDIO_CHANNEL_LAYOUT, std::to_string(audioParam.comParam.channelMask));
     receiverAdapter_->SetParameter(AVTransTag::AUDIO_BIT_RATE, std::to_string(AUDIO_SET_HISTREAMER_BIT_RATE));
-    receiverAdapter_->SetParameter(AVTransTag::AUDIO_FRAME_SIZE, std::to_string(audioParam.comParam.frameSize));
+    // Matches the packet size the sender announces for the negotiated number of frames per packet.
+    uint32_t packetFrames = AudioPacketizer::IsValidFramesPerPacket(audioParam) ?
+        audioParam.comParam.packetFrames : 1;
+    size_t packetSize = static_cast<size_t>(audioParam.comParam.frameSize) * packetFrames;
+    receiverAdapter_->SetParameter(AVTransTag::AUDIO_FRAME_SIZE, std::to_string(packetSize));
     receiverAdapter_->SetParameter(AVTransTag::AUDIO_CODEC_TYPE, std::to_string(audioParam.comParam.codecType));
     receiverAdapter_->SetParameter(AVTransTag::ENGINE_READY, OWNER_NAME_D_SPEAKER);
     return DH_SUCCESS;
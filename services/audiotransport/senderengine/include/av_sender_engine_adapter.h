@@ -54,6 +54,7 @@ public:
     int32_t Stop();
     int32_t SetParameter(const AVTransTag &tag, const std::string &param);
     int32_t PushData(std::shared_ptr<AudioData> &audioData);
+    std::shared_ptr<AudioData> AcquireSendBuffer(const size_t size);
     int32_t SendMessageToRemote(const std::shared_ptr<AVTransMessage> &message);
     int32_t CreateControlChannel(const std::string &peerDevId);
     int32_t RegisterAdapterCallback(const std::shared_ptr<AVSenderAdapterCallback> &back);
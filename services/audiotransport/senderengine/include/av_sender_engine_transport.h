@@ -20,6 +20,7 @@
 #include <mutex>
 #include <string>
 
+#include "audio_packetizer.h"
 #include "av_sender_engine_adapter.h"
 #include "iaudio_data_transport.h"
 #include "iaudio_datatrans_callback.h"
@@ -56,6 +57,7 @@ public:
     int32_t Pause() override;
     int32_t Restart(const AudioParam &localParam, const AudioParam &remoteParam) override;
     int32_t FeedAudioData(std::shared_ptr<AudioData> &audioData) override;
+    std::shared_ptr<AudioData> AcquireSendBuffer(const size_t size) override;
 
     int32_t CreateCtrl() override;
     int32_t InitEngine(IAVEngineProvider *providerPtr) override;
@@ -66,8 +68,11 @@ public:
 
 private:
     int32_t SetParameter(const AudioParam &audioParam);
+    int32_t FlushPacket();
 
 private:
+    std::mutex packetMtx_;
+    AudioPacketizer packetizer_;
     std::shared_ptr<AVTransSenderAdapter> senderAdapter_;
     std::weak_ptr<AVSenderTransportCallback> transCallback_;
     std::string devId_;
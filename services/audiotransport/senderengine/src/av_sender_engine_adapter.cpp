@@ -30,6 +30,31 @@ namespace OHOS {
 namespace DistributedHardware {
 constexpr int32_t WAIT_TIMEOUT_MS = 5000;
 
+namespace {
+// Deleter of the buffers handed out by AcquireSendBuffer; PushData recognises them by its type.
+struct SendBufferDeleter {
+    void operator()(AVTransBuffer *buffer) const
+    {
+        delete buffer;
+    }
+};
+
+std::shared_ptr<AVTransBuffer> GetSendBuffer(const std::shared_ptr<AudioData> &audioData)
+{
+    const std::shared_ptr<void> &keeper = audioData->GetKeeper();
+    if (keeper == nullptr || std::get_deleter<SendBufferDeleter>(keeper) == nullptr) {
+        return nullptr;
+    }
+    auto transBuffer = std::static_pointer_cast<AVTransBuffer>(keeper);
+    auto bufferData = transBuffer->GetBufferData(0);
+    if (bufferData == nullptr || bufferData->GetAddress() != audioData->Data()) {
+        return nullptr;
+    }
+    bufferData->SetSize(audioData->Size());
+    return transBuffer;
+}
+}
+
 int32_t AVTransSenderAdapter::Initialize(IAVEngineProvider *providerPtr, const std::string &peerDevId)
 {
     DHLOGI("Init av sender engine.");
@@ -107,15 +132,32 @@ int32_t AVTransSenderAdapter::SetParameter(const AVTransTag &tag, const std::str
 int32_t AVTransSenderAdapter::PushData(std::shared_ptr<AudioData> &audioData)
 {
     CHECK_NULL_RETURN(senderEngine_, ERR_DH_AUDIO_NULLPTR);
-    auto transBuffer = std::make_shared<AVTransBuffer>(MetaType::AUDIO);
-    auto bufferData = transBuffer->CreateBufferData(audioData->Size());
-    CHECK_NULL_RETURN(bufferData, ERR_DH_AUDIO_NULLPTR);
+    CHECK_NULL_RETURN(audioData, ERR_DH_AUDIO_NULLPTR);
+    auto transBuffer = GetSendBuffer(audioData);
+    if (transBuffer == nullptr) {
+        transBuffer = std::make_shared<AVTransBuffer>(MetaType::AUDIO);
+        auto bufferData = transBuffer->CreateBufferData(audioData->Size());
+        CHECK_NULL_RETURN(bufferData, ERR_DH_AUDIO_NULLPTR);
+        bufferData->Write(audioData->Data(), audioData->Size());
+    }
     DHLOGD("AudioDataPts: %{public}" PRId64, audioData->GetPts());
-    bufferData->Write(audioData->Data(), audioData->Size());
     transBuffer->SetPts(audioData->GetPts());
     return senderEngine_->PushData(transBuffer);
 }
 
+std::shared_ptr<AudioData> AVTransSenderAdapter::AcquireSendBuffer(const size_t size)
+{
+    if (size == 0) {
+        return nullptr;
+    }
+    std::shared_ptr<AVTransBuffer> transBuffer(new (std::nothrow) AVTransBuffer(MetaType::AUDIO),
+        SendBufferDeleter());
+    CHECK_NULL_RETURN(transBuffer, nullptr);
+    auto bufferData = transBuffer->CreateBufferData(size);
+    CHECK_NULL_RETURN(bufferData, nullptr);
+    return AudioData::Wrap(bufferData->GetAddress(), size, transBuffer);
+}
+
 int32_t AVTransSenderAdapter::SendMessageToRemote(const std::shared_ptr<AVTransMessage> &message)
 {
     DHLOGI("Send message to remote.");
@@ -49,6 +49,15 @@ int32_t AVTransSenderTransport::SetUp(const AudioParam &localParam, const AudioP
     (void)remoteParam;
     (void)callback;
     (void)capType;
+    {
+        std::lock_guard<std::mutex> lock(packetMtx_);
+        packetizer_.SetPacketAllocator([this](size_t size) {
+            return senderAdapter_ == nullptr ? nullptr : senderAdapter_->AcquireSendBuffer(size);
+        });
+        if (packetizer_.Init(localParam) != DH_SUCCESS) {
+            DHLOGE("Init packetizer failed, send one frame per packet.");
+        }
+    }
     return SetParameter(localParam);
 }
 
@@ -70,6 +79,7 @@ int32_t AVTransSenderTransport::Stop()
 {
     DHLOGI("Stop av sender engine.");
     CHECK_NULL_RETURN(senderAdapter_, ERR_DH_AUDIO_NULLPTR);
+    FlushPacket();
     return senderAdapter_->Stop();
 }
 
@@ -77,6 +87,7 @@ int32_t AVTransSenderTransport::Pause()
 {
     DHLOGI("Pause av sender engine.");
     CHECK_NULL_RETURN(senderAdapter_, ERR_DH_AUDIO_NULLPTR);
+    FlushPacket();
     return senderAdapter_->SetParameter(AVTransTag::ENGINE_PAUSE, "");
 }
 
@@ -99,7 +110,53 @@ int32_t AVTransSenderTransport::Release()
 int32_t AVTransSenderTransport::FeedAudioData(std::shared_ptr<AudioData> &audioData)
 {
     CHECK_NULL_RETURN(senderAdapter_, ERR_DH_AUDIO_NULLPTR);
-    return senderAdapter_->PushData(audioData);
+    CHECK_NULL_RETURN(audioData, ERR_DH_AUDIO_NULLPTR);
+    std::vector<std::shared_ptr<AudioData>> packets;
+    {
+        std::lock_guard<std::mutex> lock(packetMtx_);
+        int32_t ret = packetizer_.Push(audioData, packets);
+        if (ret != DH_SUCCESS) {
+            return ret;
+        }
+    }
+    int32_t ret = DH_SUCCESS;
+    for (auto &packet : packets) {
+        ret = senderAdapter_->PushData(packet);
+        if (ret != DH_SUCCESS) {
+            DHLOGE("Push packet failed, ret: %{public}d.", ret);
+        }
+    }
+    return ret;
+}
+
+std::shared_ptr<AudioData> AVTransSenderTransport::AcquireSendBuffer(const size_t size)
+{
+    CHECK_NULL_RETURN(senderAdapter_, nullptr);
+    {
+        // Such frames are gathered into a packet that is itself built in a send buffer.
+        std::lock_guard<std::mutex> lock(packetMtx_);
+        if (packetizer_.IsAggregated(size)) {
+            return nullptr;
+        }
+    }
+    return senderAdapter_->AcquireSendBuffer(size);
+}
+
+int32_t AVTransSenderTransport::FlushPacket()
+{
+    std::vector<std::shared_ptr<AudioData>> packets;
+    {
+        std::lock_guard<std::mutex> lock(packetMtx_);
+        packetizer_.Flush(packets);
+    }
+    int32_t ret = DH_SUCCESS;
+    for (auto &packet : packets) {
+        ret = senderAdapter_->PushData(packet);
+        if (ret != DH_SUCCESS) {
+            DHLOGE("Push packet failed, ret: %{public}d.", ret);
+        }
+    }
+    return ret;
 }
 
 int32_t AVTransSenderTransport::SendMessage(uint32_t type, std::string content, std::string dstDevId)
@@ -134,7 +191,7 @@ int32_t AVTransSenderTransport::SetParameter(const AudioParam &audioParam)
     senderAdapter_->SetParameter(AVTransTag::AUDIO_CHANNEL_MASK, std::to_string(audioParam.comParam.channelMask));
     senderAdapter_->SetParameter(AVTransTag::AUDIO_CHANNEL_LAYOUT, std::to_string(audioParam.comParam.channelMask));
     senderAdapter_->SetParameter(AVTransTag::AUDIO_BIT_RATE, std::to_string(AUDIO_SET_HISTREAMER_BIT_RATE));
-    senderAdapter_->SetParameter(AVTransTag::AUDIO_FRAME_SIZE, std::to_string(audioParam.comParam.frameSize));
+    senderAdapter_->SetParameter(AVTransTag::AUDIO_FRAME_SIZE, std::to_string(packetizer_.GetPacketSize()));
     senderAdapter_->SetParameter(AVTransTag::AUDIO_CODEC_TYPE, std::to_string(audioParam.comParam.codecType));
     senderAdapter_->SetParameter(AVTransTag::ENGINE_READY, OWNER_NAME_D_SPEAKER);
     return DH_SUCCESS;
@@ -16,6 +16,8 @@
 #ifndef OHOS_ENGINE_TEST_UTILS_H
 #define OHOS_ENGINE_TEST_UTILS_H
 
+#include <vector>
+
 #include "i_av_receiver_engine.h"
 #include "i_av_sender_engine.h"
 #include "av_receiver_engine_adapter.h"
@@ -49,7 +51,12 @@ public:
     ~MockAVReceiverTransportCallback() {}
     void OnEngineTransEvent(const AVTransEvent &event) override {}
     void OnEngineTransMessage(const std::shared_ptr<AVTransMessage> &message) override {}
-    void OnEngineTransDataAvailable(const std::shared_ptr<AudioData> &audioData) override {}
+    void OnEngineTransDataAvailable(const std::shared_ptr<AudioData> &audioData) override
+    {
+        frames_.push_back(audioData);
+    }
+
+    std::vector<std::shared_ptr<AudioData>> frames_;
 };
 
 class MockAVSenderTransportCallback : public AVSenderTransportCallback {
@@ -154,6 +161,7 @@ public:
 
     int32_t PushData(const std::shared_ptr<AVTransBuffer> &buffer) override
     {
+        lastBuffer_ = buffer;
         return 0;
     }
 
@@ -197,6 +205,8 @@ public:
     {
         return false;
     }
+
+    std::shared_ptr<AVTransBuffer> lastBuffer_ = nullptr;
 };
 
 class MockIAVSenderEngineForFail : public IAVSenderEngine {
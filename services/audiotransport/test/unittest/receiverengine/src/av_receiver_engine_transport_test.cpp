@@ -57,6 +57,30 @@ HWTEST_F(AVReceiverEngineTransportTest, SetUp_001, TestSize.Level1)
     EXPECT_EQ(DH_SUCCESS, receiverTrans_->SetUp(localParam, remoteParam, callback, CAP_SPK));
 }
 
+/**
+ * @tc.name: SetUp_002
+ * @tc.desc: Verify a packetFrames beyond the packet time limit falls back to one frame per packet.
+ * @tc.type: FUNC
+ * @tc.require: AR000HTAPM
+ */
+HWTEST_F(AVReceiverEngineTransportTest, SetUp_002, TestSize.Level1)
+{
+    AudioParam param;
+    param.comParam.sampleRate = SAMPLE_RATE_48000;
+    param.comParam.channelMask = STEREO;
+    param.comParam.bitFormat = SAMPLE_S16LE;
+    param.comParam.frameSize = 3840;
+    param.comParam.packetFrames = UINT32_MAX;
+    std::shared_ptr<IAudioDataTransCallback> callback = nullptr;
+    ASSERT_NE(receiverTrans_, nullptr);
+    receiverTrans_->receiverAdapter_ = std::make_shared<AVTransReceiverAdapter>();
+    EXPECT_EQ(DH_SUCCESS, receiverTrans_->SetUp(param, param, callback, CAP_SPK));
+    EXPECT_EQ(1, receiverTrans_->param_.comParam.packetFrames);
+    param.comParam.packetFrames = 3;
+    EXPECT_EQ(DH_SUCCESS, receiverTrans_->SetUp(param, param, callback, CAP_SPK));
+    EXPECT_EQ(3, receiverTrans_->param_.comParam.packetFrames);
+}
+
 /**
  * @tc.name: InitEngine_001
  * @tc.desc: Verify the InitEngine function.
@@ -182,5 +206,83 @@ HWTEST_F(AVReceiverEngineTransportTest, SetParameter_001, TestSize.Level1)
     receiverTrans_->receiverAdapter_ = std::make_shared<AVTransReceiverAdapter>();
     EXPECT_EQ(DH_SUCCESS, receiverTrans_->SetParameter(audioParam));
 }
+
+/**
+ * @tc.name: OnEngineDataAvailable_001
+ * @tc.desc: Verify the received frames view the transport buffer without a copy.
+ * @tc.type: FUNC
+ * @tc.require: AR000HTAPM
+ */
+HWTEST_F(AVReceiverEngineTransportTest, OnEngineDataAvailable_001, TestSize.Level1)
+{
+    constexpr size_t frameSize = 64;
+    constexpr size_t frameNum = 2;
+    constexpr int64_t pts = 1000;
+    auto callback = std::make_shared<MockAVReceiverTransportCallback>();
+    receiverTrans_ = std::make_shared<AVTransReceiverTransport>("devId", callback);
+    receiverTrans_->param_.comParam.frameSize = frameSize;
+    receiverTrans_->param_.comParam.packetFrames = frameNum;
+    auto buffer = std::make_shared<AVTransBuffer>(MetaType::AUDIO);
+    auto bufferData = buffer->CreateBufferData(frameSize * frameNum);
+    ASSERT_NE(bufferData, nullptr);
+    std::vector<uint8_t> pcm(frameSize * frameNum, 0x5a);
+    bufferData->Write(pcm.data(), pcm.size());
+    buffer->SetPts(pts);
+    receiverTrans_->OnEngineDataAvailable(buffer);
+
+    ASSERT_EQ(frameNum, callback->frames_.size());
+    for (size_t i = 0; i < frameNum; i++) {
+        auto frame = callback->frames_[i];
+        EXPECT_TRUE(frame->IsView());
+        EXPECT_EQ(frameSize, frame->Size());
+        EXPECT_EQ(bufferData->GetAddress() + i * frameSize, frame->Data());
+    }
+    EXPECT_EQ(pts, callback->frames_[0]->GetPts());
+    std::weak_ptr<AVTransBuffer> weakBuffer = buffer;
+    buffer = nullptr;
+    bufferData = nullptr;
+    EXPECT_FALSE(weakBuffer.expired());
+    EXPECT_EQ(0x5a, callback->frames_[frameNum - 1]->Data()[frameSize - 1]);
+    callback->frames_.clear();
+    EXPECT_TRUE(weakBuffer.expired());
+}
+
+/**
+ * @tc.name: OnEngineDataAvailable_002
+ * @tc.desc: Verify buffers of another size than a frame or a packet are counted and re-sliced or dropped.
+ * @tc.type: FUNC
+ * @tc.require: AR000HTAPM
+ */
+HWTEST_F(AVReceiverEngineTransportTest, OnEngineDataAvailable_002, TestSize.Level1)
+{
+    constexpr size_t frameSize = 64;
+    constexpr size_t frameNum = 3;
+    auto callback = std::make_shared<MockAVReceiverTransportCallback>();
+    receiverTrans_ = std::make_shared<AVTransReceiverTransport>("devId", callback);
+    receiverTrans_->param_.comParam.frameSize = frameSize;
+    receiverTrans_->param_.comParam.packetFrames = frameNum;
+    auto feed = [this](size_t size) {
+        auto buffer = std::make_shared<AVTransBuffer>(MetaType::AUDIO);
+        auto bufferData = buffer->CreateBufferData(size);
+        std::vector<uint8_t> pcm(size, 0x5a);
+        bufferData->Write(pcm.data(), pcm.size());
+        receiverTrans_->OnEngineDataAvailable(buffer);
+    };
+
+    feed(frameSize);
+    EXPECT_EQ(1, callback->frames_.size());
+    EXPECT_EQ(0, receiverTrans_->packetMismatchCount_.load());
+    callback->frames_.clear();
+    feed(frameSize * 2);
+    ASSERT_EQ(2, callback->frames_.size());
+    for (const auto &frame : callback->frames_) {
+        EXPECT_EQ(frameSize, frame->Size());
+    }
+    EXPECT_EQ(1, receiverTrans_->packetMismatchCount_.load());
+    callback->frames_.clear();
+    feed(frameSize * frameNum + 4);
+    EXPECT_TRUE(callback->frames_.empty());
+    EXPECT_EQ(2, receiverTrans_->packetMismatchCount_.load());
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
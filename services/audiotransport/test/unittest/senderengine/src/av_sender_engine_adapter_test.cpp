@@ -140,6 +140,38 @@ HWTEST_F(AVSenderEngineAdapterTest, PushData_001, TestSize.Level1)
     EXPECT_EQ(DH_SUCCESS, senderAdapter_->PushData(audioData));
 }
 
+/**
+ * @tc.name: AcquireSendBuffer_001
+ * @tc.desc: Verify a send buffer is pushed to the engine without a copy.
+ * @tc.type: FUNC
+ * @tc.require: AR000HTAPM
+ */
+HWTEST_F(AVSenderEngineAdapterTest, AcquireSendBuffer_001, TestSize.Level1)
+{
+    size_t bufLen = 4096;
+    ASSERT_NE(senderAdapter_, nullptr);
+    EXPECT_EQ(nullptr, senderAdapter_->AcquireSendBuffer(0));
+    auto engine = std::make_shared<MockIAVSenderEngine>();
+    senderAdapter_->senderEngine_ = engine;
+    std::shared_ptr<AudioData> audioData = senderAdapter_->AcquireSendBuffer(bufLen);
+    ASSERT_NE(nullptr, audioData);
+    EXPECT_EQ(bufLen, audioData->Size());
+    audioData->Data()[0] = 1;
+    audioData->SetRange(0, bufLen / 2);
+    EXPECT_EQ(DH_SUCCESS, senderAdapter_->PushData(audioData));
+    ASSERT_NE(nullptr, engine->lastBuffer_);
+    auto bufferData = engine->lastBuffer_->GetBufferData(0);
+    ASSERT_NE(nullptr, bufferData);
+    EXPECT_EQ(audioData->Data(), bufferData->GetAddress());
+    EXPECT_EQ(bufLen / 2, bufferData->GetSize());
+
+    std::shared_ptr<AudioData> plain = std::make_shared<AudioData>(bufLen);
+    EXPECT_EQ(DH_SUCCESS, senderAdapter_->PushData(plain));
+    bufferData = engine->lastBuffer_->GetBufferData(0);
+    ASSERT_NE(nullptr, bufferData);
+    EXPECT_NE(plain->Data(), bufferData->GetAddress());
+}
+
 /**
  * @tc.name: CreateControlChannel_001
  * @tc.desc: Verify the CreateControlChannel function.
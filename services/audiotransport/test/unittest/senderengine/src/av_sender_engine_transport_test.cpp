@@ -126,6 +126,47 @@ HWTEST_F(AVSenderEngineTransportTest, Pause_001, TestSize.Level1)
     EXPECT_EQ(DH_SUCCESS, senderTrans_->FeedAudioData(audioData));
 }
 
+/**
+ * @tc.name: AcquireSendBuffer_001
+ * @tc.desc: Verify send buffers are lent only for frames that are not gathered into packets.
+ * @tc.type: FUNC
+ * @tc.require: AR000HTAPM
+ */
+HWTEST_F(AVSenderEngineTransportTest, AcquireSendBuffer_001, TestSize.Level1)
+{
+    AudioParam param;
+    param.comParam.sampleRate = SAMPLE_RATE_48000;
+    param.comParam.channelMask = STEREO;
+    param.comParam.bitFormat = SAMPLE_S16LE;
+    param.comParam.frameSize = 3840;
+    param.comParam.packetFrames = 3;
+    size_t frameSize = param.comParam.frameSize;
+    ASSERT_NE(senderTrans_, nullptr);
+    EXPECT_EQ(nullptr, senderTrans_->AcquireSendBuffer(frameSize));
+    senderTrans_->senderAdapter_ = std::make_shared<AVTransSenderAdapter>();
+    auto engine = std::make_shared<MockIAVSenderEngine>();
+    senderTrans_->senderAdapter_->senderEngine_ = engine;
+    std::shared_ptr<AudioData> audioData = senderTrans_->AcquireSendBuffer(frameSize);
+    ASSERT_NE(nullptr, audioData);
+    EXPECT_EQ(DH_SUCCESS, senderTrans_->FeedAudioData(audioData));
+    ASSERT_NE(nullptr, engine->lastBuffer_);
+    EXPECT_EQ(audioData->Data(), engine->lastBuffer_->GetBufferData(0)->GetAddress());
+
+    std::shared_ptr<IAudioDataTransCallback> callback = nullptr;
+    EXPECT_EQ(DH_SUCCESS, senderTrans_->SetUp(param, param, callback, CAP_SPK));
+    EXPECT_EQ(nullptr, senderTrans_->AcquireSendBuffer(frameSize));
+    EXPECT_NE(nullptr, senderTrans_->AcquireSendBuffer(frameSize / 2));
+    engine->lastBuffer_ = nullptr;
+    uint32_t framesPerPacket = senderTrans_->packetizer_.GetFramesPerPacket();
+    EXPECT_EQ(param.comParam.packetFrames, framesPerPacket);
+    for (uint32_t i = 0; i < framesPerPacket; i++) {
+        audioData = std::make_shared<AudioData>(frameSize);
+        EXPECT_EQ(DH_SUCCESS, senderTrans_->FeedAudioData(audioData));
+    }
+    ASSERT_NE(nullptr, engine->lastBuffer_);
+    EXPECT_EQ(frameSize * framesPerPacket, engine->lastBuffer_->GetBufferData(0)->GetSize());
+}
+
 /**
  * @tc.name: Pause_002
  * @tc.desc: Verify the Pause function.
@@ -16,7 +16,9 @@
 #ifndef OHOS_AUDIO_DATA_H
 #define OHOS_AUDIO_DATA_H
 
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
 
 namespace OHOS {
@@ -24,11 +26,42 @@ namespace DistributedHardware {
 using std::string;
 using std::map;
 
+enum class AudioDataMetaKey : uint32_t {
+    SEQUENCE = 0,
+    CAPTURE_TIME = 1,
+    PTS = 2,
+    PTS_SPECIAL = 3,
+    FLAGS = 4,
+    CLOCK_ID = 5,
+    META_KEY_MAX,
+};
+
+constexpr uint32_t AUDIO_DATA_FLAG_SILENCE = 1U << 0;
+constexpr uint32_t AUDIO_DATA_FLAG_CONCEALED = 1U << 1;
+constexpr uint32_t AUDIO_DATA_FLAG_DISCONTINUITY = 1U << 2;
+
 class AudioData {
 public:
-    explicit AudioData(const size_t capacity);
+    explicit AudioData(const size_t capacity, bool largeBuffer = false);
     ~AudioData();
 
+    /*
+     * Returns a view of [offset, offset + size) of origin's current range without copying. The view
+     * holds a reference to the frame that owns the memory, so a pooled frame is not recycled while
+     * any view of it is alive. Writes through a view are visible in the origin. Metadata is not
+     * inherited.
+     */
+    static std::shared_ptr<AudioData> Slice(const std::shared_ptr<AudioData> &origin, size_t offset, size_t size);
+    /*
+     * Returns a view of memory this class does not own, such as a mapped ashmem slot or a received
+     * transport buffer. keeper is held by the view and by every slice of it, so whatever it pins stays
+     * alive until the last one is released.
+     */
+    static std::shared_ptr<AudioData> Wrap(uint8_t *data, size_t size, const std::shared_ptr<void> &keeper);
+    bool IsView() const;
+    // What a view holds to keep its memory alive; nullptr for a frame that owns its memory.
+    const std::shared_ptr<void> &GetKeeper() const;
+
     size_t Size() const;
     size_t Capacity() const;
     uint8_t *Data() const;
@@ -38,23 +71,53 @@ public:
     void SetPtsSpecial(int64_t pts);
     int64_t GetPtsSpecial();
 
+    void SetMeta(AudioDataMetaKey key, int64_t value);
+    bool GetMeta(AudioDataMetaKey key, int64_t &value) const;
+    void SetFlags(uint32_t flags);
+    bool HasFlag(uint32_t flag) const;
+    int32_t SetExtMeta(uint32_t key, int64_t value);
+    bool GetExtMeta(uint32_t key, int64_t &value) const;
+    void ResetMeta();
+
+    void SetInt32(const string &name, int32_t value);
     void SetInt64(const string name, int64_t value);
+    void SetString(const string &name, const string &value);
     bool FindInt32(const string &name, int32_t &value);
     bool FindInt64(const string &name, int64_t &value);
     bool FindString(const string &name, string &value);
 
 private:
+    friend class AudioDataPool;
+
+    AudioData(const std::shared_ptr<void> &owner, uint8_t *data, size_t size);
+
     const uint32_t CAPACITY_MAX_SIZE = 2 * 4096;
+    const uint32_t LARGE_CAPACITY_MAX_SIZE = 64 * 4096;
+    std::shared_ptr<void> owner_ = nullptr;
     size_t capacity_ = 0;
     size_t rangeOffset_ = 0;
     size_t rangeLength_ = 0;
     uint8_t *data_ = nullptr;
-    int64_t pts_ = 0;
-    int64_t ptsSpecial_ = 0;
 
-    map<string, int32_t> int32Map_;
-    map<string, int64_t> int64Map_;
-    map<string, string> stringMap_;
+    // Typed per-frame metadata lives in fixed inline slots; metaMask_ records which slots are set.
+    static constexpr uint32_t META_SLOT_NUM = static_cast<uint32_t>(AudioDataMetaKey::META_KEY_MAX);
+    static constexpr uint32_t EXT_META_MAX_NUM = 4;
+    struct ExtMeta {
+        uint32_t key = 0;
+        int64_t value = 0;
+    };
+    int64_t meta_[META_SLOT_NUM] = {};
+    uint32_t metaMask_ = 0;
+    ExtMeta extMeta_[EXT_META_MAX_NUM] = {};
+    uint32_t extMetaNum_ = 0;
+
+    // String-keyed metadata is kept only for compatibility and is allocated on first use.
+    struct NamedMeta {
+        map<string, int32_t> int32Map;
+        map<string, int64_t> int64Map;
+        map<string, string> stringMap;
+    };
+    std::unique_ptr<NamedMeta> namedMeta_ = nullptr;
 
     AudioData(const AudioData &) = delete;
     AudioData &operator = (const AudioData &) = delete;
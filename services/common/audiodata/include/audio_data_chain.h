@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AUDIO_DATA_CHAIN_H
+#define OHOS_AUDIO_DATA_CHAIN_H
+
+#include <deque>
+#include <memory>
+
+#include "audio_data.h"
+#include "audio_data_pool.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Gather list of AudioData segments read front to back as one byte stream. Segments are referenced,
+ * not copied. Take() returns a zero-copy slice when the requested bytes lie inside the front
+ * segment and gathers them into one new frame only when they straddle a segment boundary.
+ */
+class AudioDataChain {
+public:
+    AudioDataChain() = default;
+    ~AudioDataChain() = default;
+
+    int32_t Append(const std::shared_ptr<AudioData> &data);
+    int32_t CopyTo(uint8_t *dst, size_t len) const;
+    int32_t Consume(size_t len);
+    std::shared_ptr<AudioData> Take(size_t len, const std::shared_ptr<AudioDataPool> &pool = nullptr);
+    size_t Size() const;
+    size_t SegmentNum() const;
+    void Clear();
+
+private:
+    std::deque<std::shared_ptr<AudioData>> segments_;
+    size_t headOffset_ = 0;
+    size_t size_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_AUDIO_DATA_CHAIN_H
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AUDIO_DATA_POOL_H
+#define OHOS_AUDIO_DATA_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "audio_data.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Fixed-size pool of AudioData frames for one stream. Acquire() pops a pre-allocated frame from a
+ * lock-free free list and wraps it in a shared_ptr; the frame goes back to the free list when the
+ * last reference is dropped, so steady-state traffic neither allocates nor zero-fills. The
+ * shared_ptr control block is placed in storage owned by the slot as well, and the slot is only
+ * recycled once that control block has been released.
+ *
+ * Requests for another capacity, or made while every frame is in flight, fall back to a plain
+ * heap-allocated AudioData. Frames are allocated in large-buffer mode, so a pool can hold packets
+ * of several frames.
+ */
+class AudioDataPool : public std::enable_shared_from_this<AudioDataPool> {
+public:
+    static constexpr uint32_t DEFAULT_POOL_SIZE = 32;
+
+    AudioDataPool(const size_t capacity, const uint32_t poolSize);
+    ~AudioDataPool();
+
+    std::shared_ptr<AudioData> Acquire(const size_t capacity, bool zeroFill = false);
+    size_t Capacity() const;
+    uint32_t PoolSize() const;
+    uint64_t GetMissCount() const;
+
+private:
+    template <typename T>
+    class SlotAllocator;
+
+    static constexpr size_t CTRL_BLOCK_SIZE = 128;
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+    static constexpr uint32_t TAG_SHIFT = 32;
+
+    struct Slot {
+        std::unique_ptr<AudioData> data = nullptr;
+        std::atomic<uint32_t> next = INVALID_INDEX;
+        alignas(std::max_align_t) uint8_t ctrlBlock[CTRL_BLOCK_SIZE] = {};
+    };
+
+    bool Pop(uint32_t &index);
+    void Push(uint32_t index);
+
+    size_t capacity_ = 0;
+    uint32_t poolSize_ = 0;
+    std::unique_ptr<Slot[]> slots_ = nullptr;
+    std::atomic<uint64_t> head_ = INVALID_INDEX;
+    std::atomic<uint64_t> missCount_ = 0;
+
+    AudioDataPool(const AudioDataPool &) = delete;
+    AudioDataPool &operator = (const AudioDataPool &) = delete;
+};
+
+std::shared_ptr<AudioData> AcquireAudioData(const std::shared_ptr<AudioDataPool> &pool, const size_t capacity,
+    bool zeroFill = false);
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_AUDIO_DATA_POOL_H
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AUDIO_DATA_QUEUE_H
+#define OHOS_AUDIO_DATA_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "audio_data.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Bounded single-producer/single-consumer queue of AudioData frames. Push() may only be called
+ * from one thread and Pop()/WaitSize() from one other thread; neither side takes a lock. Waiters
+ * sleep on a futex and are only woken when the side they wait on makes progress.
+ *
+ * Frames are only ever dropped oldest first, and every dropped frame is counted in GetDropCount().
+ * The queue keeps at most maxDepth frames: Pop() discards the oldest frames beyond that before
+ * returning one, so a stalled consumer resumes with fresh data. The ring itself holds twice as
+ * many slots; when the consumer has stopped draining for that long, Push() evicts the oldest
+ * frame to make room. Both sides claim frames by advancing readPos_ with a CAS, and the consumer
+ * publishes releasePos_ once it has moved its frames out, so the producer never reuses a slot
+ * that is still being read. WaitEmpty() may be called from any third thread to wait for the
+ * consumer to drain the queue.
+ */
+class AudioDataQueue {
+public:
+    explicit AudioDataQueue(const uint32_t maxDepth);
+    ~AudioDataQueue() = default;
+
+    bool Push(const std::shared_ptr<AudioData> &data);
+    std::shared_ptr<AudioData> Pop();
+    int32_t WaitSize(const uint32_t size, const int64_t timeoutNs);
+    int32_t WaitEmpty(const int64_t timeoutNs);
+    void Wakeup();
+    uint32_t Size() const;
+    uint32_t MaxDepth() const;
+    uint64_t GetDropCount() const;
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    void Notify(std::atomic<uint32_t> &seq, std::atomic<uint32_t> &waiters);
+    int32_t Wait(std::atomic<uint32_t> &seq, std::atomic<uint32_t> &waiters, uint32_t expected,
+        const int64_t timeoutNs);
+
+    uint32_t maxDepth_ = 0;
+    uint32_t mask_ = 0;
+    std::unique_ptr<std::shared_ptr<AudioData>[]> slots_ = nullptr;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> writePos_ = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> readPos_ = 0;
+    std::atomic<uint64_t> releasePos_ = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> pushSeq_ = 0;
+    std::atomic<uint32_t> pushWaiters_ = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> popSeq_ = 0;
+    std::atomic<uint32_t> popWaiters_ = 0;
+    std::atomic<uint64_t> dropCount_ = 0;
+
+    AudioDataQueue(const AudioDataQueue &) = delete;
+    AudioDataQueue &operator = (const AudioDataQueue &) = delete;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_AUDIO_DATA_QUEUE_H
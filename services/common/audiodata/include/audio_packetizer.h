@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AUDIO_PACKETIZER_H
+#define OHOS_AUDIO_PACKETIZER_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "audio_data.h"
+#include "audio_data_pool.h"
+#include "audio_param.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Aggregates consecutive frames of one stream into transport packets and splits such packets back
+ * into frames on the receiving side. The number of frames per packet is negotiated: the source picks
+ * it with NegotiateFramesPerPacket() and sends it to the sink as comParam.packetFrames, and both ends
+ * packetize and split with that value. A packet is the frames' PCM back to back with the pts of its
+ * first frame, so it stays a plain PCM stream for the engine's encoder; Split() splits a packet into
+ * views of its frames and derives the pts of frame i from its offset. When frames are aggregated a
+ * received buffer of another size than one frame or one packet is a mismatch: it is re-sliced if it
+ * holds whole frames and dropped otherwise, so no consumer sees a frame of another size than frameSize.
+ *
+ * Frames of another size than the stream's frameSize flush the packet in progress and are sent on
+ * their own, for the receiver to drop or re-slice as above. An incomplete packet is flushed as the
+ * separate frames it holds. Each frame is copied into the open packet when it is pushed, so no frame is
+ * referenced after Push() returns and views of memory the producer rewrites, such as ashmem slots,
+ * cannot tear. The packet buffer comes from the packet allocator when one is set, so a transport can
+ * have packets built directly in the memory it sends. The packetizer is not thread-safe.
+ */
+class AudioPacketizer {
+public:
+    static constexpr uint32_t PACKET_MAX_MS = 60;
+    // Aggregation is opt-in: every packet time above one frame delays the first frame of a packet by
+    // the rest of it, so by default each frame is sent on its own.
+    static constexpr uint32_t PACKET_DEFAULT_MS = 0;
+
+    using PacketAllocator = std::function<std::shared_ptr<AudioData>(size_t)>;
+
+    AudioPacketizer() = default;
+    ~AudioPacketizer() = default;
+
+    int32_t Init(const AudioParam &param);
+    void SetPacketAllocator(const PacketAllocator &allocator);
+    int32_t Push(const std::shared_ptr<AudioData> &frame, std::vector<std::shared_ptr<AudioData>> &packets);
+    void Flush(std::vector<std::shared_ptr<AudioData>> &packets);
+    uint32_t GetFramesPerPacket() const;
+    size_t GetPacketSize() const;
+    bool IsAggregated(const size_t frameSize) const;
+
+    static uint32_t GetPacketTimeMs(const AudioParam &param);
+    static uint32_t NegotiateFramesPerPacket(const AudioParam &param);
+    // packetFrames comes from the remote peer, so it is checked against the packet time limit.
+    static bool IsValidFramesPerPacket(const AudioParam &param);
+    static bool IsMismatchedPacket(const AudioParam &param, const size_t size);
+    static int32_t Split(const std::shared_ptr<AudioData> &packet, const AudioParam &param,
+        std::vector<std::shared_ptr<AudioData>> &frames);
+
+private:
+    std::shared_ptr<AudioData> AcquirePacket();
+
+    size_t frameSize_ = 0;
+    int64_t frameUs_ = 0;
+    uint32_t framesPerPacket_ = 1;
+    std::shared_ptr<AudioData> packet_ = nullptr;
+    size_t packetLen_ = 0;
+    int64_t pts_ = 0;
+    int64_t ptsSpecial_ = 0;
+    std::shared_ptr<AudioDataPool> pool_ = nullptr;
+    PacketAllocator allocator_ = nullptr;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_AUDIO_PACKETIZER_H
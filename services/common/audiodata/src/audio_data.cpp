@@ -18,9 +18,10 @@
 
 namespace OHOS {
 namespace DistributedHardware {
-AudioData::AudioData(const size_t capacity)
+AudioData::AudioData(const size_t capacity, bool largeBuffer)
 {
-    if (capacity != 0 && capacity < CAPACITY_MAX_SIZE) {
+    size_t maxSize = largeBuffer ? LARGE_CAPACITY_MAX_SIZE : CAPACITY_MAX_SIZE;
+    if (capacity != 0 && capacity < maxSize) {
         data_ = new (std::nothrow) uint8_t[capacity] {0};
         if (data_ != nullptr) {
             capacity_ = capacity;
@@ -29,6 +30,39 @@ AudioData::AudioData(const size_t capacity)
     }
 }
 
+AudioData::AudioData(const std::shared_ptr<void> &owner, uint8_t *data, size_t size)
+    : owner_(owner), capacity_(size), rangeLength_(size), data_(data)
+{
+}
+
+std::shared_ptr<AudioData> AudioData::Slice(const std::shared_ptr<AudioData> &origin, size_t offset, size_t size)
+{
+    if (origin == nullptr || origin->data_ == nullptr || size == 0 || offset > origin->Size() ||
+        size > origin->Size() - offset) {
+        return nullptr;
+    }
+    std::shared_ptr<void> owner = origin->owner_ != nullptr ? origin->owner_ : origin;
+    return std::shared_ptr<AudioData>(new (std::nothrow) AudioData(owner, origin->Data() + offset, size));
+}
+
+std::shared_ptr<AudioData> AudioData::Wrap(uint8_t *data, size_t size, const std::shared_ptr<void> &keeper)
+{
+    if (data == nullptr || size == 0 || keeper == nullptr) {
+        return nullptr;
+    }
+    return std::shared_ptr<AudioData>(new (std::nothrow) AudioData(keeper, data, size));
+}
+
+bool AudioData::IsView() const
+{
+    return owner_ != nullptr;
+}
+
+const std::shared_ptr<void> &AudioData::GetKeeper() const
+{
+    return owner_;
+}
+
 size_t AudioData::Capacity() const
 {
     return capacity_;
@@ -57,33 +91,123 @@ int32_t AudioData::SetRange(size_t offset, size_t size)
 
 void AudioData::SetPts(int64_t pts)
 {
-    pts_ = pts;
+    SetMeta(AudioDataMetaKey::PTS, pts);
 }
 
 int64_t AudioData::GetPts()
 {
-    return pts_;
+    return meta_[static_cast<uint32_t>(AudioDataMetaKey::PTS)];
 }
 
 void AudioData::SetPtsSpecial(int64_t pts)
 {
-    ptsSpecial_ = pts;
+    SetMeta(AudioDataMetaKey::PTS_SPECIAL, pts);
 }
 
 int64_t AudioData::GetPtsSpecial()
 {
-    return ptsSpecial_;
+    return meta_[static_cast<uint32_t>(AudioDataMetaKey::PTS_SPECIAL)];
+}
+
+void AudioData::SetMeta(AudioDataMetaKey key, int64_t value)
+{
+    uint32_t index = static_cast<uint32_t>(key);
+    if (index >= META_SLOT_NUM) {
+        return;
+    }
+    meta_[index] = value;
+    metaMask_ |= 1U << index;
+}
+
+bool AudioData::GetMeta(AudioDataMetaKey key, int64_t &value) const
+{
+    uint32_t index = static_cast<uint32_t>(key);
+    if (index >= META_SLOT_NUM || (metaMask_ & (1U << index)) == 0) {
+        value = 0;
+        return false;
+    }
+    value = meta_[index];
+    return true;
+}
+
+void AudioData::SetFlags(uint32_t flags)
+{
+    int64_t oldFlags = meta_[static_cast<uint32_t>(AudioDataMetaKey::FLAGS)];
+    SetMeta(AudioDataMetaKey::FLAGS, oldFlags | static_cast<int64_t>(flags));
+}
+
+bool AudioData::HasFlag(uint32_t flag) const
+{
+    return (static_cast<uint64_t>(meta_[static_cast<uint32_t>(AudioDataMetaKey::FLAGS)]) & flag) != 0;
+}
+
+int32_t AudioData::SetExtMeta(uint32_t key, int64_t value)
+{
+    for (uint32_t i = 0; i < extMetaNum_; i++) {
+        if (extMeta_[i].key == key) {
+            extMeta_[i].value = value;
+            return DH_SUCCESS;
+        }
+    }
+    if (extMetaNum_ >= EXT_META_MAX_NUM) {
+        return ERR_DH_AUDIO_FAILED;
+    }
+    extMeta_[extMetaNum_].key = key;
+    extMeta_[extMetaNum_].value = value;
+    extMetaNum_++;
+    return DH_SUCCESS;
+}
+
+bool AudioData::GetExtMeta(uint32_t key, int64_t &value) const
+{
+    for (uint32_t i = 0; i < extMetaNum_; i++) {
+        if (extMeta_[i].key == key) {
+            value = extMeta_[i].value;
+            return true;
+        }
+    }
+    value = 0;
+    return false;
+}
+
+void AudioData::ResetMeta()
+{
+    for (uint32_t i = 0; i < META_SLOT_NUM; i++) {
+        meta_[i] = 0;
+    }
+    metaMask_ = 0;
+    extMetaNum_ = 0;
+    namedMeta_ = nullptr;
+}
+
+void AudioData::SetInt32(const string &name, int32_t value)
+{
+    if (namedMeta_ == nullptr) {
+        namedMeta_ = std::make_unique<NamedMeta>();
+    }
+    namedMeta_->int32Map[name] = value;
 }
 
 void AudioData::SetInt64(const string name, int64_t value)
 {
-    int64Map_[name] = value;
+    if (namedMeta_ == nullptr) {
+        namedMeta_ = std::make_unique<NamedMeta>();
+    }
+    namedMeta_->int64Map[name] = value;
+}
+
+void AudioData::SetString(const string &name, const string &value)
+{
+    if (namedMeta_ == nullptr) {
+        namedMeta_ = std::make_unique<NamedMeta>();
+    }
+    namedMeta_->stringMap[name] = value;
 }
 
 bool AudioData::FindInt32(const string &name, int32_t &value)
 {
-    if (int32Map_.count(name) != 0) {
-        value = int32Map_[name];
+    if (namedMeta_ != nullptr && namedMeta_->int32Map.count(name) != 0) {
+        value = namedMeta_->int32Map[name];
         return true;
     } else {
         value = 0;
@@ -93,8 +217,8 @@ bool AudioData::FindInt32(const string &name, int32_t &value)
 
 bool AudioData::FindInt64(const string &name, int64_t &value)
 {
-    if (int64Map_.count(name) != 0) {
-        value = int64Map_[name];
+    if (namedMeta_ != nullptr && namedMeta_->int64Map.count(name) != 0) {
+        value = namedMeta_->int64Map[name];
         return true;
     } else {
         value = 0;
@@ -104,8 +228,8 @@ bool AudioData::FindInt64(const string &name, int64_t &value)
 
 bool AudioData::FindString(const string &name, string &value)
 {
-    if (stringMap_.count(name) != 0) {
-        value = stringMap_[name];
+    if (namedMeta_ != nullptr && namedMeta_->stringMap.count(name) != 0) {
+        value = namedMeta_->stringMap[name];
         return true;
     } else {
         value = "";
@@ -115,10 +239,10 @@ bool AudioData::FindString(const string &name, string &value)
 
 AudioData::~AudioData()
 {
-    if (data_ != nullptr) {
+    if (data_ != nullptr && owner_ == nullptr) {
         delete[] data_;
-        data_ = nullptr;
     }
+    data_ = nullptr;
 
     capacity_ = 0;
 }
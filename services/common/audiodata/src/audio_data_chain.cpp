@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "audio_data_chain.h"
+
+#include <securec.h>
+
+#include "daudio_errorcode.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+int32_t AudioDataChain::Append(const std::shared_ptr<AudioData> &data)
+{
+    if (data == nullptr || data->Data() == nullptr) {
+        return ERR_DH_AUDIO_NULLPTR;
+    }
+    if (data->Size() == 0) {
+        return DH_SUCCESS;
+    }
+    segments_.push_back(data);
+    size_ += data->Size();
+    return DH_SUCCESS;
+}
+
+int32_t AudioDataChain::CopyTo(uint8_t *dst, size_t len) const
+{
+    if (dst == nullptr) {
+        return ERR_DH_AUDIO_NULLPTR;
+    }
+    if (len > size_) {
+        return ERR_DH_AUDIO_FAILED;
+    }
+    size_t copied = 0;
+    size_t offset = headOffset_;
+    for (auto iter = segments_.begin(); iter != segments_.end() && copied < len; ++iter) {
+        size_t chunk = (*iter)->Size() - offset;
+        if (chunk > len - copied) {
+            chunk = len - copied;
+        }
+        if (memcpy_s(dst + copied, len - copied, (*iter)->Data() + offset, chunk) != EOK) {
+            return ERR_DH_AUDIO_FAILED;
+        }
+        copied += chunk;
+        offset = 0;
+    }
+    return DH_SUCCESS;
+}
+
+int32_t AudioDataChain::Consume(size_t len)
+{
+    if (len > size_) {
+        return ERR_DH_AUDIO_FAILED;
+    }
+    size_ -= len;
+    while (len > 0) {
+        size_t remain = segments_.front()->Size() - headOffset_;
+        if (len < remain) {
+            headOffset_ += len;
+            return DH_SUCCESS;
+        }
+        len -= remain;
+        segments_.pop_front();
+        headOffset_ = 0;
+    }
+    return DH_SUCCESS;
+}
+
+std::shared_ptr<AudioData> AudioDataChain::Take(size_t len, const std::shared_ptr<AudioDataPool> &pool)
+{
+    if (len == 0 || len > size_) {
+        return nullptr;
+    }
+    std::shared_ptr<AudioData> out = nullptr;
+    if (segments_.front()->Size() - headOffset_ >= len) {
+        out = AudioData::Slice(segments_.front(), headOffset_, len);
+    } else {
+        out = (pool != nullptr && pool->Capacity() == len) ? pool->Acquire(len) :
+            std::make_shared<AudioData>(len, true);
+        if (out == nullptr || out->Capacity() != len || CopyTo(out->Data(), len) != DH_SUCCESS) {
+            return nullptr;
+        }
+    }
+    if (out != nullptr) {
+        Consume(len);
+    }
+    return out;
+}
+
+size_t AudioDataChain::Size() const
+{
+    return size_;
+}
+
+size_t AudioDataChain::SegmentNum() const
+{
+    return segments_.size();
+}
+
+void AudioDataChain::Clear()
+{
+    segments_.clear();
+    headOffset_ = 0;
+    size_ = 0;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
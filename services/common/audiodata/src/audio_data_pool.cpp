@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "audio_data_pool.h"
+
+#include <cinttypes>
+#include <securec.h>
+
+#include "daudio_log.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "AudioDataPool"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Hands the slot's inline storage to std::shared_ptr for its control block. deallocate() is the
+ * last access the control block makes to that storage, so it is where the slot is recycled.
+ */
+template <typename T>
+class AudioDataPool::SlotAllocator {
+public:
+    using value_type = T;
+
+    SlotAllocator(std::shared_ptr<AudioDataPool> pool, uint32_t index) : pool_(std::move(pool)), index_(index) {}
+
+    template <typename U>
+    SlotAllocator(const SlotAllocator<U> &other) : pool_(other.pool_), index_(other.index_) {}
+
+    T *allocate(size_t n)
+    {
+        static_assert(sizeof(T) <= CTRL_BLOCK_SIZE, "shared_ptr control block does not fit in the slot.");
+        static_assert(alignof(T) <= alignof(std::max_align_t), "shared_ptr control block is over-aligned.");
+        (void)n;
+        return reinterpret_cast<T *>(pool_->slots_[index_].ctrlBlock);
+    }
+
+    void deallocate(T *ptr, size_t n)
+    {
+        (void)ptr;
+        (void)n;
+        pool_->Push(index_);
+    }
+
+    template <typename U>
+    bool operator == (const SlotAllocator<U> &other) const
+    {
+        return pool_ == other.pool_ && index_ == other.index_;
+    }
+
+    template <typename U>
+    bool operator != (const SlotAllocator<U> &other) const
+    {
+        return !(*this == other);
+    }
+
+    std::shared_ptr<AudioDataPool> pool_;
+    uint32_t index_;
+};
+
+AudioDataPool::AudioDataPool(const size_t capacity, const uint32_t poolSize) : capacity_(capacity)
+{
+    if (poolSize == 0 || poolSize == INVALID_INDEX) {
+        DHLOGE("Invalid pool size: %{public}u.", poolSize);
+        return;
+    }
+    slots_ = std::unique_ptr<Slot[]>(new (std::nothrow) Slot[poolSize]);
+    CHECK_NULL_VOID(slots_);
+    for (uint32_t i = 0; i < poolSize; i++) {
+        slots_[i].data = std::make_unique<AudioData>(capacity, true);
+        if (slots_[i].data->Capacity() != capacity) {
+            DHLOGE("Invalid frame capacity: %{public}zu.", capacity);
+            slots_ = nullptr;
+            return;
+        }
+    }
+    poolSize_ = poolSize;
+    for (uint32_t i = 0; i < poolSize_; i++) {
+        Push(i);
+    }
+}
+
+AudioDataPool::~AudioDataPool()
+{
+    DHLOGD("Release audio data pool, capacity: %{public}zu, miss count: %{public}" PRIu64,
+        capacity_, missCount_.load(std::memory_order_relaxed));
+}
+
+size_t AudioDataPool::Capacity() const
+{
+    return capacity_;
+}
+
+uint32_t AudioDataPool::PoolSize() const
+{
+    return poolSize_;
+}
+
+uint64_t AudioDataPool::GetMissCount() const
+{
+    return missCount_.load(std::memory_order_relaxed);
+}
+
+std::shared_ptr<AudioData> AudioDataPool::Acquire(const size_t capacity, bool zeroFill)
+{
+    uint32_t index = INVALID_INDEX;
+    if (capacity != capacity_ || !Pop(index)) {
+        missCount_.fetch_add(1, std::memory_order_relaxed);
+        DHLOGD("Pool miss, capacity: %{public}zu, pool capacity: %{public}zu.", capacity, capacity_);
+        return std::make_shared<AudioData>(capacity, true);
+    }
+    AudioData *data = slots_[index].data.get();
+    data->rangeOffset_ = 0;
+    data->rangeLength_ = data->capacity_;
+    data->ResetMeta();
+    if (zeroFill) {
+        (void)memset_s(data->Data(), data->Capacity(), 0, data->Capacity());
+    }
+    return std::shared_ptr<AudioData>(data, [](AudioData *) {},
+        SlotAllocator<AudioData>(shared_from_this(), index));
+}
+
+bool AudioDataPool::Pop(uint32_t &index)
+{
+    uint64_t head = head_.load(std::memory_order_acquire);
+    while (true) {
+        uint32_t top = static_cast<uint32_t>(head);
+        if (top == INVALID_INDEX) {
+            return false;
+        }
+        uint32_t next = slots_[top].next.load(std::memory_order_relaxed);
+        uint64_t newHead = (((head >> TAG_SHIFT) + 1) << TAG_SHIFT) | next;
+        if (head_.compare_exchange_weak(head, newHead, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            index = top;
+            return true;
+        }
+    }
+}
+
+void AudioDataPool::Push(uint32_t index)
+{
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    uint64_t newHead = 0;
+    do {
+        slots_[index].next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        newHead = (((head >> TAG_SHIFT) + 1) << TAG_SHIFT) | index;
+    } while (!head_.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+}
+
+std::shared_ptr<AudioData> AcquireAudioData(const std::shared_ptr<AudioDataPool> &pool, const size_t capacity,
+    bool zeroFill)
+{
+    if (pool == nullptr) {
+        return std::make_shared<AudioData>(capacity);
+    }
+    return pool->Acquire(capacity, zeroFill);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "audio_data_queue.h"
+
+#include <thread>
+
+#include "daudio_errorcode.h"
+#include "daudio_util.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr uint32_t SLOT_NUM_FACTOR = 2;
+
+uint32_t RoundUpPowerOfTwo(uint32_t value)
+{
+    uint32_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+}
+
+AudioDataQueue::AudioDataQueue(const uint32_t maxDepth) : maxDepth_(maxDepth == 0 ? 1 : maxDepth)
+{
+    uint32_t slotNum = RoundUpPowerOfTwo(maxDepth_ * SLOT_NUM_FACTOR);
+    slots_ = std::make_unique<std::shared_ptr<AudioData>[]>(slotNum);
+    mask_ = slotNum - 1;
+}
+
+bool AudioDataQueue::Push(const std::shared_ptr<AudioData> &data)
+{
+    if (data == nullptr) {
+        return false;
+    }
+    uint64_t writePos = writePos_.load(std::memory_order_relaxed);
+    // The slot is free once the consumer has released the frame a ring ago; otherwise the ring is full.
+    while (writePos - releasePos_.load(std::memory_order_acquire) > mask_) {
+        uint64_t oldest = writePos - mask_ - 1;
+        uint64_t readPos = oldest;
+        if (readPos_.compare_exchange_strong(readPos, oldest + 1, std::memory_order_acq_rel,
+            std::memory_order_acquire)) {
+            // The oldest frame is evicted, so its slot belongs to the producer and is overwritten below.
+            dropCount_.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+        // The consumer has claimed the oldest frame and is still moving it out of its slot.
+        std::this_thread::yield();
+    }
+    slots_[writePos & mask_] = data;
+    writePos_.store(writePos + 1, std::memory_order_release);
+    Notify(pushSeq_, pushWaiters_);
+    return true;
+}
+
+std::shared_ptr<AudioData> AudioDataQueue::Pop()
+{
+    uint64_t readPos = readPos_.load(std::memory_order_acquire);
+    uint64_t target = 0;
+    do {
+        uint64_t writePos = writePos_.load(std::memory_order_acquire);
+        if (readPos == writePos) {
+            return nullptr;
+        }
+        target = writePos - readPos > maxDepth_ ? writePos - maxDepth_ : readPos;
+    } while (!readPos_.compare_exchange_weak(readPos, target + 1, std::memory_order_acq_rel,
+        std::memory_order_acquire));
+    for (; readPos < target; readPos++) {
+        slots_[readPos & mask_] = nullptr;
+        dropCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::shared_ptr<AudioData> data = std::move(slots_[target & mask_]);
+    releasePos_.store(target + 1, std::memory_order_release);
+    Notify(popSeq_, popWaiters_);
+    return data;
+}
+
+int32_t AudioDataQueue::WaitSize(const uint32_t size, const int64_t timeoutNs)
+{
+    uint32_t seq = pushSeq_.load(std::memory_order_acquire);
+    if (Size() >= size) {
+        return DH_SUCCESS;
+    }
+    int32_t ret = Wait(pushSeq_, pushWaiters_, seq, timeoutNs);
+    if (ret != DH_SUCCESS) {
+        return ret;
+    }
+    return Size() >= size ? DH_SUCCESS : ERR_DH_AUDIO_FAILED;
+}
+
+int32_t AudioDataQueue::WaitEmpty(const int64_t timeoutNs)
+{
+    uint32_t seq = popSeq_.load(std::memory_order_acquire);
+    if (Size() == 0) {
+        return DH_SUCCESS;
+    }
+    int32_t ret = Wait(popSeq_, popWaiters_, seq, timeoutNs);
+    if (ret != DH_SUCCESS) {
+        return ret;
+    }
+    return Size() == 0 ? DH_SUCCESS : ERR_DH_AUDIO_FAILED;
+}
+
+void AudioDataQueue::Wakeup()
+{
+    pushSeq_.fetch_add(1, std::memory_order_seq_cst);
+    FutexWake(pushSeq_, INT32_MAX);
+    popSeq_.fetch_add(1, std::memory_order_seq_cst);
+    FutexWake(popSeq_, INT32_MAX);
+}
+
+uint32_t AudioDataQueue::Size() const
+{
+    uint64_t readPos = readPos_.load(std::memory_order_acquire);
+    uint64_t writePos = writePos_.load(std::memory_order_acquire);
+    return writePos > readPos ? static_cast<uint32_t>(writePos - readPos) : 0;
+}
+
+uint32_t AudioDataQueue::MaxDepth() const
+{
+    return maxDepth_;
+}
+
+uint64_t AudioDataQueue::GetDropCount() const
+{
+    return dropCount_.load(std::memory_order_relaxed);
+}
+
+void AudioDataQueue::Notify(std::atomic<uint32_t> &seq, std::atomic<uint32_t> &waiters)
+{
+    seq.fetch_add(1, std::memory_order_seq_cst);
+    if (waiters.load(std::memory_order_seq_cst) != 0) {
+        FutexWake(seq, INT32_MAX);
+    }
+}
+
+int32_t AudioDataQueue::Wait(std::atomic<uint32_t> &seq, std::atomic<uint32_t> &waiters, uint32_t expected,
+    const int64_t timeoutNs)
+{
+    waiters.fetch_add(1, std::memory_order_seq_cst);
+    int32_t ret = FutexWait(seq, expected, timeoutNs);
+    waiters.fetch_sub(1, std::memory_order_relaxed);
+    return ret;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
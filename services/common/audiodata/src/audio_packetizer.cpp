@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "audio_packetizer.h"
+
+#include <algorithm>
+
+#include <securec.h>
+
+#include "daudio_constants.h"
+#include "daudio_errorcode.h"
+#include "daudio_log.h"
+#include "daudio_util.h"
+
+#undef DH_LOG_TAG
+#define DH_LOG_TAG "AudioPacketizer"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr uint32_t PACKET_POOL_SIZE = 8;
+
+int64_t GetDurationUs(const AudioParam &param, const size_t size)
+{
+    uint32_t bytesPerFrame = static_cast<uint32_t>(param.comParam.channelMask) *
+        GetBytesPerSample(param.comParam.bitFormat);
+    int64_t sampleRate = static_cast<int64_t>(param.comParam.sampleRate);
+    if (bytesPerFrame == 0 || sampleRate <= 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(size / bytesPerFrame) * AUDIO_US_PER_SECOND / sampleRate;
+}
+
+bool IsVoiceProfile(const AudioParam &param)
+{
+    StreamUsage usage = param.renderOpts.streamUsage;
+    SourceType source = param.captureOpts.sourceType;
+    return usage == STREAM_USAGE_VOICE_COMMUNICATION || usage == STREAM_USAGE_VOICE_ASSISTANT ||
+        usage == STREAM_USAGE_MMAP || source == SOURCE_TYPE_VOICE_CALL || source == SOURCE_TYPE_VOICE_COMMUNICATION ||
+        param.renderOpts.renderFlags == MMAP_MODE || param.captureOpts.capturerFlags == MMAP_MODE;
+}
+}
+
+int32_t AudioPacketizer::Init(const AudioParam &param)
+{
+    packet_ = nullptr;
+    packetLen_ = 0;
+    pool_ = nullptr;
+    framesPerPacket_ = 1;
+    frameSize_ = param.comParam.frameSize;
+    int64_t frameUs = GetDurationUs(param, frameSize_);
+    if (frameSize_ == 0 || frameUs <= 0) {
+        DHLOGE("Invalid frame, frameSize: %{public}zu.", frameSize_);
+        return ERR_DH_AUDIO_BAD_VALUE;
+    }
+    frameUs_ = frameUs;
+    if (!IsValidFramesPerPacket(param)) {
+        DHLOGE("Invalid packetFrames: %{public}u, send one frame per packet.", param.comParam.packetFrames);
+        return ERR_DH_AUDIO_BAD_VALUE;
+    }
+    framesPerPacket_ = param.comParam.packetFrames;
+    if (framesPerPacket_ > 1) {
+        pool_ = std::make_shared<AudioDataPool>(frameSize_ * framesPerPacket_, PACKET_POOL_SIZE);
+    }
+    DHLOGI("Packetizer init, frameSize: %{public}zu, framesPerPacket: %{public}u.", frameSize_, framesPerPacket_);
+    return DH_SUCCESS;
+}
+
+void AudioPacketizer::SetPacketAllocator(const PacketAllocator &allocator)
+{
+    allocator_ = allocator;
+}
+
+int32_t AudioPacketizer::Push(const std::shared_ptr<AudioData> &frame,
+    std::vector<std::shared_ptr<AudioData>> &packets)
+{
+    CHECK_NULL_RETURN(frame, ERR_DH_AUDIO_NULLPTR);
+    if (framesPerPacket_ <= 1 || frame->Size() != frameSize_) {
+        Flush(packets);
+        packets.push_back(frame);
+        return DH_SUCCESS;
+    }
+    if (packet_ == nullptr) {
+        packet_ = AcquirePacket();
+        if (packet_ == nullptr) {
+            DHLOGE("Acquire packet failed, send the frame on its own.");
+            packets.push_back(frame);
+            return DH_SUCCESS;
+        }
+        packetLen_ = 0;
+        pts_ = frame->GetPts();
+        ptsSpecial_ = frame->GetPtsSpecial();
+    }
+    // Copied now rather than referenced, because the frame may view memory its producer rewrites.
+    if (memcpy_s(packet_->Data() + packetLen_, packet_->Size() - packetLen_, frame->Data(), frameSize_) != EOK) {
+        DHLOGE("Copy frame into packet failed.");
+        return ERR_DH_AUDIO_FAILED;
+    }
+    packetLen_ += frameSize_;
+    if (packetLen_ >= GetPacketSize()) {
+        Flush(packets);
+    }
+    return DH_SUCCESS;
+}
+
+void AudioPacketizer::Flush(std::vector<std::shared_ptr<AudioData>> &packets)
+{
+    if (packet_ == nullptr || packetLen_ == 0) {
+        return;
+    }
+    std::shared_ptr<AudioData> packet = packet_;
+    size_t len = packetLen_;
+    packet_ = nullptr;
+    packetLen_ = 0;
+    packet->SetPtsSpecial(ptsSpecial_);
+    if (len == GetPacketSize()) {
+        packet->SetPts(pts_);
+        packets.push_back(packet);
+        return;
+    }
+    // Only whole packets carry several frames, so an incomplete one goes out as the frames it holds.
+    for (size_t offset = 0, index = 0; offset < len; offset += frameSize_, index++) {
+        std::shared_ptr<AudioData> frame = AudioData::Slice(packet, offset, frameSize_);
+        if (frame == nullptr) {
+            DHLOGE("Slice frame failed, drop %{public}zu bytes.", len - offset);
+            return;
+        }
+        frame->SetPts(pts_ > 0 ? pts_ + static_cast<int64_t>(index) * frameUs_ : pts_);
+        frame->SetPtsSpecial(ptsSpecial_);
+        packets.push_back(frame);
+    }
+}
+
+std::shared_ptr<AudioData> AudioPacketizer::AcquirePacket()
+{
+    size_t size = GetPacketSize();
+    std::shared_ptr<AudioData> packet = allocator_ != nullptr ? allocator_(size) : nullptr;
+    if (packet != nullptr && packet->Size() == size) {
+        return packet;
+    }
+    packet = AcquireAudioData(pool_, size);
+    if (packet == nullptr || packet->Size() != size) {
+        return nullptr;
+    }
+    return packet;
+}
+
+uint32_t AudioPacketizer::GetFramesPerPacket() const
+{
+    return framesPerPacket_;
+}
+
+size_t AudioPacketizer::GetPacketSize() const
+{
+    return frameSize_ * framesPerPacket_;
+}
+
+bool AudioPacketizer::IsAggregated(const size_t frameSize) const
+{
+    return framesPerPacket_ > 1 && frameSize == frameSize_;
+}
+
+uint32_t AudioPacketizer::GetPacketTimeMs(const AudioParam &param)
+{
+    const std::string &key = IsVoiceProfile(param) ? PACKET_TIME_VOICE_PARA : PACKET_TIME_MEDIA_PARA;
+    int32_t packetMs = 0;
+    if (!GetSysPara(key.c_str(), packetMs) || packetMs <= 0) {
+        return PACKET_DEFAULT_MS;
+    }
+    return std::min(static_cast<uint32_t>(packetMs), PACKET_MAX_MS);
+}
+
+uint32_t AudioPacketizer::NegotiateFramesPerPacket(const AudioParam &param)
+{
+    int64_t frameUs = GetDurationUs(param, param.comParam.frameSize);
+    if (param.comParam.frameSize == 0 || frameUs <= 0) {
+        return 1;
+    }
+    int64_t packetUs = static_cast<int64_t>(GetPacketTimeMs(param)) * AUDIO_US_PER_SECOND / AUDIO_MS_PER_SECOND;
+    return static_cast<uint32_t>(std::max<int64_t>(packetUs / frameUs, 1));
+}
+
+bool AudioPacketizer::IsValidFramesPerPacket(const AudioParam &param)
+{
+    uint32_t packetFrames = param.comParam.packetFrames;
+    if (packetFrames < 1) {
+        return false;
+    }
+    if (packetFrames == 1) {
+        return true;
+    }
+    int64_t frameUs = GetDurationUs(param, param.comParam.frameSize);
+    if (param.comParam.frameSize == 0 || frameUs <= 0) {
+        return false;
+    }
+    int64_t maxUs = static_cast<int64_t>(PACKET_MAX_MS) * AUDIO_US_PER_SECOND / AUDIO_MS_PER_SECOND;
+    return static_cast<int64_t>(packetFrames) <= std::max<int64_t>(maxUs / frameUs, 1);
+}
+
+bool AudioPacketizer::IsMismatchedPacket(const AudioParam &param, const size_t size)
+{
+    size_t frameSize = param.comParam.frameSize;
+    if (frameSize == 0 || param.comParam.packetFrames <= 1 || !IsValidFramesPerPacket(param)) {
+        return false;
+    }
+    return size != frameSize && size != frameSize * static_cast<size_t>(param.comParam.packetFrames);
+}
+
+int32_t AudioPacketizer::Split(const std::shared_ptr<AudioData> &packet, const AudioParam &param,
+    std::vector<std::shared_ptr<AudioData>> &frames)
+{
+    CHECK_NULL_RETURN(packet, ERR_DH_AUDIO_NULLPTR);
+    size_t frameSize = param.comParam.frameSize;
+    size_t size = packet->Size();
+    // Without aggregation the stream is not split, and a single frame is a flushed part of a packet.
+    if (frameSize == 0 || param.comParam.packetFrames <= 1 || !IsValidFramesPerPacket(param) ||
+        size == frameSize) {
+        frames.push_back(packet);
+        return DH_SUCCESS;
+    }
+    if (IsMismatchedPacket(param, size)) {
+        // Consumers assume frameSize, so a buffer of whole frames is re-sliced and any other is dropped.
+        if (size % frameSize != 0) {
+            DHLOGE("Drop mismatched packet, size: %{public}zu, frame size: %{public}zu.", size, frameSize);
+            return ERR_DH_AUDIO_BAD_VALUE;
+        }
+        DHLOGW("Re-slice mismatched packet, size: %{public}zu, frame size: %{public}zu.", size, frameSize);
+    }
+    int64_t frameUs = GetDurationUs(param, frameSize);
+    int64_t pts = packet->GetPts();
+    int64_t ptsSpecial = packet->GetPtsSpecial();
+    for (size_t offset = 0, index = 0; offset < size; offset += frameSize, index++) {
+        std::shared_ptr<AudioData> frame = AudioData::Slice(packet, offset, frameSize);
+        CHECK_NULL_RETURN(frame, ERR_DH_AUDIO_NULLPTR);
+        // A zero pts means the sender did not stamp the stream, so it is not offset either.
+        frame->SetPts(pts > 0 ? pts + static_cast<int64_t>(index) * frameUs : pts);
+        frame->SetPtsSpecial(ptsSpecial);
+        frames.push_back(frame);
+    }
+    return DH_SUCCESS;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
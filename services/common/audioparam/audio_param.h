@@ -91,6 +91,7 @@ typedef struct AudioCommonParam {
     AudioSampleFormat bitFormat = SAMPLE_U8;
     AudioCodecType codecType = AUDIO_CODEC_AAC;
     uint32_t frameSize = 0;
+    uint32_t packetFrames = 1;
 } AudioCommonParam;
 
 typedef struct AudioCaptureOptions {
@@ -17,6 +17,15 @@
 #include "audio_data_test.h"
 #undef private
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "audio_data_chain.h"
+#include "audio_data_pool.h"
+#include "audio_data_queue.h"
+#include "audio_packetizer.h"
 #include "daudio_constants.h"
 
 using namespace testing;
@@ -77,7 +86,7 @@ HWTEST_F(AudioDataTest, FindInt32_001, TestSize.Level1)
     const std::string name = "name";
     int32_t value = 1;
     ASSERT_NE(audioData, nullptr);
-    audioData->int32Map_.insert(std::make_pair(name, value));
+    audioData->SetInt32(name, value);
     EXPECT_EQ(true, audioData->FindInt32(name, value));
 }
 
@@ -135,7 +144,7 @@ HWTEST_F(AudioDataTest, FindString_001, TestSize.Level1)
     const std::string name = "name";
     string value = "value";
     ASSERT_NE(audioData, nullptr);
-    audioData->stringMap_.insert(std::make_pair(name, value));
+    audioData->SetString(name, value);
     EXPECT_EQ(true, audioData->FindString(name, value));
 }
 
@@ -166,5 +175,612 @@ HWTEST_F(AudioDataTest, GetPtsSpecial_001, TestSize.Level1)
     audioData->SetPtsSpecial(pts);
     EXPECT_EQ(0, audioData->GetPtsSpecial());
 }
+
+/**
+ * @tc.name: Meta_001
+ * @tc.desc: Verify typed metadata slots and flags.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, Meta_001, TestSize.Level1)
+{
+    ASSERT_NE(audioData, nullptr);
+    int64_t value = 1;
+    EXPECT_FALSE(audioData->GetMeta(AudioDataMetaKey::SEQUENCE, value));
+    EXPECT_EQ(0, value);
+    audioData->SetMeta(AudioDataMetaKey::SEQUENCE, 10);
+    EXPECT_TRUE(audioData->GetMeta(AudioDataMetaKey::SEQUENCE, value));
+    EXPECT_EQ(10, value);
+    audioData->SetPts(20);
+    EXPECT_TRUE(audioData->GetMeta(AudioDataMetaKey::PTS, value));
+    EXPECT_EQ(20, audioData->GetPts());
+    EXPECT_FALSE(audioData->GetMeta(AudioDataMetaKey::META_KEY_MAX, value));
+
+    EXPECT_FALSE(audioData->HasFlag(AUDIO_DATA_FLAG_SILENCE));
+    audioData->SetFlags(AUDIO_DATA_FLAG_SILENCE);
+    audioData->SetFlags(AUDIO_DATA_FLAG_DISCONTINUITY);
+    EXPECT_TRUE(audioData->HasFlag(AUDIO_DATA_FLAG_SILENCE));
+    EXPECT_TRUE(audioData->HasFlag(AUDIO_DATA_FLAG_DISCONTINUITY));
+    EXPECT_FALSE(audioData->HasFlag(AUDIO_DATA_FLAG_CONCEALED));
+
+    audioData->ResetMeta();
+    EXPECT_FALSE(audioData->GetMeta(AudioDataMetaKey::SEQUENCE, value));
+    EXPECT_FALSE(audioData->HasFlag(AUDIO_DATA_FLAG_SILENCE));
+    EXPECT_EQ(0, audioData->GetPts());
+}
+
+/**
+ * @tc.name: ExtMeta_001
+ * @tc.desc: Verify extension metadata is bounded and updatable in place.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, ExtMeta_001, TestSize.Level1)
+{
+    ASSERT_NE(audioData, nullptr);
+    uint32_t key = 0;
+    for (; key < audioData->EXT_META_MAX_NUM; key++) {
+        EXPECT_EQ(DH_SUCCESS, audioData->SetExtMeta(key, key));
+    }
+    EXPECT_EQ(ERR_DH_AUDIO_FAILED, audioData->SetExtMeta(key, key));
+    EXPECT_EQ(DH_SUCCESS, audioData->SetExtMeta(0, 100));
+    int64_t value = 0;
+    EXPECT_TRUE(audioData->GetExtMeta(0, value));
+    EXPECT_EQ(100, value);
+    EXPECT_FALSE(audioData->GetExtMeta(key, value));
+}
+
+/**
+ * @tc.name: AudioDataPool_001
+ * @tc.desc: Verify a released frame is recycled and its state is reset on the next Acquire.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, AudioDataPool_001, TestSize.Level1)
+{
+    size_t capacity = 960;
+    auto pool = std::make_shared<AudioDataPool>(capacity, 1);
+    ASSERT_EQ(1, pool->PoolSize());
+    auto first = pool->Acquire(capacity);
+    ASSERT_NE(nullptr, first);
+    AudioData *raw = first.get();
+    first->SetPts(100);
+    first->SetRange(0, capacity / 2);
+    first->Data()[0] = 1;
+    first = nullptr;
+
+    auto second = pool->Acquire(capacity, true);
+    ASSERT_NE(nullptr, second);
+    EXPECT_EQ(raw, second.get());
+    EXPECT_EQ(0, second->GetPts());
+    EXPECT_EQ(capacity, second->Size());
+    EXPECT_EQ(0, second->Data()[0]);
+    EXPECT_EQ(0, pool->GetMissCount());
+}
+
+/**
+ * @tc.name: AudioDataPool_002
+ * @tc.desc: Verify Acquire falls back to the heap when the pool is drained or the capacity differs.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, AudioDataPool_002, TestSize.Level1)
+{
+    size_t capacity = 960;
+    auto pool = std::make_shared<AudioDataPool>(capacity, 1);
+    auto pooled = pool->Acquire(capacity);
+    auto drained = pool->Acquire(capacity);
+    ASSERT_NE(nullptr, drained);
+    EXPECT_NE(pooled.get(), drained.get());
+    EXPECT_EQ(capacity, drained->Capacity());
+    auto other = pool->Acquire(capacity * 2);
+    ASSERT_NE(nullptr, other);
+    EXPECT_EQ(capacity * 2, other->Capacity());
+    EXPECT_EQ(2, pool->GetMissCount());
+
+    std::weak_ptr<AudioDataPool> weakPool = pool;
+    pool = nullptr;
+    EXPECT_FALSE(weakPool.expired());
+    pooled = nullptr;
+    EXPECT_TRUE(weakPool.expired());
+    EXPECT_EQ(capacity, AcquireAudioData(nullptr, capacity)->Capacity());
+}
+
+/**
+ * @tc.name: AudioDataPool_003
+ * @tc.desc: Verify concurrent Acquire and release never hand out the same frame twice.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, AudioDataPool_003, TestSize.Level1)
+{
+    size_t capacity = 64;
+    uint32_t poolSize = 8;
+    int32_t threadNum = 4;
+    int32_t loops = 10000;
+    auto pool = std::make_shared<AudioDataPool>(capacity, poolSize);
+    std::atomic<int32_t> corrupted = 0;
+    std::vector<std::thread> threads;
+    for (int32_t t = 0; t < threadNum; t++) {
+        threads.emplace_back([pool, t, loops, &corrupted]() {
+            for (int32_t i = 0; i < loops; i++) {
+                auto data = pool->Acquire(pool->Capacity());
+                data->Data()[0] = static_cast<uint8_t>(t);
+                std::this_thread::yield();
+                if (data->Data()[0] != static_cast<uint8_t>(t)) {
+                    corrupted++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0, corrupted.load());
+}
+/**
+ * @tc.name: Slice_001
+ * @tc.desc: Verify a slice shares memory with its origin and keeps a pooled frame out of the pool.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, Slice_001, TestSize.Level1)
+{
+    size_t capacity = 20;
+    ASSERT_NE(audioData, nullptr);
+    EXPECT_EQ(nullptr, AudioData::Slice(audioData, 10, 11));
+    EXPECT_EQ(nullptr, AudioData::Slice(nullptr, 0, 1));
+    auto slice = AudioData::Slice(audioData, 5, 10);
+    ASSERT_NE(nullptr, slice);
+    EXPECT_TRUE(slice->IsView());
+    EXPECT_EQ(audioData->Data() + 5, slice->Data());
+    EXPECT_EQ(10, slice->Capacity());
+    auto subSlice = AudioData::Slice(slice, 2, 2);
+    ASSERT_NE(nullptr, subSlice);
+    EXPECT_EQ(audioData, subSlice->owner_);
+    subSlice->Data()[0] = 1;
+    EXPECT_EQ(1, audioData->Data()[7]);
+
+    auto pool = std::make_shared<AudioDataPool>(capacity, 1);
+    auto pooled = pool->Acquire(capacity);
+    auto pooledSlice = AudioData::Slice(pooled, 0, capacity);
+    pooled = nullptr;
+    EXPECT_NE(pooledSlice->Data(), pool->Acquire(capacity)->Data());
+    pooledSlice = nullptr;
+    EXPECT_EQ(1, pool->GetMissCount());
+    EXPECT_NE(nullptr, pool->Acquire(capacity));
+    EXPECT_EQ(1, pool->GetMissCount());
+}
+
+/**
+ * @tc.name: Wrap_001
+ * @tc.desc: Verify a wrapped view points at external memory and pins its keeper until the last slice is gone.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, Wrap_001, TestSize.Level1)
+{
+    size_t size = 8;
+    uint8_t external[8] = {0};
+    auto keeper = std::make_shared<int32_t>(0);
+    std::weak_ptr<int32_t> weakKeeper = keeper;
+    EXPECT_EQ(nullptr, AudioData::Wrap(nullptr, size, keeper));
+    EXPECT_EQ(nullptr, AudioData::Wrap(external, 0, keeper));
+    EXPECT_EQ(nullptr, AudioData::Wrap(external, size, nullptr));
+    auto view = AudioData::Wrap(external, size, keeper);
+    ASSERT_NE(nullptr, view);
+    EXPECT_TRUE(view->IsView());
+    EXPECT_EQ(external, view->Data());
+    EXPECT_EQ(size, view->Size());
+    EXPECT_EQ(keeper, view->GetKeeper());
+    auto slice = AudioData::Slice(view, 2, 4);
+    ASSERT_NE(nullptr, slice);
+    EXPECT_EQ(keeper, slice->GetKeeper());
+    slice->Data()[0] = 1;
+    EXPECT_EQ(1, external[2]);
+
+    keeper = nullptr;
+    view = nullptr;
+    EXPECT_FALSE(weakKeeper.expired());
+    slice = nullptr;
+    EXPECT_TRUE(weakKeeper.expired());
+}
+
+/**
+ * @tc.name: LargeBuffer_001
+ * @tc.desc: Verify large-buffer mode lifts the per-frame capacity limit.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, LargeBuffer_001, TestSize.Level1)
+{
+    size_t capacity = 8 * 4096;
+    auto normal = std::make_shared<AudioData>(capacity);
+    EXPECT_EQ(0, normal->Capacity());
+    auto large = std::make_shared<AudioData>(capacity, true);
+    EXPECT_EQ(capacity, large->Capacity());
+    EXPECT_NE(nullptr, large->Data());
+}
+
+/**
+ * @tc.name: AudioDataChain_001
+ * @tc.desc: Verify Take slices inside a segment and gathers across segment boundaries.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, AudioDataChain_001, TestSize.Level1)
+{
+    size_t segSize = 6;
+    AudioDataChain chain;
+    for (uint8_t seg = 0; seg < 2; seg++) {
+        auto data = std::make_shared<AudioData>(segSize);
+        for (size_t i = 0; i < segSize; i++) {
+            data->Data()[i] = static_cast<uint8_t>(seg * segSize + i);
+        }
+        EXPECT_EQ(DH_SUCCESS, chain.Append(data));
+    }
+    EXPECT_EQ(ERR_DH_AUDIO_NULLPTR, chain.Append(nullptr));
+    EXPECT_EQ(segSize * 2, chain.Size());
+
+    auto first = chain.Take(4);
+    ASSERT_NE(nullptr, first);
+    EXPECT_TRUE(first->IsView());
+    EXPECT_EQ(0, first->Data()[0]);
+
+    auto second = chain.Take(4);
+    ASSERT_NE(nullptr, second);
+    EXPECT_FALSE(second->IsView());
+    for (size_t i = 0; i < 4; i++) {
+        EXPECT_EQ(4 + i, second->Data()[i]);
+    }
+    EXPECT_EQ(1, chain.SegmentNum());
+    EXPECT_EQ(nullptr, chain.Take(5));
+
+    uint8_t out[4] = {0};
+    EXPECT_EQ(DH_SUCCESS, chain.CopyTo(out, sizeof(out)));
+    EXPECT_EQ(8, out[0]);
+    EXPECT_EQ(DH_SUCCESS, chain.Consume(4));
+    EXPECT_EQ(0, chain.Size());
+    EXPECT_EQ(0, chain.SegmentNum());
+    EXPECT_EQ(ERR_DH_AUDIO_FAILED, chain.Consume(1));
+}
+/**
+ * @tc.name: AudioDataQueue_001
+ * @tc.desc: Verify the queue keeps order, trims to its max depth on pop and evicts the oldest from a full ring.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, AudioDataQueue_001, TestSize.Level1)
+{
+    uint32_t maxDepth = 3;
+    AudioDataQueue queue(maxDepth);
+    EXPECT_EQ(maxDepth, queue.MaxDepth());
+    EXPECT_EQ(nullptr, queue.Pop());
+    EXPECT_FALSE(queue.Push(nullptr));
+    for (int64_t i = 0; i < 2; i++) {
+        auto data = std::make_shared<AudioData>(1);
+        data->SetPts(i);
+        EXPECT_TRUE(queue.Push(data));
+    }
+    EXPECT_EQ(2, queue.Size());
+    EXPECT_EQ(0, queue.Pop()->GetPts());
+    EXPECT_EQ(1, queue.Pop()->GetPts());
+    EXPECT_EQ(0, queue.Size());
+
+    int64_t slotNum = 8;
+    for (int64_t i = 0; i < slotNum; i++) {
+        auto data = std::make_shared<AudioData>(1);
+        data->SetPts(i);
+        EXPECT_TRUE(queue.Push(data));
+    }
+    auto newest = std::make_shared<AudioData>(1);
+    newest->SetPts(slotNum);
+    EXPECT_TRUE(queue.Push(newest));
+    EXPECT_EQ(1, queue.GetDropCount());
+    EXPECT_EQ(slotNum, queue.Size());
+    EXPECT_EQ(slotNum + 1 - maxDepth, queue.Pop()->GetPts());
+    EXPECT_EQ(maxDepth - 1, queue.Size());
+    EXPECT_EQ(slotNum + 1 - maxDepth, queue.GetDropCount());
+    EXPECT_EQ(slotNum - 1, queue.Pop()->GetPts());
+    EXPECT_EQ(newest, queue.Pop());
+}
+
+/**
+ * @tc.name: AudioDataQueue_002
+ * @tc.desc: Verify waiters are woken by the producer and the consumer across threads.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, AudioDataQueue_002, TestSize.Level1)
+{
+    int64_t frameNum = 10000;
+    int64_t timeoutNs = 1000000000;
+    AudioDataQueue queue(frameNum);
+    EXPECT_EQ(ERR_DH_AUDIO_SA_WAIT_TIMEOUT, queue.WaitSize(1, 1000));
+    std::thread producer([&queue, frameNum]() {
+        for (int64_t i = 0; i < frameNum; i++) {
+            auto data = std::make_shared<AudioData>(1);
+            data->SetPts(i);
+            while (!queue.Push(data)) {}
+        }
+    });
+    int64_t expected = 0;
+    while (expected < frameNum) {
+        if (queue.WaitSize(1, timeoutNs) != DH_SUCCESS) {
+            continue;
+        }
+        auto data = queue.Pop();
+        if (data == nullptr) {
+            break;
+        }
+        EXPECT_EQ(expected, data->GetPts());
+        expected++;
+    }
+    producer.join();
+    EXPECT_EQ(frameNum, expected);
+
+    queue.Push(std::make_shared<AudioData>(1));
+    std::thread consumer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        queue.Pop();
+    });
+    EXPECT_EQ(DH_SUCCESS, queue.WaitEmpty(timeoutNs));
+    consumer.join();
+    EXPECT_EQ(0, queue.Size());
+}
+
+static AudioParam MakePacketParam()
+{
+    AudioParam param;
+    param.comParam.sampleRate = SAMPLE_RATE_48000;
+    param.comParam.channelMask = STEREO;
+    param.comParam.bitFormat = SAMPLE_S16LE;
+    param.comParam.frameSize = 3840;
+    param.comParam.packetFrames = 3;
+    return param;
+}
+
+/**
+ * @tc.name: AudioPacketizer_001
+ * @tc.desc: Verify frames are gathered into packets of the negotiated size with the pts of their first frame.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, AudioPacketizer_001, TestSize.Level1)
+{
+    AudioParam param = MakePacketParam();
+    size_t frameSize = param.comParam.frameSize;
+    int64_t frameUs = 20000;
+    AudioPacketizer packetizer;
+    EXPECT_EQ(DH_SUCCESS, packetizer.Init(param));
+    EXPECT_EQ(3, packetizer.GetFramesPerPacket());
+    EXPECT_EQ(frameSize * 3, packetizer.GetPacketSize());
+
+    std::vector<std::shared_ptr<AudioData>> packets;
+    EXPECT_EQ(ERR_DH_AUDIO_NULLPTR, packetizer.Push(nullptr, packets));
+    for (int64_t i = 0; i < 4; i++) {
+        auto frame = std::make_shared<AudioData>(frameSize);
+        frame->Data()[0] = static_cast<uint8_t>(i);
+        frame->SetPts(i * frameUs);
+        EXPECT_EQ(DH_SUCCESS, packetizer.Push(frame, packets));
+    }
+    ASSERT_EQ(1, packets.size());
+    EXPECT_EQ(frameSize * 3, packets[0]->Size());
+    EXPECT_EQ(0, packets[0]->GetPts());
+    EXPECT_EQ(1, packets[0]->Data()[frameSize]);
+    EXPECT_EQ(2, packets[0]->Data()[frameSize * 2]);
+
+    auto odd = std::make_shared<AudioData>(frameSize / 2);
+    EXPECT_EQ(DH_SUCCESS, packetizer.Push(odd, packets));
+    ASSERT_EQ(3, packets.size());
+    EXPECT_EQ(frameSize, packets[1]->Size());
+    EXPECT_EQ(3 * frameUs, packets[1]->GetPts());
+    EXPECT_EQ(odd, packets[2]);
+    packetizer.Flush(packets);
+    EXPECT_EQ(3, packets.size());
+
+    param.comParam.frameSize = 0;
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_VALUE, packetizer.Init(param));
+    EXPECT_EQ(AudioPacketizer::PACKET_DEFAULT_MS, AudioPacketizer::GetPacketTimeMs(param));
+    param.renderOpts.streamUsage = STREAM_USAGE_VOICE_COMMUNICATION;
+    EXPECT_EQ(AudioPacketizer::PACKET_DEFAULT_MS, AudioPacketizer::GetPacketTimeMs(param));
+    param.comParam.frameSize = MakePacketParam().comParam.frameSize;
+    param.comParam.packetFrames = AudioPacketizer::NegotiateFramesPerPacket(param);
+    EXPECT_EQ(1, param.comParam.packetFrames);
+    EXPECT_EQ(DH_SUCCESS, packetizer.Init(param));
+    EXPECT_EQ(1, packetizer.GetFramesPerPacket());
+}
+
+/**
+ * @tc.name: AudioPacketizer_002
+ * @tc.desc: Verify a packet is split into views of its frames and mismatched buffers are re-sliced or dropped.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, AudioPacketizer_002, TestSize.Level1)
+{
+    AudioParam param = MakePacketParam();
+    size_t frameSize = param.comParam.frameSize;
+    int64_t pts = 1000000;
+    int64_t frameUs = 20000;
+    auto packet = std::make_shared<AudioData>(frameSize * 3, true);
+    packet->SetPts(pts);
+    packet->Data()[frameSize * 2] = 2;
+    std::vector<std::shared_ptr<AudioData>> frames;
+    EXPECT_EQ(ERR_DH_AUDIO_NULLPTR, AudioPacketizer::Split(nullptr, param, frames));
+    EXPECT_EQ(DH_SUCCESS, AudioPacketizer::Split(packet, param, frames));
+    ASSERT_EQ(3, frames.size());
+    for (int64_t i = 0; i < 3; i++) {
+        EXPECT_TRUE(frames[i]->IsView());
+        EXPECT_EQ(frameSize, frames[i]->Size());
+        EXPECT_EQ(pts + i * frameUs, frames[i]->GetPts());
+    }
+    EXPECT_EQ(2, frames[2]->Data()[0]);
+
+    frames.clear();
+    auto single = std::make_shared<AudioData>(frameSize, true);
+    EXPECT_FALSE(AudioPacketizer::IsMismatchedPacket(param, frameSize));
+    EXPECT_EQ(DH_SUCCESS, AudioPacketizer::Split(single, param, frames));
+    ASSERT_EQ(1, frames.size());
+    EXPECT_EQ(single, frames[0]);
+
+    frames.clear();
+    auto odd = std::make_shared<AudioData>(frameSize + 4, true);
+    EXPECT_TRUE(AudioPacketizer::IsMismatchedPacket(param, frameSize + 4));
+    EXPECT_EQ(ERR_DH_AUDIO_BAD_VALUE, AudioPacketizer::Split(odd, param, frames));
+    EXPECT_TRUE(frames.empty());
+
+    auto partial = std::make_shared<AudioData>(frameSize * 2, true);
+    partial->SetPts(pts);
+    EXPECT_TRUE(AudioPacketizer::IsMismatchedPacket(param, frameSize * 2));
+    EXPECT_EQ(DH_SUCCESS, AudioPacketizer::Split(partial, param, frames));
+    ASSERT_EQ(2, frames.size());
+    for (int64_t i = 0; i < 2; i++) {
+        EXPECT_EQ(frameSize, frames[i]->Size());
+        EXPECT_EQ(pts + i * frameUs, frames[i]->GetPts());
+    }
+
+    frames.clear();
+    param.comParam.packetFrames = 1;
+    EXPECT_FALSE(AudioPacketizer::IsMismatchedPacket(param, frameSize * 3));
+    EXPECT_EQ(DH_SUCCESS, AudioPacketizer::Split(packet, param, frames));
+    ASSERT_EQ(1, frames.size());
+    EXPECT_EQ(packet, frames[0]);
+}
+
+/**
+ * @tc.name: AudioPacketizer_003
+ * @tc.desc: Verify packets are gathered into buffers from the packet allocator.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, AudioPacketizer_003, TestSize.Level1)
+{
+    AudioParam param = MakePacketParam();
+    size_t frameSize = param.comParam.frameSize;
+    AudioPacketizer packetizer;
+    EXPECT_EQ(DH_SUCCESS, packetizer.Init(param));
+    EXPECT_TRUE(packetizer.IsAggregated(frameSize));
+    EXPECT_FALSE(packetizer.IsAggregated(frameSize / 2));
+    std::vector<std::shared_ptr<AudioData>> allocated;
+    packetizer.SetPacketAllocator([&allocated](size_t size) {
+        allocated.push_back(std::make_shared<AudioData>(size, true));
+        return allocated.back();
+    });
+
+    std::vector<std::shared_ptr<AudioData>> packets;
+    for (uint8_t i = 0; i < 3; i++) {
+        auto frame = std::make_shared<AudioData>(frameSize);
+        frame->Data()[0] = i;
+        EXPECT_EQ(DH_SUCCESS, packetizer.Push(frame, packets));
+    }
+    ASSERT_EQ(1, packets.size());
+    ASSERT_EQ(1, allocated.size());
+    EXPECT_EQ(allocated[0], packets[0]);
+    EXPECT_EQ(2, packets[0]->Data()[frameSize * 2]);
+
+    EXPECT_EQ(DH_SUCCESS, packetizer.Push(std::make_shared<AudioData>(frameSize), packets));
+    packetizer.SetPacketAllocator([](size_t size) { return std::make_shared<AudioData>(size + 1, true); });
+    packets.clear();
+    packetizer.Flush(packets);
+    ASSERT_EQ(1, packets.size());
+    EXPECT_EQ(frameSize, packets[0]->Size());
+
+    param.comParam.packetFrames = 1;
+    EXPECT_EQ(DH_SUCCESS, packetizer.Init(param));
+    EXPECT_FALSE(packetizer.IsAggregated(frameSize));
+}
+
+/**
+ * @tc.name: AudioPacketizer_004
+ * @tc.desc: Verify a packet keeps what a view held when pushed, even if its memory is rewritten later.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, AudioPacketizer_004, TestSize.Level1)
+{
+    AudioParam param = MakePacketParam();
+    size_t frameSize = param.comParam.frameSize;
+    AudioPacketizer packetizer;
+    EXPECT_EQ(DH_SUCCESS, packetizer.Init(param));
+    auto slot = std::make_shared<std::vector<uint8_t>>(frameSize, 1);
+    std::vector<std::shared_ptr<AudioData>> packets;
+    for (uint8_t i = 0; i < packetizer.GetFramesPerPacket(); i++) {
+        slot->assign(frameSize, i + 1);
+        auto view = AudioData::Wrap(slot->data(), frameSize, slot);
+        ASSERT_NE(nullptr, view);
+        EXPECT_EQ(DH_SUCCESS, packetizer.Push(view, packets));
+    }
+    ASSERT_EQ(1, packets.size());
+    for (uint8_t i = 0; i < packetizer.GetFramesPerPacket(); i++) {
+        EXPECT_EQ(i + 1, packets[0]->Data()[frameSize * i]);
+        EXPECT_EQ(i + 1, packets[0]->Data()[frameSize * (i + 1) - 1]);
+    }
+}
+
+/**
+ * @tc.name: AudioPacketizer_005
+ * @tc.desc: Verify packetFrames outside [1, PACKET_MAX_MS / frame duration] is rejected.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, AudioPacketizer_005, TestSize.Level1)
+{
+    AudioParam param = MakePacketParam();
+    size_t frameSize = param.comParam.frameSize;
+    EXPECT_TRUE(AudioPacketizer::IsValidFramesPerPacket(param));
+    param.comParam.packetFrames = 1;
+    EXPECT_TRUE(AudioPacketizer::IsValidFramesPerPacket(param));
+    const uint32_t hostile[] = { 0, 4, UINT32_MAX / 2, UINT32_MAX };
+    AudioPacketizer packetizer;
+    auto packet = std::make_shared<AudioData>(frameSize * 4, true);
+    for (uint32_t packetFrames : hostile) {
+        param.comParam.packetFrames = packetFrames;
+        EXPECT_FALSE(AudioPacketizer::IsValidFramesPerPacket(param));
+        EXPECT_EQ(ERR_DH_AUDIO_BAD_VALUE, packetizer.Init(param));
+        EXPECT_EQ(1, packetizer.GetFramesPerPacket());
+        EXPECT_EQ(frameSize, packetizer.GetPacketSize());
+        std::vector<std::shared_ptr<AudioData>> frames;
+        EXPECT_EQ(DH_SUCCESS, AudioPacketizer::Split(packet, param, frames));
+        ASSERT_EQ(1, frames.size());
+        EXPECT_EQ(packet, frames[0]);
+    }
+}
+
+/**
+ * @tc.name: AudioDataQueue_003
+ * @tc.desc: Verify a consumer racing the producer only loses the oldest frames and every loss is counted.
+ * @tc.type: FUNC
+ * @tc.require: AR000H0E5U
+ */
+HWTEST_F(AudioDataTest, AudioDataQueue_003, TestSize.Level1)
+{
+    int64_t frameNum = 20000;
+    uint32_t maxDepth = 4;
+    AudioDataQueue queue(maxDepth);
+    std::atomic<bool> isDone = false;
+    std::thread producer([&queue, &isDone, frameNum]() {
+        for (int64_t i = 0; i < frameNum; i++) {
+            auto data = std::make_shared<AudioData>(1);
+            data->SetPts(i);
+            EXPECT_TRUE(queue.Push(data));
+        }
+        isDone.store(true);
+    });
+    int64_t popped = 0;
+    int64_t lastPts = -1;
+    while (!isDone.load() || queue.Size() > 0) {
+        auto data = queue.Pop();
+        if (data == nullptr) {
+            continue;
+        }
+        EXPECT_GT(data->GetPts(), lastPts);
+        lastPts = data->GetPts();
+        popped++;
+    }
+    producer.join();
+    EXPECT_EQ(frameNum - 1, lastPts);
+    EXPECT_EQ(frameNum, popped + static_cast<int64_t>(queue.GetDropCount()));
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file